@@ -58,6 +58,48 @@ class Map(EventScheduler):
         super(Map, self).__init__()
         self.type = "wns.events.scheduler.Map"
 
+class Calendar(EventScheduler):
+    """Implementation using a calendar queue: events are hashed by their
+    time into buckets of equal width. Number of buckets and bucket width
+    adapt to the number of pending events and their time separation.
+
+    # no further arguments
+    __slots__ = []
+
+
+    Complexities (amortized, N represents the number of pending events)
+      - sendNow(...):   O(1)
+      - cancel(...):    O(1)
+      - sendDelay(...): O(1)
+      - sendAt(...):    O(1)
+    """
+    __slots__ = []
+
+    def __init__(self):
+        super(Calendar, self).__init__()
+        self.type = "wns.events.scheduler.Calendar"
+
+class Parallel(EventScheduler):
+    """Conservative parallel scheduler. Events are partitioned into logical
+    processes (e.g. one per node). Events for other logical processes must be
+    scheduled at least 'lookahead' seconds in the future, which allows to
+    execute all logical processes in parallel within windows of 'lookahead'
+    seconds. The result does not depend on the number of threads.
+
+    lookahead: minimum delay between logical processes in seconds. 0.0
+               disables the windows, all events are executed sequentially.
+
+    numberOfThreads: number of threads executing the logical processes
+                     (including the main thread)
+    """
+    __slots__ = ["lookahead", "numberOfThreads"]
+
+    def __init__(self, lookahead = 0.0, numberOfThreads = 1):
+        super(Parallel, self).__init__()
+        self.type = "wns.events.scheduler.Parallel"
+        self.lookahead = lookahead
+        self.numberOfThreads = numberOfThreads
+
 class RealTime(EventScheduler):
     """Tries to schedule the events in real time"""
 
@@ -67,14 +109,41 @@ class RealTime(EventScheduler):
         super(RealTime, self).__init__()
         self.type = "wns.events.scheduler.RealTime"
 
+class TimingWheel(object):
+    """Hierarchical timing wheel for CanTimeout, MultipleTimeout and
+    PeriodicTimeout. Arming and canceling a timer is O(1) and does not touch
+    the event scheduler. A timer enters the event scheduler when its tick is
+    reached and fires at its exact time.
+
+    resolution: length of a tick in seconds. Should be in the order of the
+                shortest timeouts.
+    """
+    __slots__ = ["resolution"]
+
+    def __init__(self, resolution = 1E-4):
+        super(TimingWheel, self).__init__()
+        self.resolution = resolution
+
 class Monitor(object):
     """ Collects some basic statistics about the event scheduler
 
     Additionally it provides some logging.
+
+    profile: attribute the CPU time of the processed events to the type of
+             their callable (or their tag, see
+             wns::events::scheduler::tagged). The report is written to
+             profileFileName in the output directory at shutdown.
+
+    profileSamplingInterval: measure only every n-th event (counting is
+                             always exact). Measuring costs about as much as
+                             a small event.
     """
 
     def __init__(self):
         super(Monitor, self).__init__()
+        self.profile = False
+        self.profileSamplingInterval = 1
+        self.profileFileName = "WNSEventProfile.dat"
         # the logger is set to normal logging per default. all log
         # messages are defined verbose in C++. thus with this setting
         # the logger remains effectively silent during simulation. If
@@ -36,6 +36,29 @@ class OutputStrategy(object):
     DELETE = openwns.pyconfig.Plugin('Delete')
     MOVE = openwns.pyconfig.Plugin('Move')
 
+class ForkReplications(object):
+    """ Run the warmup once and fork independent replications afterwards
+
+    The simulation runs until settlingTime, then numberOfReplications
+    child processes are forked. Each child reseeds the RNG with
+    environment.rng.seed + k + 1 (k = 0..numberOfReplications-1),
+    changes into the directory directoryPrefix + str(k) and continues up
+    to maxSimTime. The parent waits for all children and fails if any of
+    them fails.
+
+    outputDir must be a relative path. Files opened after the warmup must
+    be given with absolute paths. The event scheduler must run in a single
+    thread (fork() only copies the calling thread), i.e. a Parallel event
+    scheduler needs numberOfThreads = 1.
+    """
+    __slots__ = ["numberOfReplications", "settlingTime", "directoryPrefix"]
+
+    def __init__(self, numberOfReplications, settlingTime, directoryPrefix = "replication", **kw):
+        self.numberOfReplications = numberOfReplications
+        self.settlingTime = settlingTime
+        self.directoryPrefix = directoryPrefix
+        openwns.pyconfig.attrsetter(self, kw)
+
 class Modules(object):
     def __len__(self):
         return len(self.__getAllModules())
@@ -88,7 +111,7 @@ class OpenWNS(object):
 
     __slots__ = ["environment", "__postProcessingFuncs", "logger", "maxSimTime", "eventSchedulerMonitor",
     "simulationModel", "outputDir", "statusWriteInterval", "probesWriteInterval", "statusFileName",
-    "outputStrategy", "memConsumptionProbeBusName", "simTimeProbeBusName", "cpuCyclesProbeBusName"]
+    "outputStrategy", "forkReplications", "memConsumptionProbeBusName", "simTimeProbeBusName", "cpuCyclesProbeBusName"]
 
     modules = Modules()
 
@@ -104,6 +127,7 @@ class OpenWNS(object):
         self.probesWriteInterval = 10 * 60 # in seconds
         self.statusFileName = "WNSStatus.dat"
         self.outputStrategy = OutputStrategy.MOVE
+        self.forkReplications = None
         # make available for easy access in wns-core
         self.memConsumptionProbeBusName = "wns.Memory"
         self.simTimeProbeBusName = "wns.SimTimePerRealTime"
@@ -166,10 +190,13 @@ class OpenWNS(object):
 
 class Environment(object):
 
-    __slots__ = ["eventScheduler", "masterLogger", "rng", "probeBusRegistry"]
+    __slots__ = ["eventScheduler", "timingWheel", "masterLogger", "rng", "probeBusRegistry"]
 
     def __init__(self, **kw):
         self.eventScheduler = openwns.eventscheduler.Map()
+        # set to openwns.eventscheduler.TimingWheel() to keep timeouts out of
+        # the event scheduler until they (almost) expire
+        self.timingWheel = None
         self.masterLogger = openwns.logger.Master()
         self.rng = openwns.rng.RNG(useRandomSeed = False)
         self.probeBusRegistry = openwns.probebus.ProbeBusRegistry()
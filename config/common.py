@@ -32,7 +32,8 @@ commonEnv = CNBSEnvironment(PROJNAME       = 'wns',
                                               'dl',
                                               'boost_program_options',
                                               'boost_signals',
-					      'boost_date_time'],
+					      'boost_date_time',
+					      'rt'],
                             REVISIONCONTROL = RCS.Bazaar('../', 'library', 'main', '1.0'),
                             # set the python version
                             PYTHONVERSION = pythonVersion,
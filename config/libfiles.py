@@ -42,12 +42,18 @@ srcFiles = [
     'src/events/scheduler/Interface.cpp',
     'src/events/scheduler/CommandQueue.cpp',
     'src/events/scheduler/Map.cpp',
+    'src/events/scheduler/Calendar.cpp',
+    'src/events/scheduler/Parallel.cpp',
+    'src/events/scheduler/EventStore.cpp',
+    'src/events/scheduler/Callable.cpp',
     'src/events/scheduler/INotification.cpp',
     'src/events/scheduler/Monitor.cpp',
+    'src/events/scheduler/EventProfile.cpp',
     'src/events/scheduler/RealTime.cpp',
     'src/events/CanTimeout.cpp',
     'src/events/PeriodicTimeout.cpp',
     'src/events/PeriodicRealTimeout.cpp',
+    'src/events/TimingWheel.cpp',
     'src/events/tests/MultipleTimeoutTest.cpp',
 
 
@@ -148,6 +154,7 @@ srcFiles = [
     'src/tests/StaticFactoryTest.cpp',
     'src/tests/SmartPtrTest.cpp',
     'src/tests/SmartPtrWithDebuggingTest.cpp',
+    'src/tests/FreeListTest.cpp',
     'src/tests/PythonicOutputTest.cpp',
     'src/tests/StopWatchTest.cpp',
     'src/tests/BacktraceTest.cpp',
@@ -179,6 +186,7 @@ srcFiles = [
     'src/module/tests/ModuleTest.cpp',
     'src/module/tests/MultiTypeFactoryTest.cpp',
     'src/simulator/tests/MainTest.cpp',
+    'src/simulator/tests/ApplicationTest.cpp',
     'src/container/tests/FastListTest.cpp',
     'src/container/tests/UntypedRegistryTest.cpp',
     'src/container/tests/RegistryTest.cpp',
@@ -217,15 +225,24 @@ srcFiles = [
     'src/events/tests/MemberFunctionTest.cpp',
     'src/events/tests/DelayedMemberFunctionTest.cpp',
     'src/events/scheduler/tests/CallableTest.cpp',
+    'src/events/scheduler/tests/CommandQueueTest.cpp',
     'src/events/scheduler/tests/InterfaceTest.cpp',
     'src/events/scheduler/tests/MapInterfaceTest.cpp',
     'src/events/scheduler/tests/PerformanceTest.cpp',
+    'src/events/scheduler/tests/Benchmark.cpp',
     'src/events/scheduler/tests/MapPerformanceTest.cpp',
+    'src/events/scheduler/tests/CalendarInterfaceTest.cpp',
+    'src/events/scheduler/tests/CalendarPerformanceTest.cpp',
+    'src/events/scheduler/tests/ParallelInterfaceTest.cpp',
+    'src/events/scheduler/tests/ParallelTest.cpp',
+    'src/events/scheduler/tests/ParallelPerformanceTest.cpp',
+    'src/events/scheduler/tests/EventProfileTest.cpp',
     'src/events/scheduler/tests/BestPracticesTest.cpp',
     'src/events/scheduler/tests/RealTimeTest.cpp',
     'src/events/tests/CanTimeoutTest.cpp',
     'src/events/tests/PeriodicTimeoutTest.cpp',
     'src/events/tests/PeriodicRealTimeoutTest.cpp',
+    'src/events/tests/TimingWheelTest.cpp',
 
     'src/osi/tests/PCITest.cpp',
     'src/osi/tests/PDUTest.cpp',
@@ -399,6 +416,8 @@ srcFiles = [
     'src/ldk/FunctionalUnit.cpp',
     'src/ldk/CommandTypeSpecifier.cpp',
     'src/ldk/Compound.cpp',
+    'src/ldk/CommandArena.cpp',
+    'src/ldk/Journey.cpp',
     'src/ldk/CommandPool.cpp',
     'src/ldk/CommandProxy.cpp',
     'src/ldk/SinglePort.cpp',
@@ -427,6 +446,7 @@ srcFiles = [
     # ldk.Buffer
     'src/ldk/buffer/Buffer.cpp',
     'src/ldk/buffer/Bounded.cpp',
+    'src/ldk/buffer/CompoundQueue.cpp',
     'src/ldk/buffer/Dropping.cpp',
 
     # ldk.ARQ
@@ -456,9 +476,12 @@ srcFiles = [
     'src/ldk/sar/SegAndConcat.cpp',
     'src/ldk/sar/tests/SACSegmentingQueueIntegrationTest.cpp',
     'src/ldk/sar/tests/SegAndConcatTest.cpp',
+    'src/ldk/sar/reassembly/IntervalSet.cpp',
     'src/ldk/sar/reassembly/ReassemblyBuffer.cpp',
     'src/ldk/sar/reassembly/ReorderingWindow.cpp',
+    'src/ldk/sar/reassembly/tests/IntervalSetTest.cpp',
     'src/ldk/sar/reassembly/tests/ReassemblyBufferTest.cpp',
+    'src/ldk/sar/reassembly/tests/ReorderingWindowPerformanceTest.cpp',
     'src/ldk/sar/reassembly/tests/ReorderingWindowTest.cpp',
 
     # ldk.Concatenation
@@ -535,6 +558,9 @@ srcFiles = [
     'src/ldk/tests/FUTestBase.cpp',
     'src/ldk/tests/FUTestBaseTest.cpp',
     'src/ldk/tests/DelayedInterfaceTest.cpp',
+    'src/ldk/tests/CommandArenaTest.cpp',
+    'src/ldk/tests/JourneyTest.cpp',
+    'src/ldk/tests/KeyIndexTest.cpp',
     'src/ldk/tests/CommandProxyTest.cpp',
     'src/ldk/fun/tests/FUNTest.cpp',
     #'src/ldk/fun/tests/MainTest.cpp',
@@ -545,6 +571,7 @@ srcFiles = [
     'src/ldk/arq/tests/StopAndWaitTest.cpp',
     'src/ldk/arq/tests/CumulativeACKTest.cpp',
     'src/ldk/arq/tests/SelectiveRepeatTest.cpp',
+    'src/ldk/arq/tests/SequenceWindowTest.cpp',
     'src/ldk/arq/tests/GoBackNTest.cpp',
     'src/ldk/arq/tests/PiggyBackerTest.cpp',
     'src/ldk/arq/tests/StopAndWaitRCTest.cpp',
@@ -552,6 +579,7 @@ srcFiles = [
     'src/ldk/crc/tests/CRCTest.cpp',
     'src/ldk/crc/tests/CRCFilterTest.cpp',
     'src/ldk/buffer/tests/BoundedTest.cpp',
+    'src/ldk/buffer/tests/CompoundQueueTest.cpp',
     'src/ldk/buffer/tests/DroppingTest.cpp',
     'src/ldk/sar/tests/FixedTest.cpp',
     'src/ldk/sar/tests/DynamicSARTest.cpp',
@@ -663,6 +691,7 @@ hppFiles = [
 'src/rng/RNGen.hpp',
 'src/Singleton.hpp',
 'src/RefCountable.hpp',
+'src/FreeList.hpp',
 'src/Chamaeleon.hpp',
 'src/Interpolation.hpp',
 'src/ldk/arq/ARQ.hpp',
@@ -671,6 +700,7 @@ hppFiles = [
 'src/ldk/arq/None.hpp',
 'src/ldk/arq/PiggyBacker.hpp',
 'src/ldk/arq/SelectiveRepeat.hpp',
+'src/ldk/arq/SequenceWindow.hpp',
 'src/ldk/arq/statuscollector/Counter.hpp',
 'src/ldk/arq/statuscollector/Interface.hpp',
 'src/ldk/arq/statuscollector/None.hpp',
@@ -683,11 +713,13 @@ hppFiles = [
 'src/ldk/harq/softcombining/UniformRandomDecoder.hpp',
 'src/ldk/buffer/Bounded.hpp',
 'src/ldk/buffer/Buffer.hpp',
+'src/ldk/buffer/CompoundQueue.hpp',
 'src/ldk/buffer/Dropping.hpp',
 'src/ldk/buffer/tests/BoundedTest.hpp',
 'src/ldk/Classifier.hpp',
 'src/ldk/command/FlowControl.hpp',
 'src/ldk/Command.hpp',
+'src/ldk/CommandArena.hpp',
 'src/ldk/CommandPool.hpp',
 'src/ldk/CommandProxy.hpp',
 'src/ldk/CommandReaderInterface.hpp',
@@ -695,6 +727,8 @@ hppFiles = [
 'src/ldk/CommandTypeSpecifierInterface.hpp',
 'src/ldk/CompoundHandlerInterface.hpp',
 'src/ldk/Compound.hpp',
+'src/ldk/CompoundSpan.hpp',
+'src/ldk/Journey.hpp',
 'src/ldk/concatenation/Concatenation.hpp',
 'src/ldk/Connector.hpp',
 'src/ldk/ControlServiceInterface.hpp',
@@ -717,6 +751,7 @@ hppFiles = [
 'src/ldk/FlowGate.hpp',
 'src/ldk/flowseparator/CreatorStrategy.hpp',
 'src/ldk/flowseparator/FlowInfoProvider.hpp',
+'src/ldk/flowseparator/KeyIndex.hpp',
 'src/ldk/FlowSeparator.hpp',
 'src/ldk/flowseparator/NotFoundStrategy.hpp',
 'src/ldk/Forwarding.hpp',
@@ -777,6 +812,7 @@ hppFiles = [
 'src/ldk/sar/Soft.hpp',
 'src/ldk/sar/DynamicSAR.hpp',
 'src/ldk/sar/SegAndConcat.hpp',
+'src/ldk/sar/reassembly/IntervalSet.hpp',
 'src/ldk/sar/reassembly/ReassemblyBuffer.hpp',
 'src/ldk/sar/reassembly/ReorderingWindow.hpp',
 'src/ldk/SequentlyCallingLinkHandler.hpp',
@@ -861,15 +897,22 @@ hppFiles = [
 'src/events/PeriodicRealTimeout.hpp',
 'src/events/PeriodicTimeout.hpp',
 'src/events/MultipleTimeout.hpp',
+'src/events/TimingWheel.hpp',
 'src/events/scheduler/CommandQueue.hpp',
 'src/events/scheduler/Map.hpp',
+'src/events/scheduler/Calendar.hpp',
+'src/events/scheduler/Parallel.hpp',
+'src/events/scheduler/EventStore.hpp',
+'src/events/scheduler/EventHandle.hpp',
 'src/events/scheduler/Callable.hpp',
 'src/events/scheduler/ICommand.hpp',
 'src/events/scheduler/tests/InterfaceTest.hpp',
 'src/events/scheduler/tests/PerformanceTest.hpp',
+'src/events/scheduler/tests/Benchmark.hpp',
 'src/events/scheduler/RealTime.hpp',
 'src/events/scheduler/NullCommand.hpp',
 'src/events/scheduler/Monitor.hpp',
+'src/events/scheduler/EventProfile.hpp',
 'src/events/scheduler/INotification.hpp',
 'src/events/scheduler/IEvent.hpp',
 'src/events/scheduler/Interface.hpp',
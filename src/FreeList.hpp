@@ -0,0 +1,343 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_FREELIST_HPP
+#define WNS_FREELIST_HPP
+
+#include <cstdlib>
+#include <new>
+
+namespace wns {
+	/**
+	 * @brief Counters of a freelist (per thread)
+	 */
+	struct FreeListStatistics
+	{
+		/**
+		 * @brief Number of objects requested
+		 */
+		unsigned long int allocations;
+
+		/**
+		 * @brief Number of requests served from the freelist
+		 */
+		unsigned long int hits;
+
+		/**
+		 * @brief Number of objects given back
+		 */
+		unsigned long int deallocations;
+
+		/**
+		 * @brief Fraction of allocations served from the freelist
+		 */
+		double
+		getHitRate() const
+		{
+			return allocations == 0 ? 0.0 : double(hits) / double(allocations);
+		}
+
+		FreeListStatistics&
+		operator+=(const FreeListStatistics& other)
+		{
+			allocations += other.allocations;
+			hits += other.hits;
+			deallocations += other.deallocations;
+			return *this;
+		}
+	};
+
+	namespace detail {
+		/**
+		 * @brief State of one thread-local freelist
+		 *
+		 * Must be POD to be usable with __thread.
+		 */
+		struct FreeListState
+		{
+			struct Node
+			{
+				Node* next;
+			};
+
+			/**
+			 * @brief At most this many objects are kept per list and
+			 * thread, further objects go back to the heap
+			 */
+			static const std::size_t maxLength = 65536;
+
+			Node* head;
+			std::size_t length;
+			FreeListStatistics statistics;
+
+			void*
+			allocate(std::size_t size)
+			{
+				++statistics.allocations;
+				Node* node = head;
+				if (node != NULL)
+				{
+					head = node->next;
+					--length;
+					++statistics.hits;
+					return node;
+				}
+				return ::operator new(size < sizeof(Node) ? sizeof(Node) : size);
+			}
+
+			void
+			deallocate(void* p)
+			{
+				++statistics.deallocations;
+				if (length >= maxLength)
+				{
+					::operator delete(p);
+					return;
+				}
+				Node* node = static_cast<Node*>(p);
+				node->next = head;
+				head = node;
+				++length;
+			}
+
+			void
+			trim()
+			{
+				while (head != NULL)
+				{
+					Node* node = head;
+					head = node->next;
+					::operator delete(node);
+				}
+				length = 0;
+			}
+		};
+	} // detail
+
+	/**
+	 * @brief Thread-local freelist for blocks of SIZE bytes
+	 *
+	 * TAG separates lists of equally sized objects of different
+	 * types. Blocks freed in another thread than they were allocated in
+	 * end up in the freelist of the freeing thread. Memory is never
+	 * returned to the heap unless trim() is called or a list exceeds
+	 * detail::FreeListState::maxLength.
+	 */
+	template <std::size_t SIZE, typename TAG>
+	class FreeList
+	{
+	public:
+		static void*
+		allocate()
+		{
+			return state.allocate(SIZE);
+		}
+
+		static void
+		deallocate(void* p)
+		{
+			state.deallocate(p);
+		}
+
+		/**
+		 * @brief Counters of the calling thread
+		 */
+		static FreeListStatistics
+		getStatistics()
+		{
+			return state.statistics;
+		}
+
+		/**
+		 * @brief Number of blocks currently kept by the calling thread
+		 */
+		static std::size_t
+		getLength()
+		{
+			return state.length;
+		}
+
+		/**
+		 * @brief Give the blocks kept by the calling thread back to the heap
+		 */
+		static void
+		trim()
+		{
+			state.trim();
+		}
+
+	private:
+		static __thread detail::FreeListState state;
+	};
+
+	template <std::size_t SIZE, typename TAG>
+	__thread detail::FreeListState FreeList<SIZE, TAG>::state;
+
+	/**
+	 * @brief Derive T from PooledAllocation<T> to allocate T from a
+	 * freelist
+	 *
+	 * Only objects of exactly sizeof(T) bytes use the freelist, larger
+	 * derived classes are allocated from the heap as usual. Define
+	 * WNS_NO_FREELIST to disable pooling (e.g. for leak checking with
+	 * valgrind).
+	 *
+	 * @note Hides the global placement new for T.
+	 */
+	template <typename T>
+	class PooledAllocation
+	{
+	public:
+		static void*
+		operator new(std::size_t size)
+		{
+#ifndef WNS_NO_FREELIST
+			if (size == sizeof(T))
+			{
+				return FreeList<sizeof(T), T>::allocate();
+			}
+#endif
+			return ::operator new(size);
+		}
+
+		static void
+		operator delete(void* p, std::size_t size)
+		{
+			if (p == NULL)
+			{
+				return;
+			}
+#ifndef WNS_NO_FREELIST
+			if (size == sizeof(T))
+			{
+				FreeList<sizeof(T), T>::deallocate(p);
+				return;
+			}
+#endif
+			::operator delete(p);
+		}
+
+		/**
+		 * @brief Freelist counters of the calling thread
+		 */
+		static FreeListStatistics
+		getAllocationStatistics()
+		{
+			return FreeList<sizeof(T), T>::getStatistics();
+		}
+
+	protected:
+		~PooledAllocation()
+		{
+		}
+	};
+
+	/**
+	 * @brief Freelists for a hierarchy of differently sized classes
+	 *
+	 * Derive the base class of the hierarchy from
+	 * SizeClassAllocation<TAG>. Objects of up to
+	 * granularity*numberOfClasses bytes are allocated from one freelist per
+	 * size class (rounded up to granularity), larger ones from the heap.
+	 * WNS_NO_FREELIST disables pooling.
+	 *
+	 * @note Hides the global placement new for the hierarchy.
+	 */
+	template <typename TAG>
+	class SizeClassAllocation
+	{
+	public:
+		static const std::size_t granularity = 16;
+		static const std::size_t numberOfClasses = 16;
+
+		static void*
+		operator new(std::size_t size)
+		{
+#ifndef WNS_NO_FREELIST
+			std::size_t sizeClass = getSizeClass(size);
+			if (sizeClass < numberOfClasses)
+			{
+				return states[sizeClass].allocate((sizeClass + 1) * granularity);
+			}
+#endif
+			return ::operator new(size);
+		}
+
+		static void
+		operator delete(void* p, std::size_t size)
+		{
+			if (p == NULL)
+			{
+				return;
+			}
+#ifndef WNS_NO_FREELIST
+			std::size_t sizeClass = getSizeClass(size);
+			if (sizeClass < numberOfClasses)
+			{
+				states[sizeClass].deallocate(p);
+				return;
+			}
+#endif
+			::operator delete(p);
+		}
+
+		/**
+		 * @brief Freelist counters of the calling thread, summed over all
+		 * size classes
+		 */
+		static FreeListStatistics
+		getAllocationStatistics()
+		{
+			FreeListStatistics sum = FreeListStatistics();
+			for (std::size_t ii = 0; ii < numberOfClasses; ++ii)
+			{
+				sum += states[ii].statistics;
+			}
+			return sum;
+		}
+
+	protected:
+		~SizeClassAllocation()
+		{
+		}
+
+	private:
+		static std::size_t
+		getSizeClass(std::size_t size)
+		{
+			return size == 0 ? 0 : (size - 1) / granularity;
+		}
+
+		static __thread detail::FreeListState states[numberOfClasses];
+	};
+
+	template <typename TAG>
+	__thread detail::FreeListState
+	SizeClassAllocation<TAG>::states[SizeClassAllocation<TAG>::numberOfClasses];
+} // wns
+
+#endif // NOT defined WNS_FREELIST_HPP
@@ -32,6 +32,92 @@
 #include <stdint.h>
 
 namespace wns {
+	namespace refcount {
+		/**
+		 * @brief Plain (non thread-safe) reference counting
+		 *
+		 * This is the default. Objects counted with this policy must
+		 * only be shared among SmartPtrs of the same thread.
+		 */
+		class SingleThreaded
+		{
+		public:
+			static long int
+			get(const long int& count)
+			{
+				return count;
+			}
+
+			static void
+			increment(long int& count)
+			{
+				++count;
+			}
+
+			/**
+			 * @brief Returns the new value
+			 */
+			static long int
+			decrement(long int& count)
+			{
+				return --count;
+			}
+		};
+
+		/**
+		 * @brief Thread-safe reference counting with atomic operations
+		 *
+		 * Use for objects whose SmartPtrs are copied and released in
+		 * different threads (e.g. PDUs handed to worker threads). Each
+		 * increment/decrement is a locked instruction, so only pay for it
+		 * where needed.
+		 */
+		class Atomic
+		{
+		public:
+			static long int
+			get(const long int& count)
+			{
+				return __sync_add_and_fetch(const_cast<long int*>(&count), 0);
+			}
+
+			static void
+			increment(long int& count)
+			{
+				__sync_add_and_fetch(&count, 1);
+			}
+
+			/**
+			 * @brief Returns the new value
+			 */
+			static long int
+			decrement(long int& count)
+			{
+				return __sync_sub_and_fetch(&count, 1);
+			}
+		};
+
+#ifdef WNS_ATOMIC_REFCOUNT
+		typedef Atomic Default;
+#else
+		typedef SingleThreaded Default;
+#endif
+
+#ifdef WNS_REFCOUNT_STATISTICS
+		/**
+		 * @brief Number of increments and decrements of all reference
+		 * counts so far (only with WNS_REFCOUNT_STATISTICS, not
+		 * thread-safe)
+		 */
+		inline unsigned long int&
+		operations()
+		{
+			static unsigned long int operations = 0;
+			return operations;
+		}
+#endif
+	} // refcount
+
 	/**
 	 * @brief Part of reference counting with SmartPtr
 	 *
@@ -39,13 +125,19 @@ namespace wns {
 	 * to use SmartPtr you should derive your class to be reference counted
 	 * from this helper class.
 	 *
+	 * The COUNTINGPOLICY (refcount::SingleThreaded or refcount::Atomic)
+	 * determines whether the counter may be modified concurrently. Use
+	 * RefCountable (the default policy, atomic if WNS_ATOMIC_REFCOUNT is
+	 * defined) or AtomicRefCountable.
+	 *
 	 * @note You have to derive virtual and must not call the default
 	 * constructor!!!
 	 *
 	 * Example:
 	 * @include wns.RefCountableDerive.example
 	 */
-	class RefCountable
+	template <typename COUNTINGPOLICY>
+	class RefCountableBase
 	{
 		/**
 		 * @brief All SmartPtr are friend of the RefCountable
@@ -59,9 +151,21 @@ namespace wns {
 		long int
 		getRefCount() const
 		{
-			return count;
+			return COUNTINGPOLICY::get(count);
 		}
 
+#ifdef WNS_REFCOUNT_STATISTICS
+		/**
+		 * @brief Number of increments and decrements of all reference
+		 * counts so far (only with WNS_REFCOUNT_STATISTICS)
+		 */
+		static unsigned long int&
+		getOperations()
+		{
+			return refcount::operations();
+		}
+#endif
+
 	protected:
 		/**
 		 * @brief Must only be called by derived class
@@ -69,7 +173,7 @@ namespace wns {
 		 * @note It makes no sense to construct an create an instance of
 		 * RefCountable
 		 */
-		RefCountable() :
+		RefCountableBase() :
 			count(0)
 		{}
 
@@ -79,7 +183,7 @@ namespace wns {
 		 * @internal If something that is derived from this class needs to be
 		 * copied the refcount must be set to 0!!
 		 */
-		RefCountable(const RefCountable&) :
+		RefCountableBase(const RefCountableBase&) :
 			count(0)
 		{}
 
@@ -87,7 +191,7 @@ namespace wns {
 		 * @brief Destructor
 		 */
 		virtual
-		~RefCountable()
+		~RefCountableBase()
 		{}
 
 	private:
@@ -99,7 +203,10 @@ namespace wns {
 		void
 		incRefCount() const
 		{
-			++count;
+#ifdef WNS_REFCOUNT_STATISTICS
+			++getOperations();
+#endif
+			COUNTINGPOLICY::increment(count);
 		}
 
 		/**
@@ -110,11 +217,14 @@ namespace wns {
 		void
 		decRefCount() const
 		{
-			assure(count>0,
+			assure(getRefCount()>0,
 			       "Can't deref object with reference count<=0. "
 			       "This is normally an indication that "
 			       "someone did mess around with the SmartPtr.");
-			if(--count <= 0) {
+#ifdef WNS_REFCOUNT_STATISTICS
+			++getOperations();
+#endif
+			if(COUNTINGPOLICY::decrement(count) <= 0) {
 				delete this;
 			}
 		}
@@ -124,6 +234,16 @@ namespace wns {
 		 */
 		mutable long int count;
 	};
+
+	/**
+	 * @brief Reference counting with the default policy
+	 */
+	typedef RefCountableBase<refcount::Default> RefCountable;
+
+	/**
+	 * @brief Reference counting that is safe across threads
+	 */
+	typedef RefCountableBase<refcount::Atomic> AtomicRefCountable;
 } // wns
 
 #endif
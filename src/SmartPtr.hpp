@@ -42,6 +42,29 @@
 #include <list>
 
 namespace wns {
+	template <typename T>
+	class SmartPtr;
+
+	/**
+	 * @brief Marks a SmartPtr whose reference may be taken over
+	 *
+	 * Returned by wns::move(). A SmartPtr constructed or assigned from it
+	 * takes the raw pointer and leaves the source NULL, without touching
+	 * the reference count (C++98 replacement for rvalue references).
+	 */
+	template <typename T>
+	class SmartPtrTransfer
+	{
+	public:
+		explicit
+		SmartPtrTransfer(SmartPtr<T>& _source) :
+			source(_source)
+		{
+		}
+
+		SmartPtr<T>& source;
+	};
+
 	/**
 	 * @brief Intrusive reference counting
 	 * @author Marc Schinnenburg <marc@schinnenburg.com>
@@ -141,6 +164,59 @@ namespace wns {
 #endif
 		}
 
+		/**
+		 * @brief Take over the reference of another SmartPtr
+		 *
+		 * @code
+		 * CompoundPtr compound = wns::move(buffer.front());
+		 * buffer.pop_front();
+		 * @endcode
+		 */
+		SmartPtr(SmartPtrTransfer<T> t) :
+#ifdef WNS_SMARTPTR_DEBUGGING
+			SmartPtrBase(),
+			id(++getCounter()),
+			file(""),
+			line(0),
+#endif
+			ptr(t.source.ptr)
+		{
+			t.source.ptr = NULL;
+#ifdef WNS_SMARTPTR_DEBUGGING
+			this->created("", 0);
+#endif
+		}
+
+#if __cplusplus >= 201103L
+		/**
+		 * @brief Move constructor (C++11 builds only)
+		 */
+		SmartPtr(SmartPtr&& s) :
+#ifdef WNS_SMARTPTR_DEBUGGING
+			SmartPtrBase(),
+			id(++getCounter()),
+			file(""),
+			line(0),
+#endif
+			ptr(s.ptr)
+		{
+			s.ptr = NULL;
+#ifdef WNS_SMARTPTR_DEBUGGING
+			this->created("", 0);
+#endif
+		}
+
+		/**
+		 * @brief Move assignment (C++11 builds only)
+		 */
+		SmartPtr&
+		operator= (SmartPtr&& s)
+		{
+			swap(s);
+			return *this;
+		}
+#endif
+
 #ifdef WNS_SMARTPTR_DEBUGGING
 		/**
 		 * @brief Construct NULL pointer (additional debugging support)
@@ -241,6 +317,38 @@ namespace wns {
 			return *this;
 		}
 
+		/**
+		 * @brief Take over the reference of another SmartPtr
+		 *
+		 * The previous pointer (if any) is released, the source is NULL
+		 * afterwards.
+		 */
+		SmartPtr&
+		operator= (SmartPtrTransfer<T> t)
+		{
+			if (&t.source != this)
+			{
+				T* old = ptr;
+				ptr = t.source.ptr;
+				t.source.ptr = NULL;
+				if(old) {
+					old->decRefCount();
+				}
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Exchange the pointers, the reference counts stay untouched
+		 */
+		void
+		swap(SmartPtr& s)
+		{
+			T* tmp = ptr;
+			ptr = s.ptr;
+			s.ptr = tmp;
+		}
+
 		/**
 		 * @brief Automagically deletes pointer if reference count has
 		 * fallen to 0.
@@ -460,6 +568,121 @@ namespace wns {
 		T* ptr;
 	};
 
+	/**
+	 * @brief Let the receiving SmartPtr take over the reference of p
+	 *
+	 * p is NULL afterwards. Saves an increment/decrement pair of the
+	 * reference count wherever a SmartPtr is handed on and the source is
+	 * not needed anymore (e.g. when taking the front of a queue).
+	 */
+	template <typename T>
+	inline SmartPtrTransfer<T>
+	move(SmartPtr<T>& p)
+	{
+		return SmartPtrTransfer<T>(p);
+	}
+
+	template <typename T>
+	inline void
+	swap(SmartPtr<T>& a, SmartPtr<T>& b)
+	{
+		a.swap(b);
+	}
+
+	/**
+	 * @brief Non-owning view of an object held by SmartPtrs
+	 *
+	 * Construction, copy and destruction don't touch the reference
+	 * count. The view must not outlive the SmartPtrs keeping the object
+	 * alive. Use toSmartPtr() to take a reference again.
+	 */
+	template <typename T>
+	class SmartPtrView
+	{
+		class YOU__SHOULD__NOT_COMPARE__THIS__WITH__ANYTHING__BUT__NULL
+		{
+			void operator delete(void*);
+		};
+
+	public:
+		SmartPtrView() :
+			ptr(NULL)
+		{
+		}
+
+		template <typename OtherType>
+		SmartPtrView(const SmartPtr<OtherType>& s) :
+			ptr(s.getPtr())
+		{
+		}
+
+		template <typename OtherType>
+		SmartPtrView(const SmartPtrView<OtherType>& s) :
+			ptr(s.getPtr())
+		{
+		}
+
+		T&
+		operator* () const
+		{
+			assert(ptr != NULL);
+			return *ptr;
+		}
+
+		T*
+		operator-> () const
+		{
+			assert(ptr != NULL);
+			return ptr;
+		}
+
+		/**
+		 * @brief Enables: if(view), if(!view) and if(view == NULL)
+		 */
+		operator YOU__SHOULD__NOT_COMPARE__THIS__WITH__ANYTHING__BUT__NULL* () const
+		{
+			if (ptr == NULL)
+			{
+				return NULL;
+			}
+			static YOU__SHOULD__NOT_COMPARE__THIS__WITH__ANYTHING__BUT__NULL foo;
+			return &foo;
+		}
+
+		template<typename OtherType>
+		bool
+		operator==(const SmartPtrView<OtherType>& s) const
+		{
+			return ptr==s.getPtr();
+		}
+
+		template<typename OtherType>
+		bool
+		operator!=(const SmartPtrView<OtherType>& s) const
+		{
+			return ptr!=s.getPtr();
+		}
+
+		T*
+		getPtr() const
+		{
+			return ptr;
+		}
+
+		/**
+		 * @brief Owning SmartPtr to the same object (NULL if the view is
+		 * NULL)
+		 */
+		SmartPtr<T>
+		toSmartPtr() const
+		{
+			return ptr != NULL ? SmartPtr<T>(ptr) : SmartPtr<T>();
+		}
+
+	private:
+		T* ptr;
+	};
+
 	template <typename T, typename P>
 	T*
 	dynamicCast(P* p)
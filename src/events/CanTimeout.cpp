@@ -28,6 +28,7 @@
 
 #include <WNS/simulator/ISimulator.hpp>
 #include <WNS/events/scheduler/Interface.hpp>
+#include <WNS/events/TimingWheel.hpp>
 
 #include <WNS/events/CanTimeout.hpp>
 #include <WNS/Assure.hpp>
@@ -36,7 +37,8 @@ using namespace wns::events;
 
 CanTimeout::CanTimeout() :
     event(),
-    scheduler(wns::simulator::getEventScheduler())
+    scheduler(wns::simulator::getEventScheduler()),
+    wheel(wns::simulator::getTimingWheel())
 {
 }
 
@@ -56,8 +58,15 @@ CanTimeout::setTimeout(double delay)
     assure(!this->hasTimeoutSet(), "A timer has been set already.");
 
     TimeoutEvent toEvent(this);
-    this->event =
-        this->scheduler->scheduleDelay(toEvent, delay);
+    if (this->wheel != NULL)
+    {
+        this->event = this->wheel->arm(toEvent, delay);
+    }
+    else
+    {
+        this->event =
+            this->scheduler->scheduleDelayHandle(toEvent, delay);
+    }
 }
 
 
@@ -76,8 +85,16 @@ CanTimeout::setNewTimeout(double delay)
 bool
 CanTimeout::hasTimeoutSet() const
 {
-    // will be automatically converted bool
-    return this->event;
+    // the handle becomes stale if the scheduler has been reset
+    if (!this->event.isValid())
+    {
+        return false;
+    }
+    if (this->wheel != NULL)
+    {
+        return this->wheel->isArmed(this->event);
+    }
+    return this->scheduler->isQueued(this->event);
 }
 
 
@@ -86,8 +103,15 @@ CanTimeout::cancelTimeout()
 {
     assure(this->hasTimeoutSet(), "No timer has been set.");
 
-    this->scheduler->cancelEvent(this->event);
-    this->event = scheduler::IEventPtr();
+    if (this->wheel != NULL)
+    {
+        this->wheel->cancel(this->event);
+    }
+    else
+    {
+        this->scheduler->cancelEvent(this->event);
+    }
+    this->event = scheduler::EventHandle();
 }
 
 
@@ -108,7 +132,7 @@ CanTimeout::TimeoutEvent::operator()()
 {
     assure(this->target, "target not valid (NULL)");
 
-    this->target->event = scheduler::IEventPtr();
+    this->target->event = scheduler::EventHandle();
     this->target->onTimeout();
 }
 
@@ -29,6 +29,7 @@
 #define WNS_EVENTS_CANTIMEOUT_HPP
 
 #include <WNS/events/scheduler/IEvent.hpp>
+#include <WNS/events/scheduler/EventHandle.hpp>
 
 
 namespace wns { namespace events {
@@ -38,11 +39,15 @@ namespace wns { namespace events {
         class Interface;
     }
 
+    class TimingWheel;
+
     /**
      * @brief Mixin to support classes that need a simple timeout mechanism.
      *
      * To make use of this class, simply derive from it and overload the
      * onTimeout method.
+     *
+     * Uses the TimingWheel of the simulator, if one is configured.
      */
     class CanTimeout
     {
@@ -153,14 +158,20 @@ namespace wns { namespace events {
         /**
          * @brief The current active Event
          *
-         * NULL if no timer is active
+         * Invalid if no timer is active. A plain handle avoids the reference
+         * counted event object for the (frequent) timer restarts.
          */
-        scheduler::IEventPtr event;
+        scheduler::EventHandle event;
 
         /**
          * @brief Have scheduler at hand
          */
         wns::events::scheduler::Interface* scheduler;
+
+        /**
+         * @brief Used instead of the scheduler if not NULL
+         */
+        wns::events::TimingWheel* wheel;
     }; // CanTimeout
 
 } // events
@@ -28,10 +28,11 @@
 #ifndef WNS_EVENTS_MULTIPLETIMEOUT_HPP
 #define WNS_EVENTS_MULTIPLETIMEOUT_HPP
 
-#include <WNS/events/scheduler/IEvent.hpp>
+#include <WNS/events/scheduler/EventHandle.hpp>
 
 #include <WNS/simulator/ISimulator.hpp>
 #include <WNS/events/scheduler/Interface.hpp>
+#include <WNS/events/TimingWheel.hpp>
 
 #include <WNS/Assure.hpp>
 
@@ -45,12 +46,14 @@ namespace wns { namespace events {
      *
      * To make use of this class, simply derive from it and overload the
      * onTimeout(const T& t) method.
+     *
+     * Uses the TimingWheel of the simulator, if one is configured.
      */
     template <typename T>
     class MultipleTimeout
     {
         typedef MultipleTimeout<T> MultipleTimeoutConcretion;
-        typedef std::map<T, wns::events::scheduler::IEventPtr> EventMap;
+        typedef std::map<T, wns::events::scheduler::EventHandle> EventMap;
 
         friend class TimeoutEvent;
 
@@ -87,7 +90,8 @@ namespace wns { namespace events {
 
     public:
         MultipleTimeout() :
-            events()
+            events(),
+            wheel(wns::simulator::getTimingWheel())
         {
         } // MultipleTimeout
 
@@ -113,7 +117,15 @@ namespace wns { namespace events {
         {
             assure(!hasTimeoutSet(t), "A timer for this object instance has been set already.");
             TimeoutEvent toEvent = TimeoutEvent(this, t);
-            scheduler::IEventPtr ev = wns::simulator::getEventScheduler()->scheduleDelay(toEvent, delay);
+            scheduler::EventHandle ev;
+            if (wheel != NULL)
+            {
+                ev = wheel->arm(toEvent, delay);
+            }
+            else
+            {
+                ev = wns::simulator::getEventScheduler()->scheduleDelayHandle(toEvent, delay);
+            }
             events.insert(std::make_pair(t, ev));
         } // setTimeout
 
@@ -169,7 +181,7 @@ namespace wns { namespace events {
 
             typename EventMap::iterator evIt = events.find(t);
             assure(evIt != events.end(), "Event does not exist in MultipleTimeout event list.");
-            wns::simulator::getEventScheduler()->cancelEvent(evIt->second);
+            cancelEvent(evIt->second);
             events.erase(evIt);
         } // cancelTimeout
 
@@ -181,7 +193,7 @@ namespace wns { namespace events {
         {
             while(!events.empty())
             {
-                wns::simulator::getEventScheduler()->cancelEvent(events.begin()->second);
+                cancelEvent(events.begin()->second);
                 events.erase(events.begin());
             }
         } // cancelAllTimeouts
@@ -196,7 +208,33 @@ namespace wns { namespace events {
         onTimeout(const T& t) = 0;
 
     private:
+        /**
+         * @brief Cancel the event unless it is gone already (e.g. after a
+         * reset of the scheduler)
+         */
+        void
+        cancelEvent(const scheduler::EventHandle& ev)
+        {
+            if (wheel != NULL)
+            {
+                if (wheel->isArmed(ev))
+                {
+                    wheel->cancel(ev);
+                }
+            }
+            else
+            {
+                scheduler::Interface* es = wns::simulator::getEventScheduler();
+                if (es->isQueued(ev))
+                {
+                    es->cancelEvent(ev);
+                }
+            }
+        }
+
         EventMap events;
+
+        TimingWheel* wheel;
     };
 
 } // events
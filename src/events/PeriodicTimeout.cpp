@@ -28,6 +28,7 @@
 
 #include <WNS/simulator/ISimulator.hpp>
 #include <WNS/events/scheduler/Interface.hpp>
+#include <WNS/events/TimingWheel.hpp>
 
 #include <WNS/events/PeriodicTimeout.hpp>
 
@@ -43,8 +44,7 @@ PeriodicTimeout::PeriodicTimeoutFunctor::PeriodicTimeoutFunctor(PeriodicTimeout*
 void
 PeriodicTimeout::PeriodicTimeoutFunctor::operator()()
 {
-    this->dest_->periodicEv_ =
-        wns::simulator::getEventScheduler()->scheduleDelay(*this, this->period_);
+    this->dest_->schedule(*this, this->period_);
     this->dest_->periodically();
 }
 
@@ -66,7 +66,9 @@ PeriodicTimeout::PeriodicTimeoutFunctor::print(std::ostream& aStreamRef) const
 
 PeriodicTimeout::PeriodicTimeout() :
     period_(-1),
-    periodicEv_(scheduler::IEventPtr())
+    periodicEv_(),
+    nextTimeout_(0.0),
+    wheel_(wns::simulator::getTimingWheel())
 {
 }
 
@@ -82,12 +84,14 @@ PeriodicTimeout::~PeriodicTimeout()
 
 PeriodicTimeout::PeriodicTimeout(const PeriodicTimeout& other) :
     period_(other.period_),
-    periodicEv_(scheduler::IEventPtr())
+    periodicEv_(),
+    nextTimeout_(0.0),
+    wheel_(other.wheel_)
 {
     if(other.hasPeriodicTimeoutSet())
     {
         this->startPeriodicTimeout(other.period_,
-                       other.periodicEv_->getScheduled() - wns::simulator::getEventScheduler()->getTime());
+                       other.nextTimeout_ - wns::simulator::getEventScheduler()->getTime());
 
         assure(this->periodicEv_ != other.periodicEv_,
                "PeriodicTimeout(const PeriodicTimeout& other): "
@@ -110,15 +114,23 @@ PeriodicTimeout::startPeriodicTimeout(wns::simulator::Time _period, wns::simulat
 
     this->period_ = _period;
 
-    this->periodicEv_ = wns::simulator::getEventScheduler()->
-        scheduleDelay(PeriodicTimeoutFunctor(this, this->period_), delay);
+    this->schedule(PeriodicTimeoutFunctor(this, this->period_), delay);
 }
 
 
 bool
 PeriodicTimeout::hasPeriodicTimeoutSet() const
 {
-    return this->periodicEv_ != NULL;
+    // the handle becomes stale if the scheduler has been reset
+    if (!this->periodicEv_.isValid())
+    {
+        return false;
+    }
+    if (this->wheel_ != NULL)
+    {
+        return this->wheel_->isArmed(this->periodicEv_);
+    }
+    return wns::simulator::getEventScheduler()->isQueued(this->periodicEv_);
 }
 
 
@@ -129,10 +141,32 @@ PeriodicTimeout::cancelPeriodicTimeout()
     {
         return;
     }
-    wns::simulator::getEventScheduler()->cancelEvent(this->periodicEv_);
-    this->periodicEv_ = scheduler::IEventPtr();
+    if (this->wheel_ != NULL)
+    {
+        this->wheel_->cancel(this->periodicEv_);
+    }
+    else
+    {
+        wns::simulator::getEventScheduler()->cancelEvent(this->periodicEv_);
+    }
+    this->periodicEv_ = scheduler::EventHandle();
 
     // invalidate period
     this->period_ = -1;
 }
 
+
+
+void
+PeriodicTimeout::schedule(const PeriodicTimeoutFunctor& functor, wns::simulator::Time delay)
+{
+    if (this->wheel_ != NULL)
+    {
+        this->periodicEv_ = this->wheel_->arm(functor, delay);
+    }
+    else
+    {
+        this->periodicEv_ = wns::simulator::getEventScheduler()->scheduleDelayHandle(functor, delay);
+    }
+    this->nextTimeout_ = wns::simulator::getEventScheduler()->getTime() + delay;
+}
@@ -30,16 +30,19 @@
 
 #include <WNS/Assure.hpp>
 #include <WNS/simulator/Time.hpp>
-#include <WNS/events/scheduler/IEvent.hpp>
+#include <WNS/events/scheduler/EventHandle.hpp>
 
 namespace wns { namespace events {
 
+    class TimingWheel;
+
     /**
      * @brief Mixin to support classes that need a periodic timeout mechanism.
      *
      * To make use of this class, simply derive from it and overload the
      * periodically() method.
      *
+     * Uses the TimingWheel of the simulator, if one is configured.
      */
     class PeriodicTimeout
     {
@@ -131,8 +134,16 @@ namespace wns { namespace events {
         periodically() = 0;
 
     private:
+        /**
+         * @brief Schedule the next timeout
+         */
+        void
+        schedule(const PeriodicTimeoutFunctor& functor, wns::simulator::Time delay);
+
         wns::simulator::Time period_;
-        scheduler::IEventPtr periodicEv_;
+        scheduler::EventHandle periodicEv_;
+        wns::simulator::Time nextTimeout_;
+        TimingWheel* wheel_;
 
         const PeriodicTimeout& operator=(const PeriodicTimeout& other);
     }; // PeriodicTimeout
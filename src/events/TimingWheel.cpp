@@ -0,0 +1,404 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/events/TimingWheel.hpp>
+#include <WNS/events/scheduler/Interface.hpp>
+#include <WNS/Assure.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace wns::events;
+
+TimingWheel::TimingWheel(scheduler::Interface* scheduler, wns::simulator::Time resolution) :
+    scheduler_(scheduler),
+    resolution_(resolution),
+    store_(),
+    promoted_(),
+    now_(0),
+    queued_(0),
+    tickEvent_(),
+    scheduledTick_(never),
+    ticking_(false),
+    promotions_(0)
+{
+    assureNotNull(scheduler_);
+    assure(resolution_ > 0.0, "The resolution of the timing wheel must be > 0");
+    std::memset(occupied_, 0, sizeof(occupied_));
+    now_ = toTick(scheduler_->getTime());
+}
+
+TimingWheel::~TimingWheel()
+{
+    reset();
+}
+
+scheduler::EventHandle
+TimingWheel::arm(const scheduler::Callable& callable, wns::simulator::Time delay)
+{
+    assure(delay >= 0.0, "Timers can't be armed for the past");
+    checkScheduler();
+
+    wns::simulator::Time now = scheduler_->getTime();
+    Index index = store_.allocate(callable,
+                                  wns::simulator::toTick(now + delay),
+                                  wns::simulator::toTick(now));
+    store_.get(index).key = toTick(now + delay);
+
+    if (advance(toTick(now)))
+    {
+        insert(index);
+        updateTick();
+    }
+    else
+    {
+        Tick tick = insert(index);
+        if (tick < scheduledTick_)
+        {
+            scheduleTick(tick);
+        }
+    }
+    return store_.getHandle(index);
+}
+
+void
+TimingWheel::cancel(const scheduler::EventHandle& handle)
+{
+    assure(isArmed(handle), "Timer is not armed");
+
+    Index index = store_.getIndex(handle);
+    if (store_.get(index).list != NULL)
+    {
+        unlink(index);
+        if (queued_ == 0)
+        {
+            // don't keep the simulation running for nothing
+            cancelTick();
+        }
+    }
+    else
+    {
+        scheduler_->cancelEvent(promoted_[index]);
+        promoted_[index] = scheduler::EventHandle();
+    }
+    store_.release(index, scheduler::EventStore::Event::Canceled);
+}
+
+bool
+TimingWheel::isArmed(const scheduler::EventHandle& handle) const
+{
+    return store_.isValid(handle) &&
+        store_.get(store_.getIndex(handle)).state == scheduler::EventStore::Slot::Queued;
+}
+
+wns::simulator::Time
+TimingWheel::getExpiry(const scheduler::EventHandle& handle) const
+{
+    assure(isArmed(handle), "Timer is not armed");
+    return wns::simulator::fromTick(store_.get(store_.getIndex(handle)).scheduled);
+}
+
+size_t
+TimingWheel::size() const
+{
+    return store_.size();
+}
+
+void
+TimingWheel::reset()
+{
+    cancelTick();
+    for (std::vector<scheduler::EventHandle>::iterator itr = promoted_.begin(); itr != promoted_.end(); ++itr)
+    {
+        if (itr->isValid() && scheduler_->isQueued(*itr))
+        {
+            scheduler_->cancelEvent(*itr);
+        }
+    }
+    promoted_.clear();
+
+    for (int level = 0; level < numberOfLevels; ++level)
+    {
+        for (int slot = 0; slot < numberOfSlots; ++slot)
+        {
+            slots_[level][slot] = scheduler::EventStore::List();
+        }
+    }
+    std::memset(occupied_, 0, sizeof(occupied_));
+    store_.clear();
+    queued_ = 0;
+    now_ = toTick(scheduler_->getTime());
+}
+
+TimingWheel::Tick
+TimingWheel::toTick(wns::simulator::Time time) const
+{
+    assure(time >= 0.0, "Negative time");
+    wns::simulator::Time tick = std::floor(time / resolution_);
+    assure(tick < 9.2e18, "Time out of range of the timing wheel");
+    return static_cast<Tick>(tick);
+}
+
+TimingWheel::Tick
+TimingWheel::insert(Index index)
+{
+    scheduler::EventStore::Slot& slot = store_.get(index);
+    Tick expiry = static_cast<Tick>(slot.key);
+
+    if (expiry <= now_)
+    {
+        promote(index);
+        return never;
+    }
+
+    Tick delta = expiry - now_;
+    int level = (63 - __builtin_clzll(delta)) / bits;
+    Tick position = (expiry >> (bits * level)) & slotMask;
+
+    store_.pushBack(slots_[level][position], index);
+    occupied_[level][position / 64] |= uint64_t(1) << (position % 64);
+    ++queued_;
+
+    return getSlotTick(level, position);
+}
+
+void
+TimingWheel::promote(Index index)
+{
+    scheduler::EventStore::Slot& slot = store_.get(index);
+    if (promoted_.size() <= index)
+    {
+        promoted_.resize(std::max(static_cast<size_t>(index) + 1, 2 * promoted_.size()));
+    }
+    promoted_[index] = scheduler_->scheduleHandle(
+        Fire(this, index, slot.generation),
+        std::max(wns::simulator::fromTick(slot.scheduled), scheduler_->getTime()));
+    ++promotions_;
+}
+
+void
+TimingWheel::fire(Index index, uint32_t generation)
+{
+    scheduler::EventStore::Slot& slot = store_.get(index);
+    assure(slot.generation == generation && slot.state == scheduler::EventStore::Slot::Queued,
+           "Promoted timer is not armed anymore");
+
+    promoted_[index] = scheduler::EventHandle();
+    store_.setRunning(index);
+    slot.callable();
+    store_.release(index, scheduler::EventStore::Event::Finished);
+}
+
+void
+TimingWheel::onTick(Tick tick)
+{
+    tickEvent_ = scheduler::EventHandle();
+    scheduledTick_ = never;
+
+    ticking_ = true;
+    advance(tick);
+    ticking_ = false;
+
+    updateTick();
+}
+
+bool
+TimingWheel::advance(Tick tick)
+{
+    // the tick event is never later than the next non-empty slot
+    if (queued_ == 0 || (!ticking_ && scheduledTick_ > tick))
+    {
+        now_ = std::max(now_, tick);
+        return false;
+    }
+
+    bool processed = false;
+    for (Tick next = getNextTick(); next <= tick; next = getNextTick())
+    {
+        processTick(next);
+        processed = true;
+    }
+    now_ = std::max(now_, tick);
+    return processed;
+}
+
+void
+TimingWheel::processTick(Tick tick)
+{
+    now_ = tick;
+
+    // higher levels first, their timers may end up in lower levels of the
+    // same tick
+    for (int level = numberOfLevels - 1; level > 0; --level)
+    {
+        if ((tick & ((Tick(1) << (bits * level)) - 1)) == 0)
+        {
+            cascade(level, (tick >> (bits * level)) & slotMask);
+        }
+    }
+    cascade(0, tick & slotMask);
+}
+
+void
+TimingWheel::cascade(int level, Tick position)
+{
+    scheduler::EventStore::List& list = slots_[level][position];
+    while (!list.empty())
+    {
+        Index index = list.first;
+        unlink(index);
+        insert(index);
+        assure(store_.get(index).list != &list, "Timer cascaded into the same slot");
+    }
+}
+
+void
+TimingWheel::unlink(Index index)
+{
+    scheduler::EventStore::List* list = store_.get(index).list;
+    store_.unlink(index);
+    --queued_;
+
+    if (list->empty())
+    {
+        ptrdiff_t offset = list - &slots_[0][0];
+        int level = offset / numberOfSlots;
+        int position = offset % numberOfSlots;
+        occupied_[level][position / 64] &= ~(uint64_t(1) << (position % 64));
+    }
+}
+
+TimingWheel::Tick
+TimingWheel::getNextTick() const
+{
+    if (queued_ == 0)
+    {
+        return never;
+    }
+
+    Tick next = never;
+    for (int level = 0; level < numberOfLevels; ++level)
+    {
+        Tick base = now_ >> (bits * level);
+        int from = (base + 1) & slotMask;
+        int distance = findNextSlot(level, from);
+        if (distance >= 0)
+        {
+            next = std::min(next, getSlotTick(level, (from + distance) & slotMask));
+        }
+    }
+    return next;
+}
+
+TimingWheel::Tick
+TimingWheel::getSlotTick(int level, Tick position) const
+{
+    Tick base = now_ >> (bits * level);
+    // the slot of the current base has been processed already
+    Tick distance = ((position - base - 1) & slotMask) + 1;
+
+    if (level > 0 && (base + distance) > (never >> (bits * level)))
+    {
+        return never;
+    }
+    return (base + distance) << (bits * level);
+}
+
+int
+TimingWheel::findNextSlot(int level, int from) const
+{
+    // search [from, numberOfSlots), then [0, from)
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        int begin = (pass == 0) ? from : 0;
+        int end = (pass == 0) ? numberOfSlots : from;
+        for (int word = begin / 64; word * 64 < end; ++word)
+        {
+            uint64_t bitmap = occupied_[level][word];
+            if (word == begin / 64)
+            {
+                bitmap &= ~uint64_t(0) << (begin % 64);
+            }
+            if (bitmap != 0)
+            {
+                int position = word * 64 + __builtin_ctzll(bitmap);
+                if (position < end)
+                {
+                    return (position - from) & slotMask;
+                }
+            }
+        }
+    }
+    return -1;
+}
+
+void
+TimingWheel::scheduleTick(Tick tick)
+{
+    cancelTick();
+    wns::simulator::Time at = std::max(tick * resolution_, scheduler_->getTime());
+    tickEvent_ = scheduler_->scheduleHandle(TickEvent(this, tick), at);
+    scheduledTick_ = tick;
+}
+
+void
+TimingWheel::cancelTick()
+{
+    if (tickEvent_.isValid() && scheduler_->isQueued(tickEvent_))
+    {
+        scheduler_->cancelEvent(tickEvent_);
+    }
+    tickEvent_ = scheduler::EventHandle();
+    scheduledTick_ = never;
+}
+
+void
+TimingWheel::updateTick()
+{
+    Tick next = getNextTick();
+    if (next == never)
+    {
+        cancelTick();
+    }
+    else if (next != scheduledTick_)
+    {
+        scheduleTick(next);
+    }
+}
+
+void
+TimingWheel::checkScheduler()
+{
+    // the scheduler has been reset if its time went backwards or our tick
+    // event has gone
+    if (scheduler_->getTime() < now_ * resolution_ - resolution_ ||
+        (!ticking_ && tickEvent_.isValid() && !scheduler_->isQueued(tickEvent_)))
+    {
+        reset();
+    }
+}
@@ -0,0 +1,314 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_EVENTS_TIMINGWHEEL_HPP
+#define WNS_EVENTS_TIMINGWHEEL_HPP
+
+#include <WNS/events/scheduler/EventStore.hpp>
+#include <WNS/events/scheduler/EventHandle.hpp>
+#include <WNS/events/scheduler/Callable.hpp>
+#include <WNS/simulator/Time.hpp>
+#include <WNS/NonCopyable.hpp>
+
+#include <vector>
+
+namespace wns { namespace events {
+
+    namespace scheduler
+    {
+        class Interface;
+    }
+
+    /**
+     * @brief Hierarchical timing wheel for timeouts that are mostly canceled
+     * before they expire
+     *
+     * Timers are kept in buckets of 8 levels with 256 slots each. Level 0
+     * has one slot per tick ("resolution" seconds), each slot of level l
+     * covers 256^l ticks. Arming and canceling a timer are O(1) and do not
+     * touch the event scheduler. When the tick of a slot of a higher level
+     * is reached, its timers are moved down (cascaded). When the tick of a
+     * level 0 slot is reached, its timers are scheduled in the event
+     * scheduler at their exact expiry time (promoted).
+     *
+     * Thus the only events the wheel adds to the scheduler are the timers
+     * that (almost) expire plus one tick event. The tick event is only
+     * scheduled for ticks at which something needs to be done, empty ticks
+     * are skipped.
+     *
+     * Timers fire at exactly the same time as if they were scheduled
+     * directly. Only the order of events scheduled for exactly the same
+     * point in time may differ, since a timer enters the scheduler when it
+     * is promoted, not when it is armed.
+     *
+     * If configured (WNS.environment.timingWheel), CanTimeout,
+     * MultipleTimeout and PeriodicTimeout use the wheel of the simulator
+     * (wns::simulator::getTimingWheel()).
+     */
+    class TimingWheel :
+        private NonCopyable
+    {
+    public:
+        TimingWheel(scheduler::Interface* scheduler, wns::simulator::Time resolution);
+
+        /**
+         * @brief Cancels all timers
+         */
+        ~TimingWheel();
+
+        /**
+         * @brief Call callable after delay seconds
+         */
+        scheduler::EventHandle
+        arm(const scheduler::Callable& callable, wns::simulator::Time delay);
+
+        /**
+         * @brief Cancel an armed timer
+         */
+        void
+        cancel(const scheduler::EventHandle& handle);
+
+        /**
+         * @brief True if the timer has neither fired nor been canceled
+         */
+        bool
+        isArmed(const scheduler::EventHandle& handle) const;
+
+        /**
+         * @brief Expiry time of an armed timer
+         */
+        wns::simulator::Time
+        getExpiry(const scheduler::EventHandle& handle) const;
+
+        /**
+         * @brief Number of armed timers
+         */
+        size_t
+        size() const;
+
+        wns::simulator::Time
+        getResolution() const
+        {
+            return resolution_;
+        }
+
+        /**
+         * @brief Number of timers that have been scheduled in the event
+         * scheduler so far
+         */
+        unsigned long int
+        getPromotions() const
+        {
+            return promotions_;
+        }
+
+        /**
+         * @brief Drop all timers (e.g. after the event scheduler has been
+         * reset)
+         */
+        void
+        reset();
+
+    private:
+        typedef uint64_t Tick;
+
+        typedef scheduler::EventStore::Index Index;
+
+        static const int bits = 8;
+
+        static const int numberOfSlots = 1 << bits;
+
+        static const Tick slotMask = numberOfSlots - 1;
+
+        static const int numberOfLevels = 8;
+
+        static const int wordsPerLevel = numberOfSlots / 64;
+
+        static const Tick never = ~Tick(0);
+
+        /**
+         * @brief Event for a promoted timer
+         */
+        class Fire
+        {
+        public:
+            Fire(TimingWheel* wheel, Index index, uint32_t generation) :
+                wheel_(wheel),
+                index_(index),
+                generation_(generation)
+            {
+            }
+
+            void
+            operator()()
+            {
+                wheel_->fire(index_, generation_);
+            }
+
+        private:
+            TimingWheel* wheel_;
+            Index index_;
+            uint32_t generation_;
+        };
+
+        /**
+         * @brief Event for the next tick that needs processing
+         */
+        class TickEvent
+        {
+        public:
+            TickEvent(TimingWheel* wheel, Tick tick) :
+                wheel_(wheel),
+                tick_(tick)
+            {
+            }
+
+            void
+            operator()()
+            {
+                wheel_->onTick(tick_);
+            }
+
+        private:
+            TimingWheel* wheel_;
+            Tick tick_;
+        };
+
+        Tick
+        toTick(wns::simulator::Time time) const;
+
+        /**
+         * @brief Put the timer into its slot relative to now_ (or promote
+         * it if it is due)
+         *
+         * @return The tick at which the slot will be processed (never if
+         * the timer has been promoted)
+         */
+        Tick
+        insert(Index index);
+
+        void
+        promote(Index index);
+
+        void
+        fire(Index index, uint32_t generation);
+
+        void
+        onTick(Tick tick);
+
+        /**
+         * @brief Process all ticks up to (and including) tick
+         *
+         * @return true if a tick has been processed
+         */
+        bool
+        advance(Tick tick);
+
+        void
+        processTick(Tick tick);
+
+        /**
+         * @brief Re-insert all timers of a slot
+         */
+        void
+        cascade(int level, Tick slot);
+
+        void
+        unlink(Index index);
+
+        /**
+         * @brief Next tick at which a non-empty slot needs processing
+         */
+        Tick
+        getNextTick() const;
+
+        /**
+         * @brief Next tick at which the given slot is processed
+         */
+        Tick
+        getSlotTick(int level, Tick slot) const;
+
+        /**
+         * @brief Distance from "from" to the next non-empty slot, -1 if the
+         * level is empty
+         */
+        int
+        findNextSlot(int level, int from) const;
+
+        void
+        scheduleTick(Tick tick);
+
+        void
+        cancelTick();
+
+        void
+        updateTick();
+
+        /**
+         * @brief Detect a reset of the scheduler
+         */
+        void
+        checkScheduler();
+
+        scheduler::Interface* scheduler_;
+
+        wns::simulator::Time resolution_;
+
+        scheduler::EventStore store_;
+
+        scheduler::EventStore::List slots_[numberOfLevels][numberOfSlots];
+
+        uint64_t occupied_[numberOfLevels][wordsPerLevel];
+
+        /**
+         * @brief Scheduler event of a promoted timer, indexed by slot
+         */
+        std::vector<scheduler::EventHandle> promoted_;
+
+        /**
+         * @brief All ticks up to now_ have been processed
+         */
+        Tick now_;
+
+        /**
+         * @brief Number of timers in slots (not promoted)
+         */
+        size_t queued_;
+
+        scheduler::EventHandle tickEvent_;
+
+        Tick scheduledTick_;
+
+        bool ticking_;
+
+        unsigned long int promotions_;
+    };
+
+} // events
+} // wns
+
+#endif // NOT defined WNS_EVENTS_TIMINGWHEEL_HPP
@@ -0,0 +1,466 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/events/scheduler/Calendar.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace wns::events::scheduler;
+
+STATIC_FACTORY_REGISTER(
+    Calendar,
+    Interface,
+    "wns.events.scheduler.Calendar");
+
+namespace {
+    // a calendar never has less buckets than this
+    const size_t minimumNumberOfBuckets = 2;
+
+    // number of events used to estimate the bucket width
+    const size_t widthSampleSize = 25;
+}
+
+Calendar::Calendar() :
+    Interface(),
+    Subject<INotification>(),
+    simTime_(0),
+    store_(),
+    buckets_(minimumNumberOfBuckets),
+    width_(static_cast<double>(wns::simulator::ticksPerSecond)),
+    currentDay_(0),
+    size_(0),
+    stop_(false),
+    commandQueue_()
+{
+}
+
+Calendar::~Calendar()
+{
+}
+
+wns::events::scheduler::IEventPtr
+Calendar::doScheduleNow(const Callable& callable)
+{
+    return store_.getEvent(enqueue(callable, simTime_), this);
+}
+
+wns::events::scheduler::IEventPtr
+Calendar::doSchedule(const Callable& callable, wns::simulator::Time at)
+{
+    return store_.getEvent(enqueue(callable, wns::simulator::toTick(at)), this);
+}
+
+wns::events::scheduler::EventHandle
+Calendar::doScheduleNowHandle(const Callable& callable)
+{
+    return store_.getHandle(enqueue(callable, simTime_));
+}
+
+wns::events::scheduler::EventHandle
+Calendar::doScheduleHandle(const Callable& callable, wns::simulator::Time at)
+{
+    return store_.getHandle(enqueue(callable, wns::simulator::toTick(at)));
+}
+
+void
+Calendar::doCancelEvent(const IEventPtr& event)
+{
+    EventStore::EventPtr storeEvent (dynamicCast<EventStore::Event>(event));
+    assureNotNull(storeEvent);
+    if (store_.prepareCancel(storeEvent))
+    {
+        doCancelEvent(storeEvent->getHandle());
+    }
+}
+
+void
+Calendar::doCancelEvent(const EventHandle& handle)
+{
+    if (!store_.isValid(handle))
+    {
+        throw IEvent::CancelException("Event is not queued");
+    }
+
+    EventStore::Index index = store_.getIndex(handle);
+    if (store_.get(index).state == EventStore::Slot::Running)
+    {
+        throw IEvent::CancelException("Event is currently being executed");
+    }
+
+    unlink(index);
+    store_.release(index, EventStore::Event::Canceled);
+}
+
+bool
+Calendar::doIsQueued(const EventHandle& handle) const
+{
+    return store_.isValid(handle) &&
+        store_.get(store_.getIndex(handle)).state == EventStore::Slot::Queued;
+}
+
+bool
+Calendar::doProcessOneEvent()
+{
+    commandQueue_.runCommands();
+
+    EventStore::Index next = peek();
+
+    if (next == EventStore::npos)
+    {
+        // No more events left!
+        return false;
+    }
+
+    // slots don't move in memory, not even if the calendar is resized
+    EventStore::Slot& nextEvent = store_.get(next);
+
+    wns::simulator::Tick newTime = nextEvent.scheduled;
+
+    // run until all now events are processed
+    if (simTime_ < newTime && stop_)
+    {
+        return false;
+    }
+
+    simTime_ = newTime;
+
+    // the slot stays allocated until the event has been executed
+    unlink(next);
+
+    store_.setRunning(next);
+    sendEventStartedNotification(nextEvent.callable);
+    nextEvent.callable();
+    sendEventFinishedNotification(nextEvent.callable);
+    store_.release(next, EventStore::Event::Finished);
+
+    return true;
+}
+
+void
+Calendar::doReset()
+{
+    store_.clear();
+    buckets_.assign(minimumNumberOfBuckets, Bucket());
+    width_ = static_cast<double>(wns::simulator::ticksPerSecond);
+    currentDay_ = 0;
+    size_ = 0;
+    simTime_ = 0;
+    commandQueue_.reset();
+}
+
+size_t
+Calendar::doSize() const
+{
+    return store_.size();
+}
+
+EventStore::Index
+Calendar::enqueue(const Callable& callable, wns::simulator::Tick at)
+{
+    EventStore::Index index = store_.allocate(callable, at, simTime_);
+    insert(index);
+
+    if (size_ > 2 * buckets_.size())
+    {
+        resize(2 * buckets_.size());
+    }
+    return index;
+}
+
+void
+Calendar::insert(EventStore::Index index)
+{
+    EventStore::Slot& event = store_.get(index);
+    event.key = dayOf(event.scheduled);
+
+    // an event before the current day restarts the search from there
+    if (event.key < currentDay_)
+    {
+        currentDay_ = event.key;
+    }
+
+    Bucket& bucket = buckets_[bucketOf(event.key)];
+
+    // most events are appended, thus search from the end. Events with equal
+    // time are kept in FIFO order.
+    EventStore::Index position = bucket.last;
+    while (position != EventStore::npos &&
+           event.scheduled < store_.get(position).scheduled)
+    {
+        position = store_.get(position).previous;
+    }
+
+    store_.insertAfter(bucket, position, index);
+    ++size_;
+}
+
+void
+Calendar::unlink(EventStore::Index index)
+{
+    store_.unlink(index);
+    --size_;
+
+    if (buckets_.size() > minimumNumberOfBuckets &&
+        size_ + 2 < buckets_.size() / 2)
+    {
+        resize(buckets_.size() / 2);
+    }
+}
+
+EventStore::Index
+Calendar::peek()
+{
+    if (size_ == 0)
+    {
+        return EventStore::npos;
+    }
+
+    // search one year starting from the current day
+    for (size_t ii = 0; ii < buckets_.size(); ++ii)
+    {
+        const Bucket& bucket = buckets_[bucketOf(currentDay_)];
+        if (!bucket.empty() && store_.get(bucket.first).key <= currentDay_)
+        {
+            return bucket.first;
+        }
+        ++currentDay_;
+    }
+
+    // nothing within one year, fall back to a direct search
+    EventStore::Index earliest = EventStore::npos;
+    for (BucketContainer::const_iterator itr = buckets_.begin();
+         itr != buckets_.end();
+         ++itr)
+    {
+        if (!itr->empty() &&
+            (earliest == EventStore::npos ||
+             store_.get(itr->first).scheduled < store_.get(earliest).scheduled))
+        {
+            earliest = itr->first;
+        }
+    }
+    assure(earliest != EventStore::npos, "There MUST be events!");
+
+    currentDay_ = store_.get(earliest).key;
+    return earliest;
+}
+
+void
+Calendar::resize(size_t numberOfBuckets)
+{
+    double width = estimateWidth();
+
+    // detach all events in bucket order. Events with equal time reside in
+    // the same bucket, thus re-inserting them in this order keeps FIFO order.
+    std::vector<EventStore::Index> events;
+    events.reserve(size_);
+    for (BucketContainer::iterator itr = buckets_.begin();
+         itr != buckets_.end();
+         ++itr)
+    {
+        while (!itr->empty())
+        {
+            events.push_back(itr->first);
+            store_.unlink(itr->first);
+        }
+    }
+
+    buckets_.assign(numberOfBuckets, Bucket());
+    width_ = width;
+    currentDay_ = dayOf(simTime_);
+    size_ = 0;
+
+    for (std::vector<EventStore::Index>::const_iterator itr = events.begin();
+         itr != events.end();
+         ++itr)
+    {
+        insert(*itr);
+    }
+}
+
+double
+Calendar::estimateWidth() const
+{
+    std::vector<wns::simulator::Tick> times;
+    times.reserve(size_);
+    for (BucketContainer::const_iterator itr = buckets_.begin();
+         itr != buckets_.end();
+         ++itr)
+    {
+        for (EventStore::Index index = itr->first;
+             index != EventStore::npos;
+             index = store_.get(index).next)
+        {
+            times.push_back(store_.get(index).scheduled);
+        }
+    }
+
+    size_t sampleSize = std::min(times.size(), widthSampleSize);
+    if (sampleSize < 2)
+    {
+        return width_;
+    }
+
+    std::partial_sort(times.begin(), times.begin() + sampleSize, times.end());
+
+    // average separation of distinct points in time
+    double sum = 0.0;
+    int count = 0;
+    for (size_t ii = 1; ii < sampleSize; ++ii)
+    {
+        double separation = static_cast<double>(times[ii] - times[ii-1]);
+        if (separation > 0.0)
+        {
+            sum += separation;
+            ++count;
+        }
+    }
+
+    if (count == 0)
+    {
+        return width_;
+    }
+
+    // recalculate the average, ignoring large separations
+    double average = sum / count;
+    sum = 0.0;
+    count = 0;
+    for (size_t ii = 1; ii < sampleSize; ++ii)
+    {
+        double separation = static_cast<double>(times[ii] - times[ii-1]);
+        if (separation > 0.0 && separation <= 2.0 * average)
+        {
+            sum += separation;
+            ++count;
+        }
+    }
+
+    return 3.0 * sum / count;
+}
+
+long long int
+Calendar::dayOf(const wns::simulator::Tick& time) const
+{
+    return static_cast<long long int>(std::floor(static_cast<double>(time) / width_));
+}
+
+size_t
+Calendar::bucketOf(long long int day) const
+{
+    long long int numberOfBuckets = static_cast<long long int>(buckets_.size());
+    long long int bucket = day % numberOfBuckets;
+    if (bucket < 0)
+    {
+        bucket += numberOfBuckets;
+    }
+    return static_cast<size_t>(bucket);
+}
+
+void
+Calendar::sendProcessOneEventNotification()
+{
+    sendNotifies(&INotification::onProcessOneEvent);
+}
+
+void
+Calendar::sendCancelEventNotification()
+{
+    sendNotifies(&INotification::onCancelEvent);
+}
+
+void
+Calendar::sendScheduleNotification()
+{
+    sendNotifies(&INotification::onSchedule);
+}
+
+void
+Calendar::sendScheduleNowNotification()
+{
+    sendNotifies(&INotification::onScheduleNow);
+}
+
+void
+Calendar::sendScheduleDelayNotification()
+{
+    sendNotifies(&INotification::onScheduleDelay);
+}
+
+void
+Calendar::sendAddEventNotification()
+{
+    sendNotifies(&INotification::onAddEvent);
+}
+
+void
+Calendar::sendEventStartedNotification(const Callable& callable)
+{
+    if (hasObservers())
+    {
+        forEachObserver(EventNotification(&INotification::onEventStarted, callable));
+    }
+}
+
+void
+Calendar::sendEventFinishedNotification(const Callable& callable)
+{
+    if (hasObservers())
+    {
+        forEachObserver(EventNotification(&INotification::onEventFinished, callable));
+    }
+}
+
+wns::simulator::Time
+Calendar::doGetTime() const
+{
+    return wns::simulator::fromTick(simTime_);
+}
+
+void
+Calendar::doStart()
+{
+    while(processOneEvent());
+}
+
+void
+Calendar::doStop()
+{
+    stop_ = true;
+}
+
+wns::events::scheduler::ICommandPtr
+Calendar::doQueueCommand(const Callable& callable)
+{
+    return commandQueue_.queueCommand(callable);
+}
+
+void
+Calendar::doDequeueCommand(const ICommandPtr& command)
+{
+    return commandQueue_.dequeueCommand(command);
+}
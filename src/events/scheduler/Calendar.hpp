@@ -0,0 +1,241 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_EVENTS_SCHEDULER_CALENDAR_HPP
+#define WNS_EVENTS_SCHEDULER_CALENDAR_HPP
+
+#include <WNS/events/scheduler/Interface.hpp>
+#include <WNS/events/scheduler/EventStore.hpp>
+#include <WNS/events/scheduler/CommandQueue.hpp>
+#include <WNS/Subject.hpp>
+
+#include <vector>
+
+namespace wns { namespace events { namespace scheduler {
+    /**
+     * @brief Implementation based on a calendar queue (R. Brown, 1988)
+     *
+     * The pending events are hashed by their scheduled time into an array of
+     * buckets ("days"), each covering an interval of width_ seconds. All
+     * buckets together form a "year". Each bucket holds an intrusive,
+     * time-sorted and doubly linked list of events (see EventStore). Events
+     * scheduled for the same point in time are kept in FIFO order.
+     *
+     * The number of buckets is doubled (halved) if the number of pending
+     * events exceeds twice (falls below half) the number of buckets. On each
+     * resize the bucket width is re-estimated from the average separation of
+     * the next events to be processed. Thus, enqueue and dequeue have an
+     * amortized complexity of O(1), cancel is always O(1).
+     *
+     * In contrast to Map no container is allocated per distinct point in time
+     * and no tree needs to be walked to schedule an event.
+     */
+    class Calendar :
+        public Interface,
+        public Subject<INotification>
+    {
+    public:
+
+        // Default constructor
+        Calendar();
+
+        // Destructor
+        virtual
+        ~Calendar();
+
+    protected:
+        /**
+         * @brief A bucket ("day") of the calendar
+         */
+        typedef EventStore::List Bucket;
+
+        typedef std::vector<Bucket> BucketContainer;
+
+        /**
+         * @name NVI implementation
+         */
+        //{@
+        virtual void
+        doReset();
+
+        virtual wns::simulator::Time
+        doGetTime() const;
+
+        virtual void
+        doStop();
+
+        virtual void
+        doStart();
+
+        virtual void
+        doCancelEvent(const IEventPtr& event);
+
+        virtual void
+        doCancelEvent(const EventHandle& handle);
+
+        virtual bool
+        doIsQueued(const EventHandle& handle) const;
+
+        virtual IEventPtr
+        doScheduleNow(const Callable& callable);
+
+        virtual IEventPtr
+        doSchedule(const Callable& callable, wns::simulator::Time at);
+
+        virtual EventHandle
+        doScheduleNowHandle(const Callable& callable);
+
+        virtual EventHandle
+        doScheduleHandle(const Callable& callable, wns::simulator::Time at);
+
+        virtual size_t
+        doSize() const;
+
+        virtual bool
+        doProcessOneEvent();
+
+        virtual ICommandPtr
+        doQueueCommand(const Callable& callable);
+
+        virtual void
+        doDequeueCommand(const ICommandPtr& command);
+        //@}
+
+        /**
+         * @name Scheduler observation
+         */
+        //{@
+        virtual void
+        sendProcessOneEventNotification();
+
+        virtual void
+        sendCancelEventNotification();
+
+        virtual void
+        sendScheduleNotification();
+
+        virtual void
+        sendScheduleDelayNotification();
+
+        virtual void
+        sendScheduleNowNotification();
+
+        virtual void
+        sendAddEventNotification();
+
+        virtual void
+        sendEventStartedNotification(const Callable& callable);
+
+        virtual void
+        sendEventFinishedNotification(const Callable& callable);
+        //@}
+
+        /**
+         * @name Internal helpers
+         */
+        //{@
+        /**
+         * @brief Allocate, insert and grow the calendar if needed
+         */
+        EventStore::Index
+        enqueue(const Callable& callable, wns::simulator::Tick at);
+
+        /**
+         * @brief Insert into the bucket of its day (keeps FIFO order for
+         * events with equal time)
+         */
+        void
+        insert(EventStore::Index index);
+
+        /**
+         * @brief Remove from its bucket, O(1). Shrinks the calendar if
+         * needed.
+         */
+        void
+        unlink(EventStore::Index index);
+
+        /**
+         * @brief Return the next event to be processed without removing it
+         * (EventStore::npos if empty). Advances the current day.
+         */
+        EventStore::Index
+        peek();
+
+        /**
+         * @brief Rebuild the calendar with the given number of buckets and
+         * a re-estimated bucket width
+         */
+        void
+        resize(size_t numberOfBuckets);
+
+        /**
+         * @brief Estimate the bucket width from the next events to be
+         * processed
+         */
+        double
+        estimateWidth() const;
+
+        long long int
+        dayOf(const wns::simulator::Tick& time) const;
+
+        size_t
+        bucketOf(long long int day) const;
+        //@}
+
+        // MEMBER
+        wns::simulator::Tick simTime_;
+
+        EventStore store_;
+
+        BucketContainer buckets_;
+
+        /**
+         * @brief Width of one bucket in ticks (seconds unless
+         * WNS_FIXED_POINT_TIME is defined)
+         */
+        double width_;
+
+        /**
+         * @brief The day currently being processed
+         */
+        long long int currentDay_;
+
+        /**
+         * @brief Number of events in the buckets
+         */
+        size_t size_;
+
+        bool stop_;
+
+        CommandQueue commandQueue_;
+    };
+
+} // scheduler
+} // events
+} // wns
+
+#endif  // NOT defined WNS_EVENTS_SCHEDULER_CALENDAR_HPP
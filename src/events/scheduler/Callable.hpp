@@ -28,12 +28,399 @@
 #ifndef WNS_EVENTS_SCHEDULER_CALLABLE_HPP
 #define WNS_EVENTS_SCHEDULER_CALLABLE_HPP
 
-#include <boost/function.hpp>
+#include <WNS/Assure.hpp>
+
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+
+#include <new>
+#include <typeinfo>
+
+/**
+ * @brief Size of the inline buffer of wns::events::scheduler::Callable in
+ * bytes. Functors that are larger are stored on the heap.
+ */
+#ifndef WNS_CALLABLE_BUFFER_SIZE
+#define WNS_CALLABLE_BUFFER_SIZE 48
+#endif
 
 namespace wns { namespace events { namespace scheduler {
-    typedef boost::function<void ()> Callable;
-}
-}
-}
+
+    /**
+     * @brief Function object with a name for the event profiler
+     *
+     * Events are attributed to the type of their function object in
+     * wns::events::scheduler::Monitor. If that is not specific enough (e.g.
+     * boost::bind of the same member function for different purposes) wrap
+     * the function object with tagged():
+     *
+     * @code
+     * scheduler->scheduleDelay(tagged("mac.Backoff", boost::bind(&Mac::onBackoff, this)), 0.1);
+     * @endcode
+     *
+     * The tag is not copied and must be a string literal (or live as long as
+     * the simulation).
+     */
+    template <typename F>
+    class Tagged
+    {
+    public:
+        Tagged(const char* tag, const F& functor) :
+            tag_(tag),
+            functor_(functor)
+        {
+        }
+
+        void
+        operator()()
+        {
+            functor_();
+        }
+
+        const char*
+        getTag() const
+        {
+            return tag_;
+        }
+
+    private:
+        const char* tag_;
+
+        F functor_;
+    };
+
+    template <typename F>
+    Tagged<F>
+    tagged(const char* tag, const F& functor)
+    {
+        return Tagged<F>(tag, functor);
+    }
+
+    namespace detail {
+
+        template <typename F>
+        const char*
+        getTag(const F*)
+        {
+            return NULL;
+        }
+
+        template <typename F>
+        const char*
+        getTag(const Tagged<F>* functor)
+        {
+            return functor->getTag();
+        }
+
+    } // detail
+
+    /**
+     * @brief Holds any function object with signature "void ()"
+     *
+     * Drop-in replacement for boost::function<void ()> with a larger inline
+     * buffer (WNS_CALLABLE_BUFFER_SIZE bytes). boost::function stores only
+     * function pointers and tiny function objects inline, while the typical
+     * callables of the scheduler (boost::bind of a member function with one
+     * or two arguments, MemberFunction, PeriodicTimeoutFunctor) are 24 to 40
+     * bytes and would cause an additional heap allocation per event.
+     *
+     * Function objects which fit into the buffer are copied into it (also on
+     * copy of the Callable), all others are allocated on the heap.
+     */
+    class Callable
+    {
+        typedef boost::aligned_storage<WNS_CALLABLE_BUFFER_SIZE>::type Storage;
+
+        /**
+         * @brief Type specific operations (one static table per type)
+         */
+        struct Operations
+        {
+            void (*invoke)(void* storage);
+            void (*clone)(const void* source, void* destination);
+            void (*destroy)(void* storage);
+            const std::type_info& (*type)();
+            const char* (*tag)(const void* storage);
+        };
+
+        template <typename F>
+        struct Inline
+        {
+            static void
+            create(const F& functor, void* storage)
+            {
+                new (storage) F(functor);
+            }
+
+            static void
+            invoke(void* storage)
+            {
+                (*static_cast<F*>(storage))();
+            }
+
+            static void
+            clone(const void* source, void* destination)
+            {
+                new (destination) F(*static_cast<const F*>(source));
+            }
+
+            static void
+            destroy(void* storage)
+            {
+                static_cast<F*>(storage)->~F();
+            }
+
+            static const std::type_info&
+            type()
+            {
+                return typeid(F);
+            }
+
+            static const char*
+            tag(const void* storage)
+            {
+                return detail::getTag(static_cast<const F*>(storage));
+            }
+
+            static const Operations operations;
+        };
+
+        template <typename F>
+        struct OnHeap
+        {
+            static void
+            create(const F& functor, void* storage)
+            {
+                *static_cast<F**>(storage) = new F(functor);
+                ++heapAllocations_;
+            }
+
+            static void
+            invoke(void* storage)
+            {
+                (**static_cast<F**>(storage))();
+            }
+
+            static void
+            clone(const void* source, void* destination)
+            {
+                *static_cast<F**>(destination) = new F(**static_cast<F* const*>(source));
+                ++heapAllocations_;
+            }
+
+            static void
+            destroy(void* storage)
+            {
+                delete *static_cast<F**>(storage);
+            }
+
+            static const std::type_info&
+            type()
+            {
+                return typeid(F);
+            }
+
+            static const char*
+            tag(const void* storage)
+            {
+                return detail::getTag(*static_cast<F* const*>(storage));
+            }
+
+            static const Operations operations;
+        };
+
+        template <typename F>
+        struct Fits
+        {
+            static const bool value =
+                sizeof(F) <= sizeof(Storage) &&
+                boost::alignment_of<Storage>::value % boost::alignment_of<F>::value == 0;
+        };
+
+        template <bool fits, typename F>
+        struct Select
+        {
+            typedef Inline<F> type;
+        };
+
+        template <typename F>
+        struct Select<false, F>
+        {
+            typedef OnHeap<F> type;
+        };
+
+        typedef const Operations* Callable::*SafeBool;
+
+    public:
+        /**
+         * @brief Size of the inline buffer in bytes
+         */
+        static const std::size_t bufferSize = sizeof(Storage);
+
+        /**
+         * @brief Empty, must not be called
+         */
+        Callable() :
+            operations_(NULL)
+        {
+        }
+
+        /**
+         * @brief Store a copy of the function object (or function pointer)
+         */
+        template <typename F>
+        Callable(F functor) :
+            operations_(NULL)
+        {
+            typedef typename Select<Fits<F>::value, F>::type Type;
+            Type::create(functor, address());
+            operations_ = &Type::operations;
+        }
+
+        Callable(const Callable& other) :
+            operations_(NULL)
+        {
+            assign(other);
+        }
+
+        ~Callable()
+        {
+            clear();
+        }
+
+        Callable&
+        operator=(const Callable& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                assign(other);
+            }
+            return *this;
+        }
+
+        void
+        operator()() const
+        {
+            assure(operations_ != NULL, "Called an empty Callable");
+            operations_->invoke(const_cast<Callable*>(this)->address());
+        }
+
+        bool
+        empty() const
+        {
+            return operations_ == NULL;
+        }
+
+        void
+        clear()
+        {
+            if (operations_ != NULL)
+            {
+                operations_->destroy(address());
+                operations_ = NULL;
+            }
+        }
+
+        operator SafeBool() const
+        {
+            return operations_ != NULL ? &Callable::operations_ : NULL;
+        }
+
+        /**
+         * @brief Type of the stored function object (typeid(void) if empty)
+         */
+        const std::type_info&
+        getType() const
+        {
+            return operations_ != NULL ? operations_->type() : typeid(void);
+        }
+
+        /**
+         * @brief Tag of the stored function object (see tagged()), NULL if
+         * it has none
+         */
+        const char*
+        getTag() const
+        {
+            return operations_ != NULL ? operations_->tag(address()) : NULL;
+        }
+
+        /**
+         * @brief True if function objects of type F are stored inline
+         */
+        template <typename F>
+        static bool
+        isStoredInline()
+        {
+            return Fits<F>::value;
+        }
+
+        /**
+         * @brief Number of function objects the calling thread has
+         * allocated on the heap so far (diagnostics only)
+         *
+         * The counter is thread local, like the event free lists, so
+         * the workers of a parallel scheduler do not race on it.
+         */
+        static unsigned long int
+        getHeapAllocations()
+        {
+            return heapAllocations_;
+        }
+
+    private:
+        void*
+        address()
+        {
+            return &storage_;
+        }
+
+        const void*
+        address() const
+        {
+            return &storage_;
+        }
+
+        void
+        assign(const Callable& other)
+        {
+            if (other.operations_ != NULL)
+            {
+                other.operations_->clone(other.address(), address());
+                operations_ = other.operations_;
+            }
+        }
+
+        const Operations* operations_;
+
+        Storage storage_;
+
+        static __thread unsigned long int heapAllocations_;
+    };
+
+    template <typename F>
+    const Callable::Operations Callable::Inline<F>::operations =
+    {
+        &Callable::Inline<F>::invoke,
+        &Callable::Inline<F>::clone,
+        &Callable::Inline<F>::destroy,
+        &Callable::Inline<F>::type,
+        &Callable::Inline<F>::tag
+    };
+
+    template <typename F>
+    const Callable::Operations Callable::OnHeap<F>::operations =
+    {
+        &Callable::OnHeap<F>::invoke,
+        &Callable::OnHeap<F>::clone,
+        &Callable::OnHeap<F>::destroy,
+        &Callable::OnHeap<F>::type,
+        &Callable::OnHeap<F>::tag
+    };
+
+} // scheduler
+} // events
+} // wns
 
 #endif // NOT defined WNS_EVENTS_SCHEDULER_CALLABLE_HPP
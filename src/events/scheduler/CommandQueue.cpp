@@ -30,73 +30,126 @@
 using namespace wns::events::scheduler;
 
 CommandQueue::CommandQueue() :
-    queue_(),
-    mutex_()
+    incoming_(NULL),
+    pending_(NULL)
 {
-    pthread_mutex_init(&mutex_, 0);
 }
 
 CommandQueue::~CommandQueue()
 {
+    reset();
 }
 
 void
-CommandQueue::runCommands()
+CommandQueue::runQueuedCommands()
 {
-    pthread_mutex_lock(&mutex_);
-    try
+    Command* incoming = takeIncoming();
+    if (pending_ == NULL)
     {
-        for(CommandContainer::iterator itr = queue_.begin();
-            itr != queue_.end();
-            ++itr)
+        pending_ = incoming;
+    }
+    else
+    {
+        // a command has thrown during the last run
+        Command* last = pending_;
+        while (last->next_ != NULL)
+        {
+            last = last->next_;
+        }
+        last->next_ = incoming;
+    }
+
+    while (pending_ != NULL)
+    {
+        // unlink first, so the remaining commands survive an exception
+        CommandPtr command = pending_->self_;
+        pending_ = command->next_;
+        command->next_ = NULL;
+        command->self_ = CommandPtr();
+
+        // canceled commands are simply dropped
+        if (command->changeState(Command::Queued, Command::Running))
         {
-            (**itr).state_ = Command::Running;
-            (**itr)();
-            (**itr).state_ = Command::Finished;
+            (*command)();
+            command->state_ = Command::Finished;
         }
-        queue_.clear();
     }
-    catch(...)
+}
+
+CommandQueue::Command*
+CommandQueue::takeIncoming()
+{
+    Command* stack = __sync_lock_test_and_set(&incoming_, static_cast<Command*>(NULL));
+
+    // reverse (newest first -> oldest first)
+    Command* fifo = NULL;
+    while (stack != NULL)
+    {
+        Command* next = stack->next_;
+        stack->next_ = fifo;
+        fifo = stack;
+        stack = next;
+    }
+    return fifo;
+}
+
+void
+CommandQueue::release(Command* commands)
+{
+    while (commands != NULL)
     {
-        pthread_mutex_unlock(&mutex_);
-        throw;
+        Command* next = commands->next_;
+        commands->next_ = NULL;
+        // may delete the command
+        commands->self_ = CommandPtr();
+        commands = next;
     }
-    pthread_mutex_unlock(&mutex_);
 }
 
 void
 CommandQueue::reset()
 {
     // clear Command queue
-    pthread_mutex_lock(&mutex_);
-    queue_.clear();
-    pthread_mutex_unlock(&mutex_);
+    release(takeIncoming());
+    release(pending_);
+    pending_ = NULL;
 }
 
 wns::events::scheduler::ICommandPtr
 CommandQueue::queueCommand(const Callable& callee)
 {
-    pthread_mutex_lock(&mutex_);
     CommandPtr command(new Command(callee));
-    try
-    {
-        queue_.push_back(command);
-        command->state_ = Command::Queued;
-    }
-    catch(...)
+    command->state_ = Command::Queued;
+    command->self_ = command;
+
+    // the CAS returns the actual top of the stack, no separate read needed
+    Command* top = NULL;
+    for (;;)
     {
-        pthread_mutex_unlock(&mutex_);
-        throw;
+        command->next_ = top;
+        Command* seen = __sync_val_compare_and_swap(&incoming_, top, command.getPtr());
+        if (seen == top)
+        {
+            break;
+        }
+        top = seen;
     }
-    pthread_mutex_unlock(&mutex_);
+
     return command;
 }
 
 void
 CommandQueue::dequeueCommand(const ICommandPtr& command)
 {
-    pthread_mutex_lock(&mutex_);
     CommandPtr commandPtr = dynamicCast<Command>(command);
+    assureNotNull(commandPtr);
+
+    // the command stays in the queue and is dropped by runCommands()
+    if (commandPtr->changeState(Command::Queued, Command::Canceled))
+    {
+        return;
+    }
+
     if (command->isRunning())
     {
         throw ICommand::CancelException("Command is currently being executed");
@@ -109,19 +162,8 @@ CommandQueue::dequeueCommand(const ICommandPtr& command)
     {
         throw ICommand::CancelException("Command has already been called");
     }
-    else if (command->isNotSubmitted())
+    else
     {
         throw ICommand::CancelException("Should never happen");
     }
-    try
-    {
-        queue_.remove(commandPtr);
-        commandPtr->state_ = Command::Canceled;
-    }
-    catch(...)
-    {
-        pthread_mutex_unlock(&mutex_);
-        throw;
-    }
-    pthread_mutex_unlock(&mutex_);
 }
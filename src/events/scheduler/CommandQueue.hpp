@@ -30,12 +30,8 @@
 
 #include <WNS/events/scheduler/ICommand.hpp>
 #include <WNS/events/scheduler/Callable.hpp>
-#include <WNS/container/FastListEnabler.hpp>
-#include <WNS/container/FastList.hpp>
 #include <WNS/Assure.hpp>
 
-#include <pthread.h>
-
 namespace wns { namespace events { namespace scheduler {
     /**
      * @brief Thread safe command queue
@@ -46,6 +42,17 @@ namespace wns { namespace events { namespace scheduler {
      * This thread safe command queue is used to insert commands from other
      * threads into the main event loop. The command queue will be paged before
      * a new event is executed and will run all available commands. 
+     *
+     * The queue is lock-free for multiple producers and a single consumer (the
+     * thread running the event loop): producers push onto an intrusive stack
+     * with compare-and-swap, the consumer takes the whole stack at once and
+     * restores FIFO order. Since the top of the stack doubles as "non-empty"
+     * flag, paging an empty queue costs a single load.
+     *
+     * Canceled commands stay in the queue and are skipped by runCommands().
+     *
+     * The commands are AtomicRefCountable, thus producers may keep (and drop)
+     * the returned ICommandPtr while the consumer runs the command.
      */
     class CommandQueue
     {
@@ -81,9 +88,19 @@ namespace wns { namespace events { namespace scheduler {
 
         /**
          * @brief This "brings" us back into the main event loop ...
+         *
+         * Must only be called by the thread running the event loop.
          */
         void
-        runCommands();
+        runCommands()
+        {
+            // relaxed (plain) load, a command that is just being pushed is
+            // run next time
+            if (__atomic_load_n(&incoming_, __ATOMIC_RELAXED) != NULL || pending_ != NULL)
+            {
+                runQueuedCommands();
+            }
+        }
 
     private:
 
@@ -94,13 +111,14 @@ namespace wns { namespace events { namespace scheduler {
          * and thus cannot be accessed from outside.
          */
         class Command :
-            public virtual ICommand,
-            public wns::container::SingleFastListEnabler< wns::SmartPtr<Command> >
+            public virtual ICommand
         {
         public:
             Command(const wns::events::scheduler::Callable& callable) :
                 callable_(callable),
-                state_(NotSubmitted)
+                state_(NotSubmitted),
+                next_(NULL),
+                self_()
             {
             }
 
@@ -152,18 +170,61 @@ namespace wns { namespace events { namespace scheduler {
                 return Canceled == state_;
             }
 
+            /**
+             * @brief Atomically change the state from "from" to "to"
+             */
+            bool
+            changeState(State from, State to)
+            {
+                return __sync_bool_compare_and_swap(&state_, from, to);
+            }
+
             wns::events::scheduler::Callable callable_;
 
-            State state_;
+            volatile State state_;
+
+            /**
+             * @brief Link within the queue
+             */
+            Command* next_;
+
+            /**
+             * @brief Reference held by the queue while the command is linked
+             */
+            wns::SmartPtr<Command> self_;
         };
 
         typedef wns::SmartPtr<Command> CommandPtr;
 
-        typedef wns::container::FastList<CommandPtr> CommandContainer;
+        /**
+         * @brief Move the incoming commands to pending_ and run them
+         */
+        void
+        runQueuedCommands();
+
+        /**
+         * @brief Take all incoming commands (in FIFO order)
+         */
+        Command*
+        takeIncoming();
+
+        /**
+         * @brief Drop the reference of the queue for a list of commands
+         */
+        static void
+        release(Command* commands);
 
-        CommandContainer queue_;
+        /**
+         * @brief Stack of commands pushed by the producers (newest first)
+         */
+        Command* volatile incoming_;
 
-        pthread_mutex_t mutex_;
+        /**
+         * @brief Commands taken by the consumer but not yet run (FIFO)
+         *
+         * Only accessed by the consumer. Remains valid if a command throws.
+         */
+        Command* pending_;
 
     }; // CommandQueue
 } // scheduler
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_EVENTS_SCHEDULER_EVENTHANDLE_HPP
+#define WNS_EVENTS_SCHEDULER_EVENTHANDLE_HPP
+
+#include <stdint.h>
+
+namespace wns { namespace events { namespace scheduler {
+
+    /**
+     * @brief Light-weight handle of a scheduled event
+     *
+     * A handle is a pair of slot index and generation within the event store
+     * of a scheduler (plus the partition of the store, if the scheduler uses
+     * more than one). It can be copied freely and does no reference
+     * counting. Once the event has been executed or canceled the slot is
+     * re-used with a new generation and the handle becomes stale, i.e.
+     * wns::events::scheduler::Interface::isQueued() returns false.
+     *
+     * A default constructed handle is invalid (not bound to any event).
+     */
+    class EventHandle
+    {
+        friend class EventStore;
+    public:
+        EventHandle() :
+            index_(0),
+            generation_(0),
+            partition_(0)
+        {
+        }
+
+        /**
+         * @brief True if the handle has been returned by a scheduler
+         *
+         * @note This does not tell if the event is still queued
+         */
+        bool
+        isValid() const
+        {
+            return generation_ != 0;
+        }
+
+        bool
+        operator==(const EventHandle& other) const
+        {
+            return index_ == other.index_ &&
+                generation_ == other.generation_ &&
+                partition_ == other.partition_;
+        }
+
+        bool
+        operator!=(const EventHandle& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        EventHandle(uint32_t index, uint32_t generation, uint32_t partition) :
+            index_(index),
+            generation_(generation),
+            partition_(partition)
+        {
+        }
+
+        uint32_t index_;
+
+        uint32_t generation_;
+
+        uint32_t partition_;
+    };
+
+} // scheduler
+} // events
+} // wns
+
+#endif // NOT defined WNS_EVENTS_SCHEDULER_EVENTHANDLE_HPP
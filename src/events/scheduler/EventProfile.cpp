@@ -0,0 +1,257 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/events/scheduler/EventProfile.hpp>
+#include <WNS/demangle.hpp>
+#include <WNS/Assure.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <cstring>
+#include <cmath>
+#include <time.h>
+
+using namespace wns::events::scheduler;
+
+namespace {
+
+    /**
+     * @brief Events are started and finished on the same thread, but with
+     * the Parallel scheduler different threads run events at the same time
+     */
+    struct Measurement
+    {
+        bool sampled;
+        struct timespec start;
+    };
+
+    __thread Measurement measurement;
+
+    double
+    getThreadCPUTime()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+        return now.tv_sec + now.tv_nsec * 1e-9;
+    }
+
+    bool
+    byCPUTime(const EventProfile::Entry* a, const EventProfile::Entry* b)
+    {
+        return a->getCPUTime() > b->getCPUTime();
+    }
+
+    std::string
+    formatBin(int bin)
+    {
+        static const char* units[] = {"ns", "us", "ms", "s"};
+        double value = std::ldexp(1.0, bin);
+        int unit = 0;
+        while (value >= 1000.0 && unit < 3)
+        {
+            value /= 1000.0;
+            ++unit;
+        }
+        std::ostringstream s;
+        s << std::setprecision(3) << value << units[unit];
+        return s.str();
+    }
+
+} // namespace
+
+EventProfile::Entry::Entry() :
+    name(),
+    count(0),
+    sampled(0),
+    sampledCPUTime(0.0),
+    histogram(numberOfBins, 0)
+{
+}
+
+double
+EventProfile::Entry::getCPUTime() const
+{
+    if (sampled == 0)
+    {
+        return 0.0;
+    }
+    return sampledCPUTime * static_cast<double>(count) / static_cast<double>(sampled);
+}
+
+EventProfile::Key::Key(const Callable& callable) :
+    tag(callable.getTag()),
+    type(&callable.getType())
+{
+}
+
+bool
+EventProfile::Key::operator<(const Key& other) const
+{
+    if (tag != NULL || other.tag != NULL)
+    {
+        if (tag == NULL || other.tag == NULL)
+        {
+            return tag == NULL;
+        }
+        return std::strcmp(tag, other.tag) < 0;
+    }
+    return type->before(*other.type);
+}
+
+EventProfile::EventProfile(unsigned int samplingInterval) :
+    samplingInterval_(samplingInterval),
+    processedEvents_(0),
+    entries_()
+{
+    assure(samplingInterval_ > 0, "The sampling interval must be at least 1");
+}
+
+void
+EventProfile::onEventStarted(const Callable&)
+{
+    ++processedEvents_;
+    measurement.sampled = (processedEvents_ % samplingInterval_ == 0);
+    if (measurement.sampled)
+    {
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &measurement.start);
+    }
+}
+
+void
+EventProfile::onEventFinished(const Callable& callable)
+{
+    double stop = measurement.sampled ? getThreadCPUTime() : 0.0;
+
+    Entry& entry = getEntry(callable);
+    ++entry.count;
+
+    if (measurement.sampled)
+    {
+        double duration = stop - (measurement.start.tv_sec + measurement.start.tv_nsec * 1e-9);
+        ++entry.sampled;
+        entry.sampledCPUTime += duration;
+        ++entry.histogram[getBin(duration)];
+        measurement.sampled = false;
+    }
+}
+
+const EventProfile::Entry*
+EventProfile::find(const std::string& name) const
+{
+    for (EntryContainer::const_iterator itr = entries_.begin(); itr != entries_.end(); ++itr)
+    {
+        if (itr->second.name == name)
+        {
+            return &itr->second;
+        }
+    }
+    return NULL;
+}
+
+void
+EventProfile::write(std::ostream& out) const
+{
+    std::vector<const Entry*> sorted;
+    double total = 0.0;
+    for (EntryContainer::const_iterator itr = entries_.begin(); itr != entries_.end(); ++itr)
+    {
+        sorted.push_back(&itr->second);
+        total += itr->second.getCPUTime();
+    }
+    std::sort(sorted.begin(), sorted.end(), byCPUTime);
+
+    out << "# Event profile of the event scheduler\n"
+        << "# processed events: " << processedEvents_ << "\n"
+        << "# sampling interval: " << samplingInterval_ << "\n"
+        << "# CPU time: " << total << " s (estimated from the sampled events)\n"
+        << "#\n"
+        << "# " << std::setw(12) << "count"
+        << std::setw(12) << "sampled"
+        << std::setw(14) << "CPU time [s]"
+        << std::setw(10) << "share [%]"
+        << std::setw(12) << "mean [us]"
+        << "  type / tag\n";
+
+    for (std::vector<const Entry*>::const_iterator itr = sorted.begin(); itr != sorted.end(); ++itr)
+    {
+        const Entry& entry = **itr;
+        double mean = entry.sampled > 0 ? entry.sampledCPUTime / entry.sampled * 1e6 : 0.0;
+        out << "  " << std::setw(12) << entry.count
+            << std::setw(12) << entry.sampled
+            << std::setw(14) << std::setprecision(6) << entry.getCPUTime()
+            << std::setw(10) << std::setprecision(3) << (total > 0.0 ? entry.getCPUTime() / total * 100.0 : 0.0)
+            << std::setw(12) << std::setprecision(4) << mean
+            << "  " << entry.name << "\n";
+    }
+
+    out << "#\n"
+        << "# Execution time histograms (sampled events per bin, bins start at the given time)\n";
+    for (std::vector<const Entry*>::const_iterator itr = sorted.begin(); itr != sorted.end(); ++itr)
+    {
+        const Entry& entry = **itr;
+        if (entry.sampled == 0)
+        {
+            continue;
+        }
+        out << "\n" << entry.name << "\n";
+        for (int bin = 0; bin < numberOfBins; ++bin)
+        {
+            if (entry.histogram[bin] > 0)
+            {
+                out << "  >= " << std::setw(8) << formatBin(bin) << ": " << entry.histogram[bin] << "\n";
+            }
+        }
+    }
+    out.flush();
+}
+
+int
+EventProfile::getBin(double seconds)
+{
+    double nanoseconds = seconds * 1e9;
+    int bin = 0;
+    while (nanoseconds >= 2.0 && bin < numberOfBins - 1)
+    {
+        nanoseconds /= 2.0;
+        ++bin;
+    }
+    return bin;
+}
+
+EventProfile::Entry&
+EventProfile::getEntry(const Callable& callable)
+{
+    Key key(callable);
+    EntryContainer::iterator itr = entries_.find(key);
+    if (itr == entries_.end())
+    {
+        itr = entries_.insert(std::make_pair(key, Entry())).first;
+        itr->second.name = key.tag != NULL ? std::string(key.tag) : wns::demangle(key.type->name());
+    }
+    return itr->second;
+}
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_EVENTS_SCHEDULER_EVENTPROFILE_HPP
+#define WNS_EVENTS_SCHEDULER_EVENTPROFILE_HPP
+
+#include <WNS/events/scheduler/Callable.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <typeinfo>
+
+namespace wns { namespace events { namespace scheduler {
+
+    /**
+     * @brief Attributes the CPU time of the processed events to the type of
+     * their callable
+     *
+     * Events are grouped by the tag of their callable (see tagged()) or, if
+     * the callable has no tag, by the demangled type of the function object.
+     * For each group the number of events, the CPU time (of the executing
+     * thread) and a histogram of the execution time of single events are
+     * recorded.
+     *
+     * Reading the CPU clock costs more than a small event. With a sampling
+     * interval of N only every N-th event is timed, the CPU time of a group
+     * is then extrapolated from its sampled events. Counting is always
+     * exact.
+     *
+     * Fed by wns::events::scheduler::Monitor (onEventStarted /
+     * onEventFinished), which writes the report at shutdown.
+     */
+    class EventProfile
+    {
+    public:
+        /**
+         * @brief Bin i counts events that took [2^i, 2^(i+1)) nanoseconds
+         * (the last bin is open)
+         */
+        static const int numberOfBins = 32;
+
+        /**
+         * @brief Everything known about one group of events
+         */
+        struct Entry
+        {
+            Entry();
+
+            /**
+             * @brief Estimated CPU time in seconds (extrapolated from the
+             * sampled events)
+             */
+            double
+            getCPUTime() const;
+
+            std::string name;
+            long long int count;
+            long long int sampled;
+            double sampledCPUTime;
+            std::vector<long long int> histogram;
+        };
+
+        explicit
+        EventProfile(unsigned int samplingInterval = 1);
+
+        void
+        onEventStarted(const Callable& callable);
+
+        void
+        onEventFinished(const Callable& callable);
+
+        /**
+         * @brief Entry for a tag or demangled type name, NULL if no such
+         * event has been processed
+         */
+        const Entry*
+        find(const std::string& name) const;
+
+        long long int
+        getProcessedEvents() const
+        {
+            return processedEvents_;
+        }
+
+        unsigned int
+        getSamplingInterval() const
+        {
+            return samplingInterval_;
+        }
+
+        /**
+         * @brief Table of all groups, sorted by CPU time
+         */
+        void
+        write(std::ostream& out) const;
+
+        static int
+        getBin(double seconds);
+
+    private:
+        /**
+         * @brief Tags are compared by content, types with
+         * std::type_info::before
+         */
+        struct Key
+        {
+            Key(const Callable& callable);
+
+            bool
+            operator<(const Key& other) const;
+
+            const char* tag;
+            const std::type_info* type;
+        };
+
+        typedef std::map<Key, Entry> EntryContainer;
+
+        Entry&
+        getEntry(const Callable& callable);
+
+        unsigned int samplingInterval_;
+
+        long long int processedEvents_;
+
+        EntryContainer entries_;
+    };
+
+} // scheduler
+} // events
+} // wns
+
+#endif // NOT defined WNS_EVENTS_SCHEDULER_EVENTPROFILE_HPP
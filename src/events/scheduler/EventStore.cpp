@@ -0,0 +1,300 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/events/scheduler/EventStore.hpp>
+#include <WNS/events/scheduler/Interface.hpp>
+
+using namespace wns::events::scheduler;
+
+const EventStore::Index EventStore::npos;
+const EventStore::Index EventStore::chunkBits;
+const EventStore::Index EventStore::chunkSize;
+const EventStore::Index EventStore::chunkMask;
+
+EventStore::Event::Event(
+    Interface* scheduler,
+    const EventHandle& handle,
+    const wns::simulator::Time& scheduled,
+    const wns::simulator::Time& issued) :
+    scheduler_(scheduler),
+    handle_(handle),
+    scheduled_(scheduled),
+    issued_(issued),
+    state_(NotSubmitted)
+{
+}
+
+void
+EventStore::Event::cancel()
+{
+    scheduler_->cancelEvent(IEventPtr(this));
+}
+
+EventStore::Slot::Slot() :
+    callable(),
+    scheduled(0),
+    issued(0),
+    key(0),
+    list(NULL),
+    next(npos),
+    previous(npos),
+    generation(1),
+    state(Free),
+    event()
+{
+}
+
+EventStore::EventStore(uint32_t partition) :
+    chunks_(),
+    freeList_(npos),
+    capacity_(0),
+    size_(0),
+    partition_(partition)
+{
+}
+
+EventStore::~EventStore()
+{
+    clear();
+    for (std::vector<Slot*>::iterator itr = chunks_.begin();
+         itr != chunks_.end();
+         ++itr)
+    {
+        delete [] *itr;
+    }
+}
+
+EventStore::Index
+EventStore::allocate(
+    const Callable& callable,
+    const wns::simulator::Tick& scheduled,
+    const wns::simulator::Tick& issued)
+{
+    if (freeList_ == npos)
+    {
+        grow();
+    }
+
+    Index index = freeList_;
+    Slot& slot = get(index);
+    freeList_ = slot.next;
+
+    slot.callable = callable;
+    slot.scheduled = scheduled;
+    slot.issued = issued;
+    slot.key = 0;
+    slot.list = NULL;
+    slot.next = npos;
+    slot.previous = npos;
+    slot.state = Slot::Queued;
+
+    ++size_;
+    return index;
+}
+
+void
+EventStore::release(Index index, Event::State finalState)
+{
+    Slot& slot = get(index);
+    assure(slot.state != Slot::Free, "Slot has already been released");
+    assure(slot.list == NULL, "Slot must be unlinked before it is released");
+
+    if (slot.event)
+    {
+        slot.event->state_ = finalState;
+        slot.event = EventPtr();
+    }
+    slot.callable.clear();
+    slot.state = Slot::Free;
+
+    // 0 is reserved for invalid handles
+    if (++slot.generation == 0)
+    {
+        slot.generation = 1;
+    }
+
+    slot.next = freeList_;
+    freeList_ = index;
+    --size_;
+}
+
+void
+EventStore::clear()
+{
+    freeList_ = npos;
+    size_ = 0;
+    // rebuild the free list backwards, so low indices are used first
+    for (Index index = capacity_; index > 0; --index)
+    {
+        Slot& slot = get(index - 1);
+        slot.list = NULL;
+        slot.previous = npos;
+
+        if (slot.state == Slot::Running)
+        {
+            // the scheduler releases the slot once the callable returns
+            slot.next = npos;
+            ++size_;
+            continue;
+        }
+
+        if (slot.state != Slot::Free)
+        {
+            if (slot.event)
+            {
+                slot.event->handle_ = EventHandle();
+                slot.event = EventPtr();
+            }
+            slot.callable.clear();
+            slot.state = Slot::Free;
+            if (++slot.generation == 0)
+            {
+                slot.generation = 1;
+            }
+        }
+        slot.next = freeList_;
+        freeList_ = index - 1;
+    }
+}
+
+wns::events::scheduler::IEventPtr
+EventStore::getEvent(Index index, Interface* scheduler)
+{
+    Slot& slot = get(index);
+    if (!slot.event)
+    {
+        slot.event = EventPtr(new Event(scheduler,
+                                       getHandle(index),
+                                       wns::simulator::fromTick(slot.scheduled),
+                                       wns::simulator::fromTick(slot.issued)));
+        slot.event->state_ = (slot.state == Slot::Running) ? Event::Running : Event::Queued;
+    }
+    return slot.event;
+}
+
+bool
+EventStore::prepareCancel(const EventPtr& event)
+{
+    if (event->isRunning())
+    {
+        throw IEvent::CancelException("Event is currently being executed");
+    }
+    else if (event->isCanceled())
+    {
+        throw IEvent::CancelException("Event is already canceled");
+    }
+    else if (event->isFinished())
+    {
+        throw IEvent::CancelException("Event has already been called");
+    }
+    else if (event->isNotSubmitted())
+    {
+        throw IEvent::CancelException("Should never happen");
+    }
+
+    if (!event->handle_.isValid())
+    {
+        // the scheduler has been reset, nothing left to remove
+        event->state_ = Event::Canceled;
+        return false;
+    }
+    return true;
+}
+
+void
+EventStore::insertAfter(List& list, Index position, Index index)
+{
+    Slot& slot = get(index);
+    slot.list = &list;
+    slot.previous = position;
+
+    if (position == npos)
+    {
+        slot.next = list.first;
+        list.first = index;
+    }
+    else
+    {
+        Slot& predecessor = get(position);
+        slot.next = predecessor.next;
+        predecessor.next = index;
+    }
+
+    if (slot.next == npos)
+    {
+        list.last = index;
+    }
+    else
+    {
+        get(slot.next).previous = index;
+    }
+}
+
+void
+EventStore::unlink(Index index)
+{
+    Slot& slot = get(index);
+    assure(slot.list != NULL, "Slot is not linked into a list");
+    List& list = *slot.list;
+
+    if (slot.previous == npos)
+    {
+        list.first = slot.next;
+    }
+    else
+    {
+        get(slot.previous).next = slot.next;
+    }
+
+    if (slot.next == npos)
+    {
+        list.last = slot.previous;
+    }
+    else
+    {
+        get(slot.next).previous = slot.previous;
+    }
+
+    slot.list = NULL;
+    slot.next = npos;
+    slot.previous = npos;
+}
+
+void
+EventStore::grow()
+{
+    Slot* chunk = new Slot[chunkSize];
+    chunks_.push_back(chunk);
+
+    // chain the new slots in front of the free list
+    for (Index ii = 0; ii < chunkSize; ++ii)
+    {
+        chunk[ii].next = (ii + 1 < chunkSize) ? capacity_ + ii + 1 : freeList_;
+    }
+    freeList_ = capacity_;
+    capacity_ += chunkSize;
+}
@@ -0,0 +1,394 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_EVENTS_SCHEDULER_EVENTSTORE_HPP
+#define WNS_EVENTS_SCHEDULER_EVENTSTORE_HPP
+
+#include <WNS/events/scheduler/IEvent.hpp>
+#include <WNS/events/scheduler/EventHandle.hpp>
+#include <WNS/events/scheduler/Callable.hpp>
+#include <WNS/simulator/Time.hpp>
+#include <WNS/NonCopyable.hpp>
+#include <WNS/SmartPtr.hpp>
+
+#include <vector>
+
+namespace wns { namespace events { namespace scheduler {
+
+    class Interface;
+
+    /**
+     * @brief Slab of scheduled events, shared by the scheduler implementations
+     *
+     * Events are stored in slots which are allocated in chunks and never move
+     * in memory. Released slots are kept in a free list and re-used, each time
+     * with a new generation. Thus, scheduling an event does not touch the
+     * allocator (once the store has reached its peak size) and an event is
+     * identified by an EventHandle (index, generation) without any reference
+     * counting.
+     *
+     * The scheduler arranges the slots in intrusive, doubly linked lists
+     * (see List) ordered by its needs.
+     *
+     * For the IEventPtr based API of the scheduler an Event object is created
+     * on demand (getEvent()). It mirrors the state of its slot and keeps its
+     * final state after the slot has been released.
+     */
+    class EventStore :
+        private NonCopyable
+    {
+    public:
+        typedef uint32_t Index;
+
+        /**
+         * @brief Marks the end of a list / no slot
+         */
+        static const Index npos = 0xffffffff;
+
+        /**
+         * @brief IEvent for the reference counted scheduler API
+         */
+        class Event :
+            public virtual IEvent
+        {
+            friend class EventStore;
+        public:
+            enum State
+            {
+                NotSubmitted,
+                Queued,
+                Running,
+                Finished,
+                Canceled
+            };
+
+            Event(Interface* scheduler,
+                  const EventHandle& handle,
+                  const wns::simulator::Time& scheduled,
+                  const wns::simulator::Time& issued);
+
+            virtual void
+            cancel();
+
+            virtual bool
+            isNotSubmitted() const
+            {
+                return NotSubmitted == state_;
+            }
+
+            virtual bool
+            isQueued() const
+            {
+                return Queued == state_;
+            }
+
+            virtual bool
+            isRunning() const
+            {
+                return Running == state_;
+            }
+
+            virtual bool
+            isFinished() const
+            {
+                return Finished == state_;
+            }
+
+            virtual bool
+            isCanceled() const
+            {
+                return Canceled == state_;
+            }
+
+            virtual wns::simulator::Time
+            getScheduled() const
+            {
+                return scheduled_;
+            }
+
+            virtual wns::simulator::Time
+            getIssued() const
+            {
+                return issued_;
+            }
+
+            const EventHandle&
+            getHandle() const
+            {
+                return handle_;
+            }
+
+        private:
+            Interface* scheduler_;
+
+            EventHandle handle_;
+
+            wns::simulator::Time scheduled_;
+
+            wns::simulator::Time issued_;
+
+            State state_;
+        };
+
+        typedef wns::SmartPtr<Event> EventPtr;
+
+        /**
+         * @brief Head of an intrusive list of slots
+         *
+         * The address of a List must not change while it holds slots.
+         */
+        struct List
+        {
+            List() :
+                first(npos),
+                last(npos)
+            {
+            }
+
+            bool
+            empty() const
+            {
+                return first == npos;
+            }
+
+            Index first;
+
+            Index last;
+        };
+
+        /**
+         * @brief A scheduled event
+         */
+        struct Slot
+        {
+            enum State
+            {
+                Free,
+                Queued,
+                Running
+            };
+
+            Slot();
+
+            Callable callable;
+
+            wns::simulator::Tick scheduled;
+
+            wns::simulator::Tick issued;
+
+            /**
+             * @brief For use by the scheduler (e.g. pre-computed bucket)
+             */
+            long long int key;
+
+            /**
+             * @brief The list this slot is linked into (NULL if none)
+             */
+            List* list;
+
+            Index next;
+
+            Index previous;
+
+            uint32_t generation;
+
+            State state;
+
+            /**
+             * @brief Only set if an IEventPtr has been requested
+             */
+            EventPtr event;
+        };
+
+        /**
+         * @brief Schedulers with more than one store (see Parallel) use the
+         * partition to tell the handles of the stores apart
+         */
+        explicit
+        EventStore(uint32_t partition = 0);
+
+        ~EventStore();
+
+        /**
+         * @brief Occupy a slot for a new (queued) event
+         */
+        Index
+        allocate(const Callable& callable,
+                 const wns::simulator::Tick& scheduled,
+                 const wns::simulator::Tick& issued);
+
+        /**
+         * @brief Return the slot to the free list
+         *
+         * The slot must not be linked into any list. The Event (if any) is
+         * set to its final state.
+         */
+        void
+        release(Index index, Event::State finalState);
+
+        /**
+         * @brief Release all slots
+         *
+         * Existing Event objects are detached and keep their current state.
+         * A slot which is currently running stays allocated (but unlinked)
+         * until it is released by the scheduler.
+         */
+        void
+        clear();
+
+        Slot&
+        get(Index index)
+        {
+            return chunks_[index >> chunkBits][index & chunkMask];
+        }
+
+        const Slot&
+        get(Index index) const
+        {
+            return chunks_[index >> chunkBits][index & chunkMask];
+        }
+
+        EventHandle
+        getHandle(Index index) const
+        {
+            return EventHandle(index, get(index).generation, partition_);
+        }
+
+        /**
+         * @brief True if the handle refers to an allocated slot
+         */
+        bool
+        isValid(const EventHandle& handle) const
+        {
+            return handle.generation_ != 0 &&
+                handle.partition_ == partition_ &&
+                handle.index_ < capacity_ &&
+                get(handle.index_).generation == handle.generation_ &&
+                get(handle.index_).state != Slot::Free;
+        }
+
+        /**
+         * @brief Slot index of a valid handle
+         */
+        Index
+        getIndex(const EventHandle& handle) const
+        {
+            return handle.index_;
+        }
+
+        static uint32_t
+        getPartition(const EventHandle& handle)
+        {
+            return handle.partition_;
+        }
+
+        /**
+         * @brief Return the Event of the slot (created on first request)
+         */
+        IEventPtr
+        getEvent(Index index, Interface* scheduler);
+
+        /**
+         * @brief Mark the slot as being executed
+         */
+        void
+        setRunning(Index index)
+        {
+            Slot& slot = get(index);
+            slot.state = Slot::Running;
+            if (slot.event)
+            {
+                slot.event->state_ = Event::Running;
+            }
+        }
+
+        /**
+         * @brief Check if the Event may be canceled (throws
+         * IEvent::CancelException otherwise)
+         *
+         * @return false if the Event has been detached by clear() and was
+         * thus just marked as canceled, true if the scheduler needs to
+         * cancel the handle of the Event.
+         */
+        static bool
+        prepareCancel(const EventPtr& event);
+
+        /**
+         * @brief Number of allocated slots
+         */
+        size_t
+        size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @name Intrusive list operations
+         */
+        //{@
+        void
+        pushBack(List& list, Index index)
+        {
+            insertAfter(list, list.last, index);
+        }
+
+        /**
+         * @brief Insert behind position (npos inserts at the front)
+         */
+        void
+        insertAfter(List& list, Index position, Index index);
+
+        void
+        unlink(Index index);
+        //@}
+
+    private:
+        static const Index chunkBits = 10;
+
+        static const Index chunkSize = 1 << chunkBits;
+
+        static const Index chunkMask = chunkSize - 1;
+
+        void
+        grow();
+
+        std::vector<Slot*> chunks_;
+
+        Index freeList_;
+
+        Index capacity_;
+
+        size_t size_;
+
+        uint32_t partition_;
+    };
+
+} // scheduler
+} // events
+} // wns
+
+#endif // NOT defined WNS_EVENTS_SCHEDULER_EVENTSTORE_HPP
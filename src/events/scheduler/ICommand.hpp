@@ -52,9 +52,13 @@ namespace wns { namespace events { namespace scheduler {
      * finished or cancled.
      * The Command that is returned by the queue method will be in state Queued!
      * The user will never see NotSubmitted.
+     *
+     * Commands are handed between threads (the thread queueing a command and
+     * the thread running the event loop), hence they are reference counted
+     * atomically.
      */
     class ICommand :
-        virtual public RefCountable
+        virtual public AtomicRefCountable
     {
     public:
         /**
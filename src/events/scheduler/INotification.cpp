@@ -71,3 +71,37 @@ INotification::onAddEvent()
 {
     doOnAddEvent();
 }
+
+void
+INotification::onEventStarted(const Callable& callable)
+{
+    doOnEventStarted(callable);
+}
+
+void
+INotification::onEventFinished(const Callable& callable)
+{
+    doOnEventFinished(callable);
+}
+
+void
+INotification::doOnEventStarted(const Callable&)
+{
+}
+
+void
+INotification::doOnEventFinished(const Callable&)
+{
+}
+
+EventNotification::EventNotification(Function function, const Callable& callable) :
+    function_(function),
+    callable_(callable)
+{
+}
+
+void
+EventNotification::operator()(INotification* observer) const
+{
+    (observer->*function_)(callable_);
+}
@@ -29,6 +29,7 @@
 #define WNS_EVENTS_SCHEDULER_INOTIFICATION_HPP
 
 #include <WNS/ObserverInterface.hpp>
+#include <WNS/events/scheduler/Callable.hpp>
 #include <WNS/simulator/Time.hpp>
 
 namespace wns { namespace events { namespace scheduler {
@@ -62,6 +63,12 @@ namespace wns { namespace events { namespace scheduler {
         void
         onAddEvent();
 
+        void
+        onEventStarted(const Callable& callable);
+
+        void
+        onEventFinished(const Callable& callable);
+
     private:
         /**
          * @brief Called before an event is processed
@@ -103,10 +110,45 @@ namespace wns { namespace events { namespace scheduler {
         virtual void
         doOnAddEvent() = 0;
 
+        /**
+         * @brief Called right before the callable of an event is executed
+         *
+         * Not pure virtual, observers that don't care about single events
+         * don't need to implement it.
+         */
+        virtual void
+        doOnEventStarted(const Callable& callable);
+
+        /**
+         * @brief Called right after the callable of an event has been
+         * executed (not called if it has thrown an exception)
+         */
+        virtual void
+        doOnEventFinished(const Callable& callable);
     };
 
     typedef ObserverInterface<INotification> IObserver;
 
+    /**
+     * @brief Sends onEventStarted or onEventFinished to an observer (for
+     * Subject::forEachObserver)
+     */
+    class EventNotification
+    {
+    public:
+        typedef void (INotification::*Function)(const Callable&);
+
+        EventNotification(Function function, const Callable& callable);
+
+        void
+        operator()(INotification* observer) const;
+
+    private:
+        Function function_;
+
+        const Callable& callable_;
+    };
+
     /**
      * @brief This class ignores all notifiactions
      *
@@ -61,6 +61,19 @@ Interface::cancelEvent(const IEventPtr& event)
     this->doCancelEvent(event);
 }
 
+void
+Interface::cancelEvent(const EventHandle& handle)
+{
+    this->sendCancelEventNotification();
+    this->doCancelEvent(handle);
+}
+
+bool
+Interface::isQueued(const EventHandle& handle) const
+{
+    return this->doIsQueued(handle);
+}
+
 void
 Interface::reset()
 {
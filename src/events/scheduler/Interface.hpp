@@ -30,10 +30,12 @@
 
 #include <WNS/events/scheduler/ICommand.hpp>
 #include <WNS/events/scheduler/IEvent.hpp>
+#include <WNS/events/scheduler/EventHandle.hpp>
 #include <WNS/events/scheduler/Callable.hpp>
 #include <WNS/events/scheduler/INotification.hpp>
 #include <WNS/simulator/Time.hpp>
 #include <WNS/StaticFactory.hpp>
+#include <WNS/PyConfigViewCreator.hpp>
 #include <WNS/NonCopyable.hpp>
 #include <WNS/SubjectInterface.hpp>
 
@@ -123,6 +125,38 @@ namespace wns { namespace events { namespace scheduler {
             return this->doSchedule(callable, at);
         }
 
+        /**
+         * @brief Same as scheduleNow(), but returns a light-weight handle
+         *
+         * This neither allocates an IEvent nor does any reference counting.
+         */
+        EventHandle
+        scheduleNowHandle(const Callable& callable)
+        {
+            this->sendScheduleNowNotification();
+            return this->doScheduleNowHandle(callable);
+        }
+
+        /**
+         * @brief Same as scheduleDelay(), but returns a light-weight handle
+         */
+        EventHandle
+        scheduleDelayHandle(const Callable& callable, wns::simulator::Time delay)
+        {
+            this->sendScheduleDelayNotification();
+            return this->doScheduleHandle(callable, this->getTime() + delay);
+        }
+
+        /**
+         * @brief Same as schedule(), but returns a light-weight handle
+         */
+        EventHandle
+        scheduleHandle(const Callable& callable, wns::simulator::Time at)
+        {
+            this->sendScheduleNotification();
+            return this->doScheduleHandle(callable, at);
+        }
+
          /**
          * @brief Queue a command to be executed as very next event
          */
@@ -150,6 +184,20 @@ namespace wns { namespace events { namespace scheduler {
          */
         void
         cancelEvent(const IEventPtr& event);
+
+        /**
+         * @brief Cancel the event of the given handle.
+         *
+         * Throws IEvent::CancelException if the event is not queued.
+         */
+        void
+        cancelEvent(const EventHandle& handle);
+
+        /**
+         * @brief True if the event of the handle is waiting for execution
+         */
+        bool
+        isQueued(const EventHandle& handle) const;
         //@}
 
         /**
@@ -228,6 +276,12 @@ namespace wns { namespace events { namespace scheduler {
         virtual IEventPtr
         doScheduleNow(const Callable& callable) = 0;
 
+        virtual EventHandle
+        doScheduleHandle(const Callable& callable, wns::simulator::Time at) = 0;
+
+        virtual EventHandle
+        doScheduleNowHandle(const Callable& callable) = 0;
+
         virtual ICommandPtr
         doQueueCommand(const Callable& callable) = 0;
 
@@ -237,6 +291,12 @@ namespace wns { namespace events { namespace scheduler {
         virtual void
         doCancelEvent(const IEventPtr& event) = 0;
 
+        virtual void
+        doCancelEvent(const EventHandle& handle) = 0;
+
+        virtual bool
+        doIsQueued(const EventHandle& handle) const = 0;
+
         virtual void
         doReset() = 0;
 
@@ -278,12 +338,25 @@ namespace wns { namespace events { namespace scheduler {
 
         virtual void
         sendScheduleNowNotification() = 0;
+
+        virtual void
+        sendEventStartedNotification(const Callable& callable) = 0;
+
+        virtual void
+        sendEventFinishedNotification(const Callable& callable) = 0;
         //@}
     };
 
     typedef wns::Creator<wns::events::scheduler::Interface> Creator;
     typedef StaticFactory<wns::events::scheduler::Creator> Factory;
 
+    /**
+     * @brief For schedulers which need to be configured (tried first by the
+     * simulator)
+     */
+    typedef wns::PyConfigViewCreator<wns::events::scheduler::Interface> ConfigCreator;
+    typedef StaticFactory<wns::events::scheduler::ConfigCreator> ConfigFactory;
+
 } // scheduler
 } // events
 } // wns
@@ -38,100 +38,98 @@ STATIC_FACTORY_REGISTER(
 Map::Map() :
     Interface(),
     Subject<INotification>(),
-    simTime_(0.0),
+    simTime_(0),
+    store_(),
     events_(),
     nowItr_(),
     stop_(false),
     commandQueue_()
 {
-    events_[0] = new DiscreteTimeContainer();
+    events_[0];
     nowItr_ = events_.begin();
 }
 
 Map::~Map()
 {
-    while (!events_.empty())
-    {
-        delete events_.begin()->second;
-        events_.erase(events_.begin());
-    }
+}
+
+EventStore::Index
+Map::insertNow(const Callable& callable)
+{
+    EventStore::Index index = store_.allocate(callable, simTime_, simTime_);
+    store_.pushBack(nowItr_->second, index);
+    return index;
+}
+
+EventStore::Index
+Map::insert(const Callable& callable, wns::simulator::Time at)
+{
+    wns::simulator::Tick tick = wns::simulator::toTick(at);
+    EventStore::Index index = store_.allocate(callable, tick, simTime_);
+    // adds a new list if there is none for this point in time
+    store_.pushBack(events_[tick], index);
+    return index;
 }
 
 wns::events::scheduler::IEventPtr
 Map::doScheduleNow(const Callable& callable)
 {
-    EventPtr event (new wns::events::scheduler::Map::Event(callable));
-    event->scheduler_ = this;
-    event->issued_ = getTime();
-    event->scheduled_ = getTime();
-    nowItr_->second->push_back(event);
-    event->state_ = Event::Queued;
-    return event;
+    return store_.getEvent(insertNow(callable), this);
 }
 
 wns::events::scheduler::IEventPtr
 Map::doSchedule(const Callable& callable, wns::simulator::Time at)
 {
-    EventPtr event (new wns::events::scheduler::Map::Event(callable));
-    event->scheduler_ = this;
-    event->issued_ = getTime();
-    event->scheduled_ = at;
-    EventContainer::iterator itr = events_.find(event->getScheduled());
-    if (itr == events_.end())
-    {
-        DiscreteTimeContainer* dtc = new DiscreteTimeContainer();
-        // we need to add a new list
-        dtc->push_back(event);
-        events_[at] = dtc;
-    }
-    else
-    {
-        itr->second->push_back(event);
-    }
-    event->state_ = Event::Queued;
-    return event;
+    return store_.getEvent(insert(callable, at), this);
 }
 
-void
-Map::doCancelMapEventCalledFromMapEvent(const EventPtr& event)
+wns::events::scheduler::EventHandle
+Map::doScheduleNowHandle(const Callable& callable)
 {
-    // we need to notify all obsevers. this is normally done in the Interface,
-    // but this is called directly from the event ...
-    sendNotifies(&INotification::onCancelEvent);
-    doCancelMapEvent(event);
+    return store_.getHandle(insertNow(callable));
+}
+
+wns::events::scheduler::EventHandle
+Map::doScheduleHandle(const Callable& callable, wns::simulator::Time at)
+{
+    return store_.getHandle(insert(callable, at));
 }
 
 void
-Map::doCancelMapEvent(const EventPtr& event)
+Map::doCancelEvent(const IEventPtr& event)
 {
-    if (event->isRunning())
+    EventStore::EventPtr storeEvent (dynamicCast<EventStore::Event>(event));
+    assureNotNull(storeEvent);
+    if (store_.prepareCancel(storeEvent))
     {
-        throw IEvent::CancelException("Event is currently being executed");
-    }
-    else if (event->isCanceled())
-    {
-        throw IEvent::CancelException("Event is already canceled");
+        doCancelEvent(storeEvent->getHandle());
     }
-    else if (event->isFinished())
+}
+
+void
+Map::doCancelEvent(const EventHandle& handle)
+{
+    if (!store_.isValid(handle))
     {
-        throw IEvent::CancelException("Event has already been called");
+        throw IEvent::CancelException("Event is not queued");
     }
-    else if (event->isNotSubmitted())
+
+    EventStore::Index index = store_.getIndex(handle);
+    if (store_.get(index).state == EventStore::Slot::Running)
     {
-        throw IEvent::CancelException("Should never happen");
+        throw IEvent::CancelException("Event is currently being executed");
     }
 
     // this removes the element from the list in the scheduler
-    event->removeFromAllLists();
-    event->state_ = Event::Canceled;
+    store_.unlink(index);
+    store_.release(index, EventStore::Event::Canceled);
 }
 
-void
-Map::doCancelEvent(const IEventPtr& event)
+bool
+Map::doIsQueued(const EventHandle& handle) const
 {
-    EventPtr mapEvent (dynamicCast<Event>(event));
-    assureNotNull(mapEvent);
-    doCancelMapEvent(mapEvent);
+    return store_.isValid(handle) &&
+        store_.get(store_.getIndex(handle)).state == EventStore::Slot::Queued;
 }
 
 bool
@@ -140,7 +138,7 @@ Map::doProcessOneEvent()
     commandQueue_.runCommands();
 
     // search next event
-    while (nowItr_->second->empty())
+    while (nowItr_->second.empty())
     {
         if (events_.size() == 1)
         {
@@ -149,18 +147,18 @@ Map::doProcessOneEvent()
         }
         else
         {
-            delete events_.begin()->second;
             events_.erase(events_.begin());
         }
         nowItr_ = events_.begin();
     }
 
-    assure(!nowItr_->second->empty(), "There MUST be events!");
+    assure(!nowItr_->second.empty(), "There MUST be events!");
 
-    // get next event
-    EventPtr nextEvent = nowItr_->second->front();
+    // get next event (slots don't move in memory)
+    EventStore::Index next = nowItr_->second.first;
+    EventStore::Slot& nextEvent = store_.get(next);
 
-    wns::simulator::Time newTime = nextEvent->getScheduled();
+    wns::simulator::Tick newTime = nextEvent.scheduled;
 
     // run until all now events are processed
     if (simTime_ < newTime)
@@ -169,17 +167,19 @@ Map::doProcessOneEvent()
         {
             return false;
         }
-        onNewSimTime(newTime);
+        onNewSimTime(wns::simulator::fromTick(newTime));
     }
 
     simTime_ = newTime;
 
-    nextEvent->state_ = Event::Running;
-    (*nextEvent)();
-    nextEvent->state_ = Event::Finished;
+    // remove the event, the slot stays allocated until it has been executed
+    store_.unlink(next);
 
-    // remove the event
-    nowItr_->second->pop_front();
+    store_.setRunning(next);
+    sendEventStartedNotification(nextEvent.callable);
+    nextEvent.callable();
+    sendEventFinishedNotification(nextEvent.callable);
+    store_.release(next, EventStore::Event::Finished);
 
     return true;
 }
@@ -187,30 +187,18 @@ Map::doProcessOneEvent()
 void
 Map::doReset()
 {
-    while (!events_.empty())
-    {
-        delete events_.begin()->second;
-        events_.erase(events_.begin());
-    }
-    events_[0] = new DiscreteTimeContainer();
+    store_.clear();
+    events_.clear();
+    events_[0];
     nowItr_ = events_.begin();
-    simTime_ = 0.0;
+    simTime_ = 0;
     commandQueue_.reset();
 }
 
 size_t
 Map::doSize() const
 {
-    size_t size = 0;
-
-    EventContainer::const_iterator itrEnd = events_.end();
-    for (EventContainer::const_iterator itr = events_.begin();
-         itr != itrEnd;
-         ++itr)
-    {
-        size += itr->second->size();
-    }
-    return size;
+    return store_.size();
 }
 
 void
@@ -249,10 +237,28 @@ Map::sendAddEventNotification()
     sendNotifies(&INotification::onAddEvent);
 }
 
+void
+Map::sendEventStartedNotification(const Callable& callable)
+{
+    if (hasObservers())
+    {
+        forEachObserver(EventNotification(&INotification::onEventStarted, callable));
+    }
+}
+
+void
+Map::sendEventFinishedNotification(const Callable& callable)
+{
+    if (hasObservers())
+    {
+        forEachObserver(EventNotification(&INotification::onEventFinished, callable));
+    }
+}
+
 wns::simulator::Time
 Map::doGetTime() const
 {
-    return simTime_;
+    return wns::simulator::fromTick(simTime_);
 }
 
 void
@@ -29,17 +29,18 @@
 #define WNS_EVENTS_SCHEDULER_MAP_HPP
 
 #include <WNS/events/scheduler/Interface.hpp>
-#include <WNS/Subject.hpp>
-#include <WNS/container/FastList.hpp>
-#include <WNS/container/FastListEnabler.hpp>
+#include <WNS/events/scheduler/EventStore.hpp>
 #include <WNS/events/scheduler/CommandQueue.hpp>
+#include <WNS/Subject.hpp>
 
 #include <map>
-#include <list>
 
 namespace wns { namespace events { namespace scheduler {
     /**
      * @brief Implementation based on std::map
+     *
+     * The events themselves are kept in an EventStore, the map only holds
+     * the heads of the per point in time lists.
      */
     class Map :
         public Interface,
@@ -55,96 +56,6 @@ namespace wns { namespace events { namespace scheduler {
         ~Map();
 
     protected:
-        class Event :
-            public virtual IEvent,
-            public wns::container::SingleFastListEnabler< wns::SmartPtr<Event> >
-        {
-        public:
-            Event(const Callable& callable) :
-                callable_(callable),
-                scheduled_(0),
-                issued_(0),
-                scheduler_(NULL),
-                state_(NotSubmitted)
-            {
-            }
-
-            enum State
-            {
-                NotSubmitted,
-                Queued,
-                Running,
-                Finished,
-                Canceled
-            };
-
-            virtual void
-            cancel()
-            {
-                scheduler_->doCancelMapEventCalledFromMapEvent(EventPtr(this));
-            }
-
-            virtual bool
-            isNotSubmitted() const
-            {
-                return NotSubmitted == state_;
-            }
-
-            virtual bool
-            isQueued() const
-            {
-                return Queued == state_;
-            }
-
-            virtual bool
-            isRunning() const
-            {
-                return Running == state_;
-            }
-
-            virtual bool
-            isFinished() const
-            {
-                return Finished == state_;
-            }
-
-            virtual bool
-            isCanceled() const
-            {
-                return Canceled == state_;
-            }
-
-            void
-            operator()()
-            {
-                callable_();
-            }
-
-            wns::simulator::Time
-            getScheduled() const
-            {
-                return scheduled_;
-            }
-
-            wns::simulator::Time
-            getIssued() const
-            {
-                return issued_;
-            }
-
-            Callable callable_;
-
-            wns::simulator::Time scheduled_;
-
-            wns::simulator::Time issued_;
-
-            Map* scheduler_;
-
-            State state_;
-        };
-
-        typedef wns::SmartPtr<Event> EventPtr;
-
         /**
          * @name NVI implementation
          */
@@ -170,6 +81,18 @@ namespace wns { namespace events { namespace scheduler {
         virtual IEventPtr
         doSchedule(const Callable& callable, wns::simulator::Time at);
 
+        virtual EventHandle
+        doScheduleNowHandle(const Callable& callable);
+
+        virtual EventHandle
+        doScheduleHandle(const Callable& callable, wns::simulator::Time at);
+
+        virtual void
+        doCancelEvent(const EventHandle& handle);
+
+        virtual bool
+        doIsQueued(const EventHandle& handle) const;
+
         virtual size_t
         doSize() const;
 
@@ -204,17 +127,29 @@ namespace wns { namespace events { namespace scheduler {
 
         virtual void
         sendAddEventNotification();
+
+        virtual void
+        sendEventStartedNotification(const Callable& callable);
+
+        virtual void
+        sendEventFinishedNotification(const Callable& callable);
         //@}
 
         /**
          * @name Internal helpers
          */
         //{@
-        void
-        doCancelMapEventCalledFromMapEvent(const EventPtr& event);
+        /**
+         * @brief Store and append to the list of its point in time
+         */
+        EventStore::Index
+        insert(const Callable& callable, wns::simulator::Time at);
 
-        void
-        doCancelMapEvent(const EventPtr& event);
+        /**
+         * @brief Store and append to the list of the current point in time
+         */
+        EventStore::Index
+        insertNow(const Callable& callable);
         //@}
 
         /**
@@ -226,14 +161,13 @@ namespace wns { namespace events { namespace scheduler {
         }
 
         // MEMBER
-        wns::simulator::Time simTime_;
-
-        typedef wns::container::FastList<EventPtr> DiscreteTimeContainer;
-        // we must use a pointer to the discrete time container, otherwise it
-        // will be copied around and since it is SingleFastListEnable this will
-        // result in a run-time error. It would be nice, if this could be turned
-        // into a compile-time error.
-        typedef std::map<wns::simulator::Time, DiscreteTimeContainer*> EventContainer;
+        wns::simulator::Tick simTime_;
+
+        EventStore store_;
+
+        // std::map does not move its values, thus the lists may be
+        // referenced by the slots of the store
+        typedef std::map<wns::simulator::Tick, EventStore::List> EventContainer;
 
         EventContainer events_;
 
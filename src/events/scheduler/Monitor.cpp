@@ -36,8 +36,15 @@ Monitor::Monitor(const wns::pyconfig::View& configuration) :
     canceledEvents_(0),
     scheduledNowEvents_(0),
     scheduledEvents_(0),
-    scheduledDelayEvents_(0)
+    scheduledDelayEvents_(0),
+    profile_(),
+    profileFileName_()
 {
+    if (configuration.get<bool>("profile"))
+    {
+        profile_.reset(new EventProfile(configuration.get<int>("profileSamplingInterval")));
+        profileFileName_ = configuration.get<std::string>("profileFileName");
+    }
 }
 
 void
@@ -56,6 +63,31 @@ Monitor::logStatistics()
 
 }
 
+bool
+Monitor::isProfiling() const
+{
+    return profile_.get() != NULL;
+}
+
+const EventProfile*
+Monitor::getProfile() const
+{
+    return profile_.get();
+}
+
+std::string
+Monitor::getProfileFileName() const
+{
+    return profileFileName_;
+}
+
+void
+Monitor::writeProfile(std::ostream& out) const
+{
+    assure(isProfiling(), "Profiling is disabled");
+    profile_->write(out);
+}
+
 void
 Monitor::doOnProcessOneEvent()
 {
@@ -95,3 +127,21 @@ void
 Monitor::doOnAddEvent()
 {
 }
+
+void
+Monitor::doOnEventStarted(const Callable& callable)
+{
+    if (profile_.get() != NULL)
+    {
+        profile_->onEventStarted(callable);
+    }
+}
+
+void
+Monitor::doOnEventFinished(const Callable& callable)
+{
+    if (profile_.get() != NULL)
+    {
+        profile_->onEventFinished(callable);
+    }
+}
@@ -32,6 +32,9 @@
 #include <WNS/Observer.hpp>
 #include <WNS/logger/Logger.hpp>
 #include <WNS/events/scheduler/INotification.hpp>
+#include <WNS/events/scheduler/EventProfile.hpp>
+
+#include <memory>
 
 namespace wns { namespace events { namespace scheduler {
 
@@ -39,6 +42,11 @@ namespace wns { namespace events { namespace scheduler {
      * @brief Collects some statistics about the event scheduler and logs to
      * master logger
      *
+     * If "profile" is set, the processed events are additionally attributed
+     * to the type (or tag) of their callable (see EventProfile). The
+     * application writes this profile to "profileFileName" in the output
+     * directory at shutdown.
+     *
      * @author Marc Schinnenburg <marc@schinnenburg.com>
      */
     class Monitor :
@@ -51,6 +59,21 @@ namespace wns { namespace events { namespace scheduler {
         void
         logStatistics();
 
+        bool
+        isProfiling() const;
+
+        /**
+         * @brief NULL if profiling is disabled
+         */
+        const EventProfile*
+        getProfile() const;
+
+        std::string
+        getProfileFileName() const;
+
+        void
+        writeProfile(std::ostream& out) const;
+
     private:
         virtual void
         doOnProcessOneEvent();
@@ -70,12 +93,20 @@ namespace wns { namespace events { namespace scheduler {
         virtual void
         doOnAddEvent();
 
+        virtual void
+        doOnEventStarted(const Callable& callable);
+
+        virtual void
+        doOnEventFinished(const Callable& callable);
+
         wns::logger::Logger logger_;
         long long int processedEvents_;
         long long int canceledEvents_;
         long long int scheduledNowEvents_;
         long long int scheduledEvents_;
         long long int scheduledDelayEvents_;
+        std::auto_ptr<EventProfile> profile_;
+        std::string profileFileName_;
     };
 
 } // scheduler
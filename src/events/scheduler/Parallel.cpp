@@ -0,0 +1,826 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/events/scheduler/Parallel.hpp>
+#include <WNS/Exception.hpp>
+
+#include <limits>
+
+using namespace wns::events::scheduler;
+
+STATIC_FACTORY_REGISTER(
+    Parallel,
+    Interface,
+    "wns.events.scheduler.Parallel");
+
+STATIC_FACTORY_REGISTER_WITH_CREATOR(
+    Parallel,
+    Interface,
+    "wns.events.scheduler.Parallel",
+    wns::PyConfigViewCreator);
+
+namespace {
+    // the LP executing an event in this thread
+    __thread void* currentLogicalProcess = NULL;
+
+    // the origin of an event key: issuing LP (upper bits) and its sequence
+    // number (lower bits)
+    const int sequenceBits = 40;
+
+    const unsigned long long int externalOrigin = (1ULL << (64 - sequenceBits)) - 1;
+
+    const wns::simulator::Tick never = std::numeric_limits<wns::simulator::Tick>::max();
+}
+
+Parallel::LogicalProcess::LogicalProcess(Parallel* _scheduler, LogicalProcessId _id) :
+    scheduler(_scheduler),
+    id(_id),
+    store(_id),
+    queue(),
+    now(0),
+    sequence(0),
+    outbox()
+{
+}
+
+Parallel::Parallel() :
+    Interface(),
+    Subject<INotification>(),
+    lookahead_(0),
+    numberOfThreads_(1),
+    simTime_(0),
+    stop_(false),
+    stopAt_(never),
+    commandQueue_(),
+    logicalProcesses_(),
+    externalSequence_(0),
+    windowEnd_(0),
+    windowInclusive_(false),
+    concurrent_(false),
+    active_(),
+    nextActive_(0),
+    error_(),
+    workers_(),
+    window_(0),
+    firstWindow_(0),
+    busyWorkers_(0),
+    shutdown_(false)
+{
+    pthread_mutex_init(&mutex_, NULL);
+    pthread_cond_init(&windowStarted_, NULL);
+    pthread_cond_init(&windowFinished_, NULL);
+    pthread_mutex_init(&observerMutex_, NULL);
+}
+
+Parallel::Parallel(wns::simulator::Time lookahead, int numberOfThreads) :
+    Interface(),
+    Subject<INotification>(),
+    lookahead_(wns::simulator::toTick(lookahead)),
+    numberOfThreads_(numberOfThreads),
+    simTime_(0),
+    stop_(false),
+    stopAt_(never),
+    commandQueue_(),
+    logicalProcesses_(),
+    externalSequence_(0),
+    windowEnd_(0),
+    windowInclusive_(false),
+    concurrent_(false),
+    active_(),
+    nextActive_(0),
+    error_(),
+    workers_(),
+    window_(0),
+    firstWindow_(0),
+    busyWorkers_(0),
+    shutdown_(false)
+{
+    assure(lookahead_ >= 0, "The lookahead must not be negative");
+    assure(numberOfThreads_ >= 1, "At least one thread is needed");
+    pthread_mutex_init(&mutex_, NULL);
+    pthread_cond_init(&windowStarted_, NULL);
+    pthread_cond_init(&windowFinished_, NULL);
+    pthread_mutex_init(&observerMutex_, NULL);
+}
+
+Parallel::Parallel(const wns::pyconfig::View& config) :
+    Interface(),
+    Subject<INotification>(),
+    lookahead_(wns::simulator::toTick(config.get<wns::simulator::Time>("lookahead"))),
+    numberOfThreads_(config.get<int>("numberOfThreads")),
+    simTime_(0),
+    stop_(false),
+    stopAt_(never),
+    commandQueue_(),
+    logicalProcesses_(),
+    externalSequence_(0),
+    windowEnd_(0),
+    windowInclusive_(false),
+    concurrent_(false),
+    active_(),
+    nextActive_(0),
+    error_(),
+    workers_(),
+    window_(0),
+    firstWindow_(0),
+    busyWorkers_(0),
+    shutdown_(false)
+{
+    assure(lookahead_ >= 0, "The lookahead must not be negative");
+    assure(numberOfThreads_ >= 1, "At least one thread is needed");
+    pthread_mutex_init(&mutex_, NULL);
+    pthread_cond_init(&windowStarted_, NULL);
+    pthread_cond_init(&windowFinished_, NULL);
+    pthread_mutex_init(&observerMutex_, NULL);
+}
+
+Parallel::~Parallel()
+{
+    stopWorkers();
+
+    for (std::vector<LogicalProcess*>::iterator itr = logicalProcesses_.begin();
+         itr != logicalProcesses_.end();
+         ++itr)
+    {
+        delete *itr;
+    }
+
+    pthread_mutex_destroy(&observerMutex_);
+    pthread_cond_destroy(&windowFinished_);
+    pthread_cond_destroy(&windowStarted_);
+    pthread_mutex_destroy(&mutex_);
+}
+
+void
+Parallel::scheduleOn(LogicalProcessId lp, const Callable& callable, wns::simulator::Time at)
+{
+    sendScheduleNotification();
+
+    wns::simulator::Tick tick = wns::simulator::toTick(at);
+
+    LogicalProcess* sender = current();
+    if (sender == NULL || sender->id == lp)
+    {
+        EventStore::Index index;
+        insert(lp, callable, newKey(tick), index);
+        return;
+    }
+
+    if (tick < sender->now + lookahead_)
+    {
+        throw wns::Exception("Events for other logical processes must not be "
+                             "scheduled closer than the lookahead");
+    }
+
+    if (concurrent_)
+    {
+        // delivered at the end of the window
+        sender->outbox.push_back(Message(lp, callable, newKey(tick)));
+    }
+    else
+    {
+        EventStore::Index index;
+        insert(lp, callable, newKey(tick), index);
+    }
+}
+
+void
+Parallel::scheduleDelayOn(LogicalProcessId lp, const Callable& callable, wns::simulator::Time delay)
+{
+    scheduleOn(lp, callable, getTime() + delay);
+}
+
+Parallel::LogicalProcessId
+Parallel::getCurrentLogicalProcess() const
+{
+    LogicalProcess* lp = current();
+    return lp != NULL ? lp->id : 0;
+}
+
+wns::events::scheduler::IEventPtr
+Parallel::doScheduleNow(const Callable& callable)
+{
+    return doSchedule(callable, getTime());
+}
+
+wns::events::scheduler::IEventPtr
+Parallel::doSchedule(const Callable& callable, wns::simulator::Time at)
+{
+    EventStore::Index index;
+    LogicalProcess* lp = scheduleLocal(callable, wns::simulator::toTick(at), index);
+    return lp->store.getEvent(index, this);
+}
+
+wns::events::scheduler::EventHandle
+Parallel::doScheduleNowHandle(const Callable& callable)
+{
+    return doScheduleHandle(callable, getTime());
+}
+
+wns::events::scheduler::EventHandle
+Parallel::doScheduleHandle(const Callable& callable, wns::simulator::Time at)
+{
+    EventStore::Index index;
+    LogicalProcess* lp = scheduleLocal(callable, wns::simulator::toTick(at), index);
+    return lp->store.getHandle(index);
+}
+
+void
+Parallel::doCancelEvent(const IEventPtr& event)
+{
+    EventStore::EventPtr storeEvent (dynamicCast<EventStore::Event>(event));
+    assureNotNull(storeEvent);
+    if (EventStore::prepareCancel(storeEvent))
+    {
+        doCancelEvent(storeEvent->getHandle());
+    }
+}
+
+void
+Parallel::doCancelEvent(const EventHandle& handle)
+{
+    LogicalProcess* lp = find(EventStore::getPartition(handle));
+    if (lp == NULL || !lp->store.isValid(handle))
+    {
+        throw IEvent::CancelException("Event is not queued");
+    }
+
+    assure(!concurrent_ || lp == current(),
+           "Events of other logical processes can't be canceled during a parallel window");
+
+    EventStore::Index index = lp->store.getIndex(handle);
+    EventStore::Slot& slot = lp->store.get(index);
+    if (slot.state == EventStore::Slot::Running)
+    {
+        throw IEvent::CancelException("Event is currently being executed");
+    }
+
+    lp->queue.erase(Key(slot.scheduled, slot.issued, slot.key));
+    lp->store.release(index, EventStore::Event::Canceled);
+}
+
+bool
+Parallel::doIsQueued(const EventHandle& handle) const
+{
+    LogicalProcess* lp = find(EventStore::getPartition(handle));
+    return lp != NULL &&
+        lp->store.isValid(handle) &&
+        lp->store.get(lp->store.getIndex(handle)).state == EventStore::Slot::Queued;
+}
+
+bool
+Parallel::doProcessOneEvent()
+{
+    commandQueue_.runCommands();
+
+    LogicalProcess* lp = earliest();
+    if (lp == NULL)
+    {
+        // No more events left!
+        return false;
+    }
+
+    wns::simulator::Tick newTime = lp->queue.begin()->first.at;
+    if (newTime > stopAt_ || (simTime_ < newTime && stop_))
+    {
+        return false;
+    }
+
+    simTime_ = newTime;
+    runOneEvent(lp);
+    return true;
+}
+
+void
+Parallel::doStart()
+{
+    if (lookahead_ > 0)
+    {
+        while(processOneWindow());
+    }
+    else
+    {
+        while(processOneEvent());
+    }
+}
+
+void
+Parallel::doStop()
+{
+    stop_ = true;
+}
+
+void
+Parallel::doStopAt(const wns::simulator::Time& time)
+{
+    stopAt_ = std::min(stopAt_, wns::simulator::toTick(time));
+}
+
+void
+Parallel::doReset()
+{
+    assure(!concurrent_, "Can't reset during a parallel window");
+
+    for (std::vector<LogicalProcess*>::iterator itr = logicalProcesses_.begin();
+         itr != logicalProcesses_.end();
+         ++itr)
+    {
+        LogicalProcess* lp = *itr;
+        if (lp != NULL)
+        {
+            lp->queue.clear();
+            lp->store.clear();
+            lp->outbox.clear();
+            lp->now = 0;
+            lp->sequence = 0;
+        }
+    }
+    externalSequence_ = 0;
+    simTime_ = 0;
+    stopAt_ = never;
+    commandQueue_.reset();
+}
+
+size_t
+Parallel::doSize() const
+{
+    size_t size = 0;
+    for (std::vector<LogicalProcess*>::const_iterator itr = logicalProcesses_.begin();
+         itr != logicalProcesses_.end();
+         ++itr)
+    {
+        if (*itr != NULL)
+        {
+            size += (*itr)->store.size() + (*itr)->outbox.size();
+        }
+    }
+    return size;
+}
+
+wns::simulator::Time
+Parallel::doGetTime() const
+{
+    LogicalProcess* lp = current();
+    return wns::simulator::fromTick(lp != NULL ? lp->now : simTime_);
+}
+
+wns::events::scheduler::ICommandPtr
+Parallel::doQueueCommand(const Callable& callable)
+{
+    return commandQueue_.queueCommand(callable);
+}
+
+void
+Parallel::doDequeueCommand(const ICommandPtr& command)
+{
+    return commandQueue_.dequeueCommand(command);
+}
+
+void
+Parallel::sendProcessOneEventNotification()
+{
+    notify(&INotification::onProcessOneEvent);
+}
+
+void
+Parallel::sendCancelEventNotification()
+{
+    notify(&INotification::onCancelEvent);
+}
+
+void
+Parallel::sendScheduleNotification()
+{
+    notify(&INotification::onSchedule);
+}
+
+void
+Parallel::sendScheduleNowNotification()
+{
+    notify(&INotification::onScheduleNow);
+}
+
+void
+Parallel::sendScheduleDelayNotification()
+{
+    notify(&INotification::onScheduleDelay);
+}
+
+void
+Parallel::sendAddEventNotification()
+{
+    notify(&INotification::onAddEvent);
+}
+
+void
+Parallel::sendEventStartedNotification(const Callable& callable)
+{
+    notify(&INotification::onEventStarted, callable);
+}
+
+void
+Parallel::sendEventFinishedNotification(const Callable& callable)
+{
+    notify(&INotification::onEventFinished, callable);
+}
+
+void
+Parallel::notify(void (INotification::*notification)())
+{
+    if (concurrent_)
+    {
+        pthread_mutex_lock(&observerMutex_);
+        try
+        {
+            sendNotifies(notification);
+        }
+        catch(...)
+        {
+            pthread_mutex_unlock(&observerMutex_);
+            throw;
+        }
+        pthread_mutex_unlock(&observerMutex_);
+    }
+    else
+    {
+        sendNotifies(notification);
+    }
+}
+
+void
+Parallel::notify(EventNotification::Function notification, const Callable& callable)
+{
+    if (!hasObservers())
+    {
+        return;
+    }
+
+    if (concurrent_)
+    {
+        pthread_mutex_lock(&observerMutex_);
+        try
+        {
+            forEachObserver(EventNotification(notification, callable));
+        }
+        catch(...)
+        {
+            pthread_mutex_unlock(&observerMutex_);
+            throw;
+        }
+        pthread_mutex_unlock(&observerMutex_);
+    }
+    else
+    {
+        forEachObserver(EventNotification(notification, callable));
+    }
+}
+
+Parallel::LogicalProcess*
+Parallel::current() const
+{
+    LogicalProcess* lp = static_cast<LogicalProcess*>(currentLogicalProcess);
+    return (lp != NULL && lp->scheduler == this) ? lp : NULL;
+}
+
+Parallel::LogicalProcess*
+Parallel::find(LogicalProcessId id) const
+{
+    return id < logicalProcesses_.size() ? logicalProcesses_[id] : NULL;
+}
+
+Parallel::LogicalProcess*
+Parallel::getLogicalProcess(LogicalProcessId id)
+{
+    LogicalProcess* lp = find(id);
+    if (lp == NULL)
+    {
+        assure(!concurrent_, "Logical processes can't be added during a parallel window");
+        assure(id < externalOrigin, "Logical process id too large");
+        if (id >= logicalProcesses_.size())
+        {
+            logicalProcesses_.resize(id + 1, NULL);
+        }
+        lp = new LogicalProcess(this, id);
+        logicalProcesses_[id] = lp;
+    }
+    return lp;
+}
+
+Parallel::Key
+Parallel::newKey(wns::simulator::Tick at)
+{
+    LogicalProcess* lp = current();
+    if (lp != NULL)
+    {
+        return Key(at, lp->now, (static_cast<unsigned long long int>(lp->id) << sequenceBits) | lp->sequence++);
+    }
+    return Key(at, simTime_, (externalOrigin << sequenceBits) | externalSequence_++);
+}
+
+Parallel::LogicalProcess*
+Parallel::insert(LogicalProcessId id, const Callable& callable, const Key& key, EventStore::Index& index)
+{
+    LogicalProcess* lp = getLogicalProcess(id);
+    index = lp->store.allocate(callable, key.at, key.issued);
+    lp->store.get(index).key = static_cast<long long int>(key.origin);
+    lp->queue.insert(std::make_pair(key, index));
+    return lp;
+}
+
+Parallel::LogicalProcess*
+Parallel::scheduleLocal(const Callable& callable, wns::simulator::Tick at, EventStore::Index& index)
+{
+    LogicalProcess* lp = current();
+    return insert(lp != NULL ? lp->id : 0, callable, newKey(at), index);
+}
+
+Parallel::LogicalProcess*
+Parallel::earliest() const
+{
+    LogicalProcess* earliest = NULL;
+    for (std::vector<LogicalProcess*>::const_iterator itr = logicalProcesses_.begin();
+         itr != logicalProcesses_.end();
+         ++itr)
+    {
+        LogicalProcess* lp = *itr;
+        if (lp != NULL && !lp->queue.empty() &&
+            (earliest == NULL || lp->queue.begin()->first < earliest->queue.begin()->first))
+        {
+            earliest = lp;
+        }
+    }
+    return earliest;
+}
+
+void
+Parallel::runOneEvent(LogicalProcess* lp)
+{
+    std::map<Key, EventStore::Index>::iterator first = lp->queue.begin();
+    EventStore::Index index = first->second;
+    lp->now = first->first.at;
+    lp->queue.erase(first);
+
+    // slots don't move in memory
+    EventStore::Slot& slot = lp->store.get(index);
+
+    void* previous = currentLogicalProcess;
+    currentLogicalProcess = lp;
+    lp->store.setRunning(index);
+    try
+    {
+        sendEventStartedNotification(slot.callable);
+        slot.callable();
+        sendEventFinishedNotification(slot.callable);
+    }
+    catch(...)
+    {
+        // the event has been executed (though not successfully), so its
+        // slot must not stay claimed as running
+        currentLogicalProcess = previous;
+        lp->store.release(index, EventStore::Event::Finished);
+        throw;
+    }
+    currentLogicalProcess = previous;
+    lp->store.release(index, EventStore::Event::Finished);
+}
+
+void
+Parallel::runWindow(LogicalProcess* lp)
+{
+    while (!lp->queue.empty() && isInWindow(lp->queue.begin()->first.at))
+    {
+        sendProcessOneEventNotification();
+        runOneEvent(lp);
+    }
+}
+
+bool
+Parallel::processOneWindow()
+{
+    commandQueue_.runCommands();
+
+    LogicalProcess* first = earliest();
+    if (first == NULL)
+    {
+        // No more events left!
+        return false;
+    }
+
+    wns::simulator::Tick next = first->queue.begin()->first.at;
+    if (next > stopAt_ || (simTime_ < next && stop_))
+    {
+        return false;
+    }
+
+    windowEnd_ = next + lookahead_;
+    windowInclusive_ = false;
+    if (stopAt_ < windowEnd_)
+    {
+        windowEnd_ = stopAt_;
+        windowInclusive_ = true;
+    }
+
+    active_.clear();
+    for (std::vector<LogicalProcess*>::const_iterator itr = logicalProcesses_.begin();
+         itr != logicalProcesses_.end();
+         ++itr)
+    {
+        if (*itr != NULL && !(*itr)->queue.empty() && isInWindow((*itr)->queue.begin()->first.at))
+        {
+            active_.push_back(*itr);
+        }
+    }
+
+    if (numberOfThreads_ > 1 && active_.size() > 1)
+    {
+        startWorkers();
+
+        concurrent_ = true;
+        nextActive_ = 0;
+        error_.clear();
+
+        pthread_mutex_lock(&mutex_);
+        busyWorkers_ = workers_.size();
+        ++window_;
+        pthread_cond_broadcast(&windowStarted_);
+        pthread_mutex_unlock(&mutex_);
+
+        work();
+
+        pthread_mutex_lock(&mutex_);
+        while (busyWorkers_ > 0)
+        {
+            pthread_cond_wait(&windowFinished_, &mutex_);
+        }
+        pthread_mutex_unlock(&mutex_);
+
+        concurrent_ = false;
+
+        // deliver the messages (the order does not matter, it is defined by
+        // their keys)
+        for (size_t ii = 0; ii < logicalProcesses_.size(); ++ii)
+        {
+            LogicalProcess* lp = logicalProcesses_[ii];
+            if (lp == NULL)
+            {
+                continue;
+            }
+            for (std::vector<Message>::const_iterator itr = lp->outbox.begin();
+                 itr != lp->outbox.end();
+                 ++itr)
+            {
+                EventStore::Index index;
+                insert(itr->target, itr->callable, itr->key, index);
+            }
+            lp->outbox.clear();
+        }
+
+        if (!error_.empty())
+        {
+            throw wns::Exception(error_);
+        }
+    }
+    else
+    {
+        for (std::vector<LogicalProcess*>::const_iterator itr = active_.begin();
+             itr != active_.end();
+             ++itr)
+        {
+            runWindow(*itr);
+        }
+    }
+
+    for (std::vector<LogicalProcess*>::const_iterator itr = active_.begin();
+         itr != active_.end();
+         ++itr)
+    {
+        simTime_ = std::max(simTime_, (*itr)->now);
+    }
+    return true;
+}
+
+void
+Parallel::work()
+{
+    for (;;)
+    {
+        int ii = __sync_fetch_and_add(&nextActive_, 1);
+        if (ii >= static_cast<int>(active_.size()))
+        {
+            return;
+        }
+
+        try
+        {
+            runWindow(active_[ii]);
+        }
+        catch (const std::exception& e)
+        {
+            pthread_mutex_lock(&mutex_);
+            if (error_.empty())
+            {
+                error_ = e.what();
+            }
+            pthread_mutex_unlock(&mutex_);
+        }
+        catch (...)
+        {
+            pthread_mutex_lock(&mutex_);
+            if (error_.empty())
+            {
+                error_ = "Unknown exception in a logical process";
+            }
+            pthread_mutex_unlock(&mutex_);
+        }
+    }
+}
+
+void
+Parallel::startWorkers()
+{
+    if (!workers_.empty())
+    {
+        return;
+    }
+
+    // the calling thread works, too
+    firstWindow_ = window_;
+    workers_.resize(numberOfThreads_ - 1);
+    for (size_t ii = 0; ii < workers_.size(); ++ii)
+    {
+        pthread_create(&workers_[ii], NULL, &Parallel::workerMain, this);
+    }
+}
+
+void
+Parallel::stopWorkers()
+{
+    pthread_mutex_lock(&mutex_);
+    shutdown_ = true;
+    pthread_cond_broadcast(&windowStarted_);
+    pthread_mutex_unlock(&mutex_);
+
+    for (size_t ii = 0; ii < workers_.size(); ++ii)
+    {
+        pthread_join(workers_[ii], NULL);
+    }
+    workers_.clear();
+}
+
+void*
+Parallel::workerMain(void* arg)
+{
+    Parallel* scheduler = static_cast<Parallel*>(arg);
+
+    pthread_mutex_lock(&scheduler->mutex_);
+    unsigned long int window = scheduler->firstWindow_;
+    for (;;)
+    {
+        while (scheduler->window_ == window && !scheduler->shutdown_)
+        {
+            pthread_cond_wait(&scheduler->windowStarted_, &scheduler->mutex_);
+        }
+
+        if (scheduler->shutdown_)
+        {
+            break;
+        }
+
+        window = scheduler->window_;
+        pthread_mutex_unlock(&scheduler->mutex_);
+
+        scheduler->work();
+
+        pthread_mutex_lock(&scheduler->mutex_);
+        if (--scheduler->busyWorkers_ == 0)
+        {
+            pthread_cond_signal(&scheduler->windowFinished_);
+        }
+    }
+    pthread_mutex_unlock(&scheduler->mutex_);
+    return NULL;
+}
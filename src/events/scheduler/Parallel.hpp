@@ -0,0 +1,453 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_EVENTS_SCHEDULER_PARALLEL_HPP
+#define WNS_EVENTS_SCHEDULER_PARALLEL_HPP
+
+#include <WNS/events/scheduler/Interface.hpp>
+#include <WNS/events/scheduler/EventStore.hpp>
+#include <WNS/events/scheduler/CommandQueue.hpp>
+#include <WNS/pyconfig/View.hpp>
+#include <WNS/Subject.hpp>
+
+#include <pthread.h>
+#include <map>
+#include <vector>
+#include <string>
+
+namespace wns { namespace events { namespace scheduler {
+
+    /**
+     * @brief Conservative parallel scheduler (window based)
+     *
+     * The events are partitioned into logical processes (LP), e.g. one per
+     * node (use the node id as LP id). Events scheduled with the normal
+     * Interface methods belong to the LP of the event which is currently
+     * executed (LP 0 if scheduled from outside an event). Events for other
+     * LPs are sent with scheduleOn() / scheduleDelayOn() and must be at least
+     * "lookahead" seconds in the future (e.g. the minimum channel delay).
+     *
+     * start() executes the simulation in windows [t, t + lookahead), where t
+     * is the time of the earliest pending event: within a window the LPs
+     * can't influence each other, thus they are processed by a pool of
+     * worker threads. Events for other LPs are collected and delivered at
+     * the end of the window.
+     *
+     * Each LP orders its events by (time, time of scheduling, issuing LP,
+     * sequence number of the issuing LP), which does not depend on the number
+     * of threads. Thus the results are identical for any number of threads
+     * (and to processOneEvent(), which executes the globally earliest event
+     * sequentially). They equal the results of Map as long as events of one
+     * LP for the same point in time are not scheduled by different LPs at the
+     * same point in time.
+     *
+     * @note Model code running in different LPs must not share mutable state
+     * (e.g. random number generators) if more than one thread is used.
+     * Observers of the scheduler are notified from the worker threads (one at
+     * a time).
+     *
+     * Events for other LPs are messages: they can't be canceled. Events of
+     * an LP may only be canceled from within the same LP while a window is
+     * executed.
+     */
+    class Parallel :
+        public Interface,
+        public Subject<INotification>
+    {
+    public:
+        typedef uint32_t LogicalProcessId;
+
+        /**
+         * @brief Sequential execution (no lookahead, one thread)
+         */
+        Parallel();
+
+        Parallel(wns::simulator::Time lookahead, int numberOfThreads);
+
+        explicit
+        Parallel(const wns::pyconfig::View& config);
+
+        virtual
+        ~Parallel();
+
+        /**
+         * @brief Schedule an event for the LP "lp" at time "at"
+         */
+        void
+        scheduleOn(LogicalProcessId lp, const Callable& callable, wns::simulator::Time at);
+
+        /**
+         * @brief Schedule an event for the LP "lp" after "delay" seconds
+         */
+        void
+        scheduleDelayOn(LogicalProcessId lp, const Callable& callable, wns::simulator::Time delay);
+
+        /**
+         * @brief The LP of the event currently executed (0 outside events)
+         */
+        LogicalProcessId
+        getCurrentLogicalProcess() const;
+
+        wns::simulator::Time
+        getLookahead() const
+        {
+            return wns::simulator::fromTick(lookahead_);
+        }
+
+        int
+        getNumberOfThreads() const
+        {
+            return numberOfThreads_;
+        }
+
+    private:
+        /**
+         * @brief Order of the events of an LP
+         */
+        struct Key
+        {
+            Key(wns::simulator::Tick _at, wns::simulator::Tick _issued, unsigned long long int _origin) :
+                at(_at),
+                issued(_issued),
+                origin(_origin)
+            {
+            }
+
+            bool
+            operator<(const Key& other) const
+            {
+                if (at != other.at) return at < other.at;
+                if (issued != other.issued) return issued < other.issued;
+                return origin < other.origin;
+            }
+
+            wns::simulator::Tick at;
+
+            wns::simulator::Tick issued;
+
+            /**
+             * @brief Issuing LP (upper bits) and its sequence number
+             */
+            unsigned long long int origin;
+        };
+
+        /**
+         * @brief An event for another LP, issued during a parallel window
+         */
+        struct Message
+        {
+            Message(LogicalProcessId _target, const Callable& _callable, const Key& _key) :
+                target(_target),
+                callable(_callable),
+                key(_key)
+            {
+            }
+
+            LogicalProcessId target;
+
+            Callable callable;
+
+            Key key;
+        };
+
+        struct LogicalProcess
+        {
+            LogicalProcess(Parallel* _scheduler, LogicalProcessId _id);
+
+            Parallel* scheduler;
+
+            LogicalProcessId id;
+
+            EventStore store;
+
+            std::map<Key, EventStore::Index> queue;
+
+            wns::simulator::Tick now;
+
+            unsigned long long int sequence;
+
+            std::vector<Message> outbox;
+        };
+
+        /**
+         * @name NVI implementation
+         */
+        //{@
+        virtual void
+        doReset();
+
+        virtual wns::simulator::Time
+        doGetTime() const;
+
+        virtual void
+        doStop();
+
+        /**
+         * @brief The last window ends (inclusively) at "time"
+         */
+        virtual void
+        doStopAt(const wns::simulator::Time& time);
+
+        virtual void
+        doStart();
+
+        virtual void
+        doCancelEvent(const IEventPtr& event);
+
+        virtual void
+        doCancelEvent(const EventHandle& handle);
+
+        virtual bool
+        doIsQueued(const EventHandle& handle) const;
+
+        virtual IEventPtr
+        doScheduleNow(const Callable& callable);
+
+        virtual IEventPtr
+        doSchedule(const Callable& callable, wns::simulator::Time at);
+
+        virtual EventHandle
+        doScheduleNowHandle(const Callable& callable);
+
+        virtual EventHandle
+        doScheduleHandle(const Callable& callable, wns::simulator::Time at);
+
+        virtual size_t
+        doSize() const;
+
+        virtual bool
+        doProcessOneEvent();
+
+        virtual ICommandPtr
+        doQueueCommand(const Callable& callable);
+
+        virtual void
+        doDequeueCommand(const ICommandPtr& command);
+        //@}
+
+        /**
+         * @name Scheduler observation
+         */
+        //{@
+        virtual void
+        sendProcessOneEventNotification();
+
+        virtual void
+        sendCancelEventNotification();
+
+        virtual void
+        sendScheduleNotification();
+
+        virtual void
+        sendScheduleDelayNotification();
+
+        virtual void
+        sendScheduleNowNotification();
+
+        virtual void
+        sendAddEventNotification();
+
+        virtual void
+        sendEventStartedNotification(const Callable& callable);
+
+        virtual void
+        sendEventFinishedNotification(const Callable& callable);
+
+        void
+        notify(void (INotification::*notification)());
+
+        void
+        notify(EventNotification::Function notification, const Callable& callable);
+        //@}
+
+        /**
+         * @name Internal helpers
+         */
+        //{@
+        /**
+         * @brief The LP executing an event in this thread (NULL if none)
+         */
+        LogicalProcess*
+        current() const;
+
+        /**
+         * @brief NULL if the LP does not exist
+         */
+        LogicalProcess*
+        find(LogicalProcessId id) const;
+
+        /**
+         * @brief Create the LP if it does not exist
+         */
+        LogicalProcess*
+        getLogicalProcess(LogicalProcessId id);
+
+        /**
+         * @brief Key for a new event issued in the current context
+         */
+        Key
+        newKey(wns::simulator::Tick at);
+
+        LogicalProcess*
+        insert(LogicalProcessId id, const Callable& callable, const Key& key, EventStore::Index& index);
+
+        /**
+         * @brief Schedule within the current LP (or LP 0)
+         */
+        LogicalProcess*
+        scheduleLocal(const Callable& callable, wns::simulator::Tick at, EventStore::Index& index);
+
+        /**
+         * @brief The LP with the earliest event (NULL if there is none)
+         */
+        LogicalProcess*
+        earliest() const;
+
+        /**
+         * @brief Execute the first event of lp
+         */
+        void
+        runOneEvent(LogicalProcess* lp);
+
+        bool
+        isInWindow(const wns::simulator::Tick& time) const
+        {
+            return time < windowEnd_ || (windowInclusive_ && time == windowEnd_);
+        }
+
+        /**
+         * @brief Execute all events of lp within the window
+         */
+        void
+        runWindow(LogicalProcess* lp);
+
+        /**
+         * @brief Execute the next window (false if there are no more events)
+         */
+        bool
+        processOneWindow();
+
+        /**
+         * @brief Process the active LPs (called by all threads)
+         */
+        void
+        work();
+
+        void
+        startWorkers();
+
+        void
+        stopWorkers();
+
+        static void*
+        workerMain(void* arg);
+        //@}
+
+        // MEMBER
+        wns::simulator::Tick lookahead_;
+
+        int numberOfThreads_;
+
+        wns::simulator::Tick simTime_;
+
+        bool stop_;
+
+        /**
+         * @brief Set by stopAt(), no window extends beyond this time
+         */
+        wns::simulator::Tick stopAt_;
+
+        CommandQueue commandQueue_;
+
+        /**
+         * @brief Indexed by LogicalProcessId (NULL if not used so far)
+         */
+        std::vector<LogicalProcess*> logicalProcesses_;
+
+        /**
+         * @brief Sequence number of events issued from outside any LP
+         */
+        unsigned long long int externalSequence_;
+
+        /**
+         * @name State of the current window
+         */
+        //{@
+        wns::simulator::Tick windowEnd_;
+
+        /**
+         * @brief Events at windowEnd_ belong to the window (stopAt())
+         */
+        bool windowInclusive_;
+
+        /**
+         * @brief True while the worker threads process a window
+         */
+        bool concurrent_;
+
+        std::vector<LogicalProcess*> active_;
+
+        /**
+         * @brief Next entry of active_ to be processed (atomic)
+         */
+        volatile int nextActive_;
+
+        std::string error_;
+        //@}
+
+        /**
+         * @name Worker threads
+         */
+        //{@
+        std::vector<pthread_t> workers_;
+
+        pthread_mutex_t mutex_;
+
+        pthread_cond_t windowStarted_;
+
+        pthread_cond_t windowFinished_;
+
+        unsigned long int window_;
+
+        /**
+         * @brief Value of window_ when the workers have been started
+         */
+        unsigned long int firstWindow_;
+
+        int busyWorkers_;
+
+        bool shutdown_;
+
+        pthread_mutex_t observerMutex_;
+        //@}
+    };
+
+} // scheduler
+} // events
+} // wns
+
+#endif // NOT defined WNS_EVENTS_SCHEDULER_PARALLEL_HPP
@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/events/scheduler/tests/Benchmark.hpp>
+#include <WNS/events/NoOp.hpp>
+#include <WNS/StopWatch.hpp>
+#include <WNS/Assure.hpp>
+
+#include <boost/random/uniform_01.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+
+using namespace wns::events::scheduler::tests;
+
+namespace {
+    // more increments are reused cyclically
+    const size_t maximumNumberOfIncrements = 1 << 20;
+}
+
+Benchmark::Workload::Workload(
+    Kind _kind,
+    size_t _queueSize,
+    Distribution _distribution,
+    unsigned long int _operations) :
+    kind(_kind),
+    queueSize(_queueSize),
+    distribution(_distribution),
+    operations(_operations),
+    mean(1.0)
+{
+}
+
+Benchmark::Result::Result() :
+    scheduler(),
+    workload(Hold, 0, Constant),
+    operations(0),
+    seconds(0.0),
+    eventsPerSecond(0.0),
+    nsPerOperation(0.0),
+    peakMemory(0)
+{
+}
+
+Benchmark::Benchmark(unsigned long int seed) :
+    rng_(seed),
+    scheduler_(NULL),
+    increments_(),
+    next_(0)
+{
+}
+
+void
+Benchmark::HoldEvent::operator()()
+{
+    benchmark->scheduler_->scheduleDelay(*this, benchmark->nextIncrement());
+}
+
+Benchmark::Result
+Benchmark::run(Interface* scheduler, const std::string& schedulerName, const Workload& workload)
+{
+    assure(scheduler->size() == 0, "The benchmark needs an empty scheduler");
+    assure(workload.queueSize > 0, "The queue size must be positive");
+
+    scheduler_ = scheduler;
+
+    Result result;
+    result.scheduler = schedulerName;
+    result.workload = workload;
+
+    wns::StopWatch sw;
+    unsigned long int events = 0;
+
+    if (workload.kind == Hold)
+    {
+        drawIncrements(workload, workload.queueSize + workload.operations);
+
+        // set up the steady state, not measured
+        for (size_t ii = 0; ii < workload.queueSize; ++ii)
+        {
+            scheduler->scheduleDelay(HoldEvent(this), nextIncrement());
+        }
+
+        resetPeakMemory();
+        sw.start();
+        for (unsigned long int ii = 0; ii < workload.operations; ++ii)
+        {
+            scheduler->processOneEvent();
+        }
+        sw.stop();
+
+        result.operations = workload.operations;
+        events = workload.operations;
+    }
+    else
+    {
+        unsigned long int cycles =
+            std::max(1UL, workload.operations / (2 * workload.queueSize));
+
+        drawIncrements(workload, workload.queueSize);
+
+        resetPeakMemory();
+        sw.start();
+        for (unsigned long int cycle = 0; cycle < cycles; ++cycle)
+        {
+            for (size_t ii = 0; ii < workload.queueSize; ++ii)
+            {
+                scheduler->scheduleDelay(NoOp(), nextIncrement());
+            }
+            while (scheduler->processOneEvent());
+        }
+        sw.stop();
+
+        result.operations = 2 * workload.queueSize * cycles;
+        events = workload.queueSize * cycles;
+    }
+
+    result.peakMemory = getPeakMemory();
+    result.seconds = sw.getInSeconds();
+    if (result.seconds > 0.0)
+    {
+        result.eventsPerSecond = events / result.seconds;
+    }
+    result.nsPerOperation = result.seconds * 1E9 / result.operations;
+
+    scheduler->reset();
+    scheduler_ = NULL;
+    return result;
+}
+
+std::vector<Benchmark::Workload>
+Benchmark::getStandardWorkloads(const std::vector<size_t>& queueSizes)
+{
+    static const Distribution distributions[] = {Exponential, Uniform, Bimodal, Triangular, Constant};
+    static const size_t numberOfDistributions = sizeof(distributions) / sizeof(Distribution);
+
+    std::vector<Workload> workloads;
+    for (std::vector<size_t>::const_iterator itr = queueSizes.begin();
+         itr != queueSizes.end();
+         ++itr)
+    {
+        for (size_t ii = 0; ii < numberOfDistributions; ++ii)
+        {
+            workloads.push_back(Workload(Hold, *itr, distributions[ii]));
+            workloads.push_back(Workload(UpDown, *itr, distributions[ii]));
+        }
+    }
+    return workloads;
+}
+
+std::string
+Benchmark::toString(Kind kind)
+{
+    switch (kind)
+    {
+    case Hold:
+        return "hold";
+    case UpDown:
+        return "updown";
+    }
+    return "unknown";
+}
+
+std::string
+Benchmark::toString(Distribution distribution)
+{
+    switch (distribution)
+    {
+    case Exponential:
+        return "exponential";
+    case Uniform:
+        return "uniform";
+    case Bimodal:
+        return "bimodal";
+    case Triangular:
+        return "triangular";
+    case Constant:
+        return "constant";
+    }
+    return "unknown";
+}
+
+void
+Benchmark::writeJSON(std::ostream& out, const ResultContainer& results)
+{
+    out << "[";
+    for (ResultContainer::const_iterator itr = results.begin();
+         itr != results.end();
+         ++itr)
+    {
+        out << (itr == results.begin() ? "\n" : ",\n")
+            << "  {\"scheduler\": \"" << itr->scheduler << "\""
+            << ", \"workload\": \"" << toString(itr->workload.kind) << "\""
+            << ", \"distribution\": \"" << toString(itr->workload.distribution) << "\""
+            << ", \"queueSize\": " << itr->workload.queueSize
+            << ", \"operations\": " << itr->operations
+            << ", \"seconds\": " << itr->seconds
+            << ", \"eventsPerSecond\": " << itr->eventsPerSecond
+            << ", \"nsPerOperation\": " << itr->nsPerOperation
+            << ", \"peakMemoryKB\": " << itr->peakMemory
+            << "}";
+    }
+    out << "\n]\n";
+}
+
+void
+Benchmark::drawIncrements(const Workload& workload, size_t number)
+{
+    boost::uniform_01<wns::rng::RNGen&> uniform(rng_);
+    const wns::simulator::Time mean = workload.mean;
+
+    increments_.resize(std::min(number, maximumNumberOfIncrements));
+    next_ = 0;
+
+    for (std::vector<wns::simulator::Time>::iterator itr = increments_.begin();
+         itr != increments_.end();
+         ++itr)
+    {
+        switch (workload.distribution)
+        {
+        case Exponential:
+            *itr = -mean * std::log(1.0 - uniform());
+            break;
+        case Uniform:
+            *itr = 2.0 * mean * uniform();
+            break;
+        case Bimodal:
+        {
+            // 90% in [0, a], 10% in [100a, 101a]
+            double a = mean / 10.5;
+            *itr = uniform() < 0.9 ? a * uniform() : a * (100.0 + uniform());
+            break;
+        }
+        case Triangular:
+            // density rising linearly on [0, 1.5 mean]
+            *itr = 1.5 * mean * std::sqrt(uniform());
+            break;
+        case Constant:
+            *itr = mean;
+            break;
+        }
+    }
+}
+
+void
+Benchmark::resetPeakMemory()
+{
+    // Linux only, the peak is not reset if this fails
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs.good())
+    {
+        clearRefs << "5";
+    }
+}
+
+long int
+Benchmark::getPeakMemory()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+        {
+            std::istringstream value(line.substr(6));
+            long int kB = 0;
+            value >> kB;
+            return kB;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_EVENTS_SCHEDULER_TESTS_BENCHMARK_HPP
+#define WNS_EVENTS_SCHEDULER_TESTS_BENCHMARK_HPP
+
+#include <WNS/events/scheduler/Interface.hpp>
+#include <WNS/rng/RNGen.hpp>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace wns { namespace events { namespace scheduler { namespace tests {
+
+    /**
+     * @brief Standardized workloads to compare event scheduler implementations
+     *
+     * Two classic priority queue workloads are supported:
+     *
+     *  - Hold: the queue is filled with queueSize events, afterwards each
+     *    operation processes the earliest event, which schedules a new one
+     *    (dequeue + enqueue at constant queue size).
+     *  - UpDown: queueSize events are scheduled, afterwards all of them are
+     *    processed. Each enqueue and each dequeue is one operation. Small
+     *    queues repeat this cycle to get a measurable run time.
+     *
+     * The time increments are drawn from the configured distribution before
+     * the measurement starts. The results can be written as JSON, one object
+     * per run, so that schedulers and revisions can be compared by scripts.
+     */
+    class Benchmark
+    {
+    public:
+        enum Kind
+        {
+            Hold,
+            UpDown
+        };
+
+        enum Distribution
+        {
+            Exponential,
+            Uniform,
+            Bimodal,
+            Triangular,
+            Constant
+        };
+
+        /**
+         * @brief Description of a single run
+         */
+        struct Workload
+        {
+            Workload(Kind _kind,
+                     size_t _queueSize,
+                     Distribution _distribution,
+                     unsigned long int _operations = 1000000);
+
+            Kind kind;
+
+            size_t queueSize;
+
+            Distribution distribution;
+
+            /**
+             * @brief Number of operations to measure (at least one cycle for
+             * UpDown)
+             */
+            unsigned long int operations;
+
+            /**
+             * @brief Mean time increment in seconds
+             */
+            wns::simulator::Time mean;
+        };
+
+        struct Result
+        {
+            Result();
+
+            std::string scheduler;
+
+            Workload workload;
+
+            unsigned long int operations;
+
+            double seconds;
+
+            double eventsPerSecond;
+
+            double nsPerOperation;
+
+            /**
+             * @brief Peak resident set size during the run in kB (0 if unknown)
+             */
+            long int peakMemory;
+        };
+
+        typedef std::vector<Result> ResultContainer;
+
+        explicit
+        Benchmark(unsigned long int seed = 4711);
+
+        /**
+         * @brief Run the workload on an empty scheduler
+         *
+         * The scheduler is reset afterwards.
+         */
+        Result
+        run(Interface* scheduler, const std::string& schedulerName, const Workload& workload);
+
+        /**
+         * @brief Hold and UpDown for all distributions and the given queue
+         * sizes
+         */
+        static std::vector<Workload>
+        getStandardWorkloads(const std::vector<size_t>& queueSizes);
+
+        static std::string
+        toString(Kind kind);
+
+        static std::string
+        toString(Distribution distribution);
+
+        /**
+         * @brief Write the results as a JSON array
+         */
+        static void
+        writeJSON(std::ostream& out, const ResultContainer& results);
+
+    private:
+        /**
+         * @brief Reschedules itself with the next precomputed increment
+         */
+        class HoldEvent
+        {
+        public:
+            explicit
+            HoldEvent(Benchmark* _benchmark) :
+                benchmark(_benchmark)
+            {
+            }
+
+            void
+            operator()();
+
+        private:
+            Benchmark* benchmark;
+        };
+
+        void
+        drawIncrements(const Workload& workload, size_t number);
+
+        wns::simulator::Time
+        nextIncrement()
+        {
+            wns::simulator::Time increment = increments_[next_];
+            if (++next_ == increments_.size())
+            {
+                next_ = 0;
+            }
+            return increment;
+        }
+
+        static void
+        resetPeakMemory();
+
+        static long int
+        getPeakMemory();
+
+        wns::rng::RNGen rng_;
+
+        Interface* scheduler_;
+
+        std::vector<wns::simulator::Time> increments_;
+
+        size_t next_;
+    };
+
+} // tests
+} // scheduler
+} // events
+} // wns
+
+#endif // NOT defined WNS_EVENTS_SCHEDULER_TESTS_BENCHMARK_HPP
@@ -36,6 +36,11 @@ namespace wns { namespace events { namespace tests {
     public:
         CPPUNIT_TEST_SUITE( CallableTest );
         CPPUNIT_TEST( testCallable );
+        CPPUNIT_TEST( testEmpty );
+        CPPUNIT_TEST( testInline );
+        CPPUNIT_TEST( testOnHeap );
+        CPPUNIT_TEST( testAssign );
+        CPPUNIT_TEST( testTypeAndTag );
         CPPUNIT_TEST_SUITE_END();
 
         struct Foo
@@ -57,6 +62,45 @@ namespace wns { namespace events { namespace tests {
             int& globalBar_;
         };
 
+        /**
+         * @brief Counts its living instances, the size is configurable
+         */
+        template <int size>
+        struct Counted
+        {
+            Counted(int& instances, int& calls) :
+                instances_(instances),
+                calls_(calls)
+            {
+                ++instances_;
+            }
+
+            Counted(const Counted& other) :
+                instances_(other.instances_),
+                calls_(other.calls_)
+            {
+                ++instances_;
+            }
+
+            ~Counted()
+            {
+                --instances_;
+            }
+
+            void
+            operator()()
+            {
+                ++calls_;
+            }
+
+            int& instances_;
+            int& calls_;
+            char payload_[size];
+        };
+
+        typedef Counted<8> Small;
+        typedef Counted<2 * WNS_CALLABLE_BUFFER_SIZE> Large;
+
         virtual void
         prepare()
         {
@@ -80,6 +124,120 @@ namespace wns { namespace events { namespace tests {
 
             CPPUNIT_ASSERT_EQUAL(1, globalBar_);
         }
+
+        void
+        testEmpty()
+        {
+            scheduler::Callable callable;
+            CPPUNIT_ASSERT( callable.empty() );
+            CPPUNIT_ASSERT( !callable );
+
+            int instances = 0;
+            int calls = 0;
+            callable = Small(instances, calls);
+            CPPUNIT_ASSERT( !callable.empty() );
+            CPPUNIT_ASSERT( callable );
+
+            callable.clear();
+            CPPUNIT_ASSERT( callable.empty() );
+            CPPUNIT_ASSERT_EQUAL(0, instances);
+        }
+
+        void
+        testInline()
+        {
+            CPPUNIT_ASSERT( scheduler::Callable::isStoredInline<Small>() );
+            CPPUNIT_ASSERT( scheduler::Callable::isStoredInline<void (*)()>() );
+
+            int instances = 0;
+            int calls = 0;
+            unsigned long int heapAllocations = scheduler::Callable::getHeapAllocations();
+            {
+                scheduler::Callable callable1 = Small(instances, calls);
+                scheduler::Callable callable2 = callable1;
+                CPPUNIT_ASSERT_EQUAL(2, instances);
+
+                callable1();
+                callable2();
+                CPPUNIT_ASSERT_EQUAL(2, calls);
+            }
+            CPPUNIT_ASSERT_EQUAL(0, instances);
+            CPPUNIT_ASSERT_EQUAL(heapAllocations, scheduler::Callable::getHeapAllocations());
+        }
+
+        void
+        testOnHeap()
+        {
+            CPPUNIT_ASSERT( !scheduler::Callable::isStoredInline<Large>() );
+
+            int instances = 0;
+            int calls = 0;
+            unsigned long int heapAllocations = scheduler::Callable::getHeapAllocations();
+            {
+                scheduler::Callable callable1 = Large(instances, calls);
+                scheduler::Callable callable2 = callable1;
+                CPPUNIT_ASSERT_EQUAL(2, instances);
+
+                callable1();
+                callable2();
+                CPPUNIT_ASSERT_EQUAL(2, calls);
+            }
+            CPPUNIT_ASSERT_EQUAL(0, instances);
+            CPPUNIT_ASSERT_EQUAL(heapAllocations + 2, scheduler::Callable::getHeapAllocations());
+        }
+
+        void
+        testAssign()
+        {
+            int smallInstances = 0;
+            int largeInstances = 0;
+            int calls = 0;
+            {
+                scheduler::Callable callable1 = Small(smallInstances, calls);
+                scheduler::Callable callable2 = Large(largeInstances, calls);
+
+                callable1 = callable2;
+                CPPUNIT_ASSERT_EQUAL(0, smallInstances);
+                CPPUNIT_ASSERT_EQUAL(2, largeInstances);
+
+                callable2 = Small(smallInstances, calls);
+                CPPUNIT_ASSERT_EQUAL(1, smallInstances);
+                CPPUNIT_ASSERT_EQUAL(1, largeInstances);
+
+                callable1 = callable1;
+                callable1();
+                callable2();
+                CPPUNIT_ASSERT_EQUAL(2, calls);
+            }
+            CPPUNIT_ASSERT_EQUAL(0, smallInstances);
+            CPPUNIT_ASSERT_EQUAL(0, largeInstances);
+        }
+
+        void
+        testTypeAndTag()
+        {
+            int instances = 0;
+            int calls = 0;
+
+            scheduler::Callable empty;
+            CPPUNIT_ASSERT( empty.getType() == typeid(void) );
+            CPPUNIT_ASSERT( empty.getTag() == NULL );
+
+            scheduler::Callable small = Small(instances, calls);
+            CPPUNIT_ASSERT( small.getType() == typeid(Small) );
+            CPPUNIT_ASSERT( small.getTag() == NULL );
+
+            scheduler::Callable taggedSmall = scheduler::tagged("small", Small(instances, calls));
+            CPPUNIT_ASSERT( taggedSmall.getType() == typeid(scheduler::Tagged<Small>) );
+            CPPUNIT_ASSERT_EQUAL( std::string("small"), std::string(taggedSmall.getTag()) );
+
+            scheduler::Callable taggedLarge = scheduler::tagged("large", Large(instances, calls));
+            CPPUNIT_ASSERT_EQUAL( std::string("large"), std::string(taggedLarge.getTag()) );
+
+            taggedSmall();
+            taggedLarge();
+            CPPUNIT_ASSERT_EQUAL(2, calls);
+        }
     };
 
     CPPUNIT_TEST_SUITE_REGISTRATION( CallableTest );
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/events/scheduler/CommandQueue.hpp>
+#include <WNS/TestFixture.hpp>
+
+#include <boost/bind.hpp>
+
+#include <pthread.h>
+#include <vector>
+
+namespace wns { namespace events { namespace scheduler { namespace tests {
+
+    class CommandQueueTest :
+        public wns::TestFixture
+    {
+        CPPUNIT_TEST_SUITE( CommandQueueTest );
+        CPPUNIT_TEST( testFIFO );
+        CPPUNIT_TEST( testDequeue );
+        CPPUNIT_TEST( testReset );
+        CPPUNIT_TEST( testException );
+        CPPUNIT_TEST( testMultipleProducers );
+        CPPUNIT_TEST( testConcurrentConsumer );
+        CPPUNIT_TEST_SUITE_END();
+
+    public:
+        void
+        prepare()
+        {
+            ids_.clear();
+        }
+
+        void
+        cleanup()
+        {
+        }
+
+        void
+        testFIFO()
+        {
+            CommandQueue queue;
+            queue.runCommands();
+            CPPUNIT_ASSERT( ids_.empty() );
+
+            for (int ii = 0; ii < 10; ++ii)
+            {
+                queue.queueCommand(boost::bind(&CommandQueueTest::record, this, ii));
+            }
+            queue.runCommands();
+
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(10), ids_.size() );
+            for (int ii = 0; ii < 10; ++ii)
+            {
+                CPPUNIT_ASSERT_EQUAL( ii, ids_[ii] );
+            }
+        }
+
+        void
+        testDequeue()
+        {
+            CommandQueue queue;
+            queue.queueCommand(boost::bind(&CommandQueueTest::record, this, 1));
+            ICommandPtr command = queue.queueCommand(boost::bind(&CommandQueueTest::record, this, 2));
+            queue.queueCommand(boost::bind(&CommandQueueTest::record, this, 3));
+
+            queue.dequeueCommand(command);
+            CPPUNIT_ASSERT( command->isCanceled() );
+            CPPUNIT_ASSERT_THROW( queue.dequeueCommand(command), ICommand::CancelException );
+
+            queue.runCommands();
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), ids_.size() );
+            CPPUNIT_ASSERT_EQUAL( 1, ids_[0] );
+            CPPUNIT_ASSERT_EQUAL( 3, ids_[1] );
+            CPPUNIT_ASSERT( command->isCanceled() );
+        }
+
+        void
+        testReset()
+        {
+            CommandQueue queue;
+            ICommandPtr command = queue.queueCommand(boost::bind(&CommandQueueTest::record, this, 1));
+            queue.reset();
+            queue.runCommands();
+            CPPUNIT_ASSERT( ids_.empty() );
+
+            queue.queueCommand(boost::bind(&CommandQueueTest::record, this, 2));
+            queue.runCommands();
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), ids_.size() );
+        }
+
+        void
+        testException()
+        {
+            CommandQueue queue;
+            queue.queueCommand(boost::bind(&CommandQueueTest::record, this, 1));
+            queue.queueCommand(boost::bind(&CommandQueueTest::fail, this));
+            queue.queueCommand(boost::bind(&CommandQueueTest::record, this, 2));
+
+            CPPUNIT_ASSERT_THROW( queue.runCommands(), wns::Exception );
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), ids_.size() );
+
+            // the remaining command is not lost
+            queue.queueCommand(boost::bind(&CommandQueueTest::record, this, 3));
+            queue.runCommands();
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(3), ids_.size() );
+            CPPUNIT_ASSERT_EQUAL( 2, ids_[1] );
+            CPPUNIT_ASSERT_EQUAL( 3, ids_[2] );
+        }
+
+        void
+        testMultipleProducers()
+        {
+            const int numberOfProducers = 4;
+
+            CommandQueue queue;
+            Producer producers[numberOfProducers];
+            std::vector<pthread_t> threads(numberOfProducers);
+            for (int ii = 0; ii < numberOfProducers; ++ii)
+            {
+                producers[ii].queue = &queue;
+                producers[ii].test = this;
+                producers[ii].id = ii;
+                pthread_create(&threads[ii], NULL, &Producer::run, &producers[ii]);
+            }
+
+            for (int ii = 0; ii < numberOfProducers; ++ii)
+            {
+                pthread_join(threads[ii], NULL);
+            }
+            queue.runCommands();
+            checkOrder(numberOfProducers);
+        }
+
+        void
+        testConcurrentConsumer()
+        {
+            const int numberOfProducers = 4;
+            const size_t numberOfIds = numberOfProducers * Producer::numberOfCommands;
+
+            CommandQueue queue;
+            Producer producers[numberOfProducers];
+            std::vector<pthread_t> threads(numberOfProducers);
+            for (int ii = 0; ii < numberOfProducers; ++ii)
+            {
+                producers[ii].queue = &queue;
+                producers[ii].test = this;
+                producers[ii].id = ii;
+                pthread_create(&threads[ii], NULL, &Producer::run, &producers[ii]);
+            }
+
+            // the producers keep queueing (and releasing their handles)
+            // while the commands are run and released here
+            while (ids_.size() < numberOfIds)
+            {
+                queue.runCommands();
+            }
+
+            for (int ii = 0; ii < numberOfProducers; ++ii)
+            {
+                pthread_join(threads[ii], NULL);
+            }
+            queue.runCommands();
+            checkOrder(numberOfProducers);
+        }
+
+    private:
+        struct Producer
+        {
+            static const int numberOfCommands = 10000;
+
+            static void*
+            run(void* arg)
+            {
+                Producer* producer = static_cast<Producer*>(arg);
+                for (int ii = 0; ii < numberOfCommands; ++ii)
+                {
+                    // the handle is released here, possibly while the
+                    // consumer runs and releases the command
+                    ICommandPtr command = producer->queue->queueCommand(
+                        boost::bind(&CommandQueueTest::record,
+                                    producer->test,
+                                    producer->id * numberOfCommands + ii));
+                }
+                return NULL;
+            }
+
+            CommandQueue* queue;
+            CommandQueueTest* test;
+            int id;
+        };
+
+        void
+        checkOrder(int numberOfProducers)
+        {
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(numberOfProducers * Producer::numberOfCommands), ids_.size() );
+
+            // the commands of each producer are run in the order they have
+            // been queued
+            std::vector<int> last(numberOfProducers, -1);
+            for (size_t ii = 0; ii < ids_.size(); ++ii)
+            {
+                int producer = ids_[ii] / Producer::numberOfCommands;
+                int sequence = ids_[ii] % Producer::numberOfCommands;
+                CPPUNIT_ASSERT_EQUAL( last[producer] + 1, sequence );
+                last[producer] = sequence;
+            }
+        }
+
+        void
+        record(int id)
+        {
+            ids_.push_back(id);
+        }
+
+        void
+        fail()
+        {
+            throw wns::Exception("command failed");
+        }
+
+        std::vector<int> ids_;
+    };
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( CommandQueueTest );
+
+} // tests
+} // scheduler
+} // events
+} // wns
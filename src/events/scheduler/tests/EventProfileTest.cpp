@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/events/scheduler/EventProfile.hpp>
+#include <WNS/events/scheduler/Map.hpp>
+#include <WNS/Observer.hpp>
+#include <WNS/demangle.hpp>
+#include <WNS/TestFixture.hpp>
+
+#include <sstream>
+
+namespace wns { namespace events { namespace scheduler { namespace tests {
+
+    class EventProfileTest :
+        public wns::TestFixture
+    {
+        CPPUNIT_TEST_SUITE( EventProfileTest );
+        CPPUNIT_TEST( testCount );
+        CPPUNIT_TEST( testTagged );
+        CPPUNIT_TEST( testSampling );
+        CPPUNIT_TEST( testCPUTime );
+        CPPUNIT_TEST( testBin );
+        CPPUNIT_TEST( testWrite );
+        CPPUNIT_TEST_SUITE_END();
+
+        struct Cheap
+        {
+            void
+            operator()()
+            {
+            }
+        };
+
+        struct Expensive
+        {
+            Expensive(double* _sink) :
+                sink(_sink)
+            {
+            }
+
+            void
+            operator()()
+            {
+                for (int ii = 0; ii < 100000; ++ii)
+                {
+                    *sink += ii * 0.5;
+                }
+            }
+
+            double* sink;
+        };
+
+        /**
+         * @brief Feeds the events of a scheduler into an EventProfile (like
+         * Monitor does)
+         */
+        class Profiler :
+            public Observer<INotification>,
+            public IgnoreAllNotifications
+        {
+        public:
+            explicit
+            Profiler(unsigned int samplingInterval) :
+                profile(samplingInterval)
+            {
+            }
+
+            EventProfile profile;
+
+        private:
+            virtual void
+            doOnEventStarted(const Callable& callable)
+            {
+                profile.onEventStarted(callable);
+            }
+
+            virtual void
+            doOnEventFinished(const Callable& callable)
+            {
+                profile.onEventFinished(callable);
+            }
+        };
+
+    public:
+        void
+        prepare()
+        {
+            scheduler_ = new Map();
+            sink_ = 0.0;
+        }
+
+        void
+        cleanup()
+        {
+            delete scheduler_;
+        }
+
+        void
+        testCount()
+        {
+            Profiler profiler(1);
+            profiler.startObserving(scheduler_);
+
+            for (int ii = 0; ii < 3; ++ii)
+            {
+                scheduler_->scheduleDelay(Cheap(), ii);
+            }
+            scheduler_->scheduleDelay(Expensive(&sink_), 1.5);
+            scheduler_->start();
+
+            CPPUNIT_ASSERT_EQUAL( 4LL, profiler.profile.getProcessedEvents() );
+            const EventProfile::Entry* cheap = profiler.profile.find(wns::demangle(typeid(Cheap).name()));
+            const EventProfile::Entry* expensive = profiler.profile.find(wns::demangle(typeid(Expensive).name()));
+            CPPUNIT_ASSERT( cheap != NULL );
+            CPPUNIT_ASSERT( expensive != NULL );
+            CPPUNIT_ASSERT_EQUAL( 3LL, cheap->count );
+            CPPUNIT_ASSERT_EQUAL( 3LL, cheap->sampled );
+            CPPUNIT_ASSERT_EQUAL( 1LL, expensive->count );
+        }
+
+        void
+        testTagged()
+        {
+            Profiler profiler(1);
+            profiler.startObserving(scheduler_);
+
+            scheduler_->scheduleNow(tagged("tag", Cheap()));
+            scheduler_->scheduleNow(tagged("tag", Expensive(&sink_)));
+            scheduler_->scheduleNow(Cheap());
+            scheduler_->start();
+
+            const EventProfile::Entry* tag = profiler.profile.find("tag");
+            const EventProfile::Entry* cheap = profiler.profile.find(wns::demangle(typeid(Cheap).name()));
+            CPPUNIT_ASSERT( tag != NULL );
+            CPPUNIT_ASSERT( cheap != NULL );
+            CPPUNIT_ASSERT_EQUAL( 2LL, tag->count );
+            CPPUNIT_ASSERT_EQUAL( 1LL, cheap->count );
+        }
+
+        void
+        testSampling()
+        {
+            Profiler profiler(4);
+            profiler.startObserving(scheduler_);
+
+            for (int ii = 0; ii < 10; ++ii)
+            {
+                scheduler_->scheduleNow(Cheap());
+            }
+            scheduler_->start();
+
+            const EventProfile::Entry* cheap = profiler.profile.find(wns::demangle(typeid(Cheap).name()));
+            CPPUNIT_ASSERT( cheap != NULL );
+            CPPUNIT_ASSERT_EQUAL( 10LL, cheap->count );
+            CPPUNIT_ASSERT_EQUAL( 2LL, cheap->sampled );
+
+            long long int histogram = 0;
+            for (int ii = 0; ii < EventProfile::numberOfBins; ++ii)
+            {
+                histogram += cheap->histogram[ii];
+            }
+            CPPUNIT_ASSERT_EQUAL( 2LL, histogram );
+        }
+
+        void
+        testCPUTime()
+        {
+            Profiler profiler(1);
+            profiler.startObserving(scheduler_);
+
+            for (int ii = 0; ii < 10; ++ii)
+            {
+                scheduler_->scheduleNow(Cheap());
+                scheduler_->scheduleNow(Expensive(&sink_));
+            }
+            scheduler_->start();
+
+            const EventProfile::Entry* cheap = profiler.profile.find(wns::demangle(typeid(Cheap).name()));
+            const EventProfile::Entry* expensive = profiler.profile.find(wns::demangle(typeid(Expensive).name()));
+            CPPUNIT_ASSERT( expensive->getCPUTime() > 0.0 );
+            CPPUNIT_ASSERT( expensive->getCPUTime() > cheap->getCPUTime() );
+        }
+
+        void
+        testBin()
+        {
+            CPPUNIT_ASSERT_EQUAL( 0, EventProfile::getBin(0.0) );
+            CPPUNIT_ASSERT_EQUAL( 0, EventProfile::getBin(1e-9) );
+            CPPUNIT_ASSERT_EQUAL( 1, EventProfile::getBin(2e-9) );
+            // 1 us = 1000 ns = 2^9.97 ns
+            CPPUNIT_ASSERT_EQUAL( 9, EventProfile::getBin(1e-6) );
+            CPPUNIT_ASSERT_EQUAL( EventProfile::numberOfBins - 1, EventProfile::getBin(1e6) );
+        }
+
+        void
+        testWrite()
+        {
+            Profiler profiler(1);
+            profiler.startObserving(scheduler_);
+
+            scheduler_->scheduleNow(tagged("first", Cheap()));
+            scheduler_->scheduleNow(Expensive(&sink_));
+            scheduler_->start();
+
+            std::stringstream report;
+            profiler.profile.write(report);
+            CPPUNIT_ASSERT( report.str().find("first") != std::string::npos );
+            CPPUNIT_ASSERT( report.str().find(wns::demangle(typeid(Expensive).name())) != std::string::npos );
+            CPPUNIT_ASSERT( report.str().find("processed events: 2") != std::string::npos );
+        }
+
+    private:
+        Interface* scheduler_;
+
+        double sink_;
+    };
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( EventProfileTest );
+
+} // tests
+} // scheduler
+} // events
+} // wns
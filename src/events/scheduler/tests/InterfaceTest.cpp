@@ -254,6 +254,51 @@ InterfaceTest::testGetTime()
     receiver->flush();
 }
 
+void
+InterfaceTest::testTickResolution()
+{
+    // 0.1 + 0.2 is slightly larger than 0.3 in double precision
+    scheduler->schedule(ObjectWithId(4711, receiver), 0.1 + 0.2);
+    scheduler->schedule(ObjectWithId(4712, receiver), 0.3);
+
+    scheduler->processOneEvent();
+    wns::simulator::Time first = scheduler->getTime();
+    scheduler->processOneEvent();
+    wns::simulator::Time second = scheduler->getTime();
+
+    CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), receiver->objects.size() );
+#ifdef WNS_FIXED_POINT_TIME
+    // both fall into the same tick and keep their FIFO order
+    CPPUNIT_ASSERT_EQUAL( static_cast<long int>(4711), receiver->objects[0].getID() );
+    CPPUNIT_ASSERT_EQUAL( first, second );
+    CPPUNIT_ASSERT_EQUAL( wns::simulator::fromTick(wns::simulator::toTick(0.3)), first );
+#else
+    CPPUNIT_ASSERT_EQUAL( static_cast<long int>(4712), receiver->objects[0].getID() );
+    CPPUNIT_ASSERT( first < second );
+#endif
+    receiver->flush();
+}
+
+void
+InterfaceTest::testFarFuture()
+{
+    // about 31700 years, beyond the range of the fixed-point ticks, which
+    // must clamp rather than overflow
+    scheduler->schedule(ObjectWithId(4712, receiver), 1e12);
+    scheduler->schedule(ObjectWithId(4711, receiver), 1.0);
+
+    scheduler->processOneEvent();
+    CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), receiver->objects.size() );
+    CPPUNIT_ASSERT_EQUAL( static_cast<long int>(4711), receiver->objects[0].getID() );
+    CPPUNIT_ASSERT_EQUAL( 1.0, scheduler->getTime() );
+
+    scheduler->processOneEvent();
+    CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), receiver->objects.size() );
+    CPPUNIT_ASSERT_EQUAL( static_cast<long int>(4712), receiver->objects[1].getID() );
+    CPPUNIT_ASSERT( scheduler->getTime() > 1.0 );
+    receiver->flush();
+}
+
 void
 InterfaceTest::testdeleteEvent()
 {
@@ -632,6 +677,93 @@ InterfaceTest::testCancelCurrentlyProcessedEvent()
     CPPUNIT_ASSERT( exceptionThrown == true );
 }
 
+void
+InterfaceTest::testEventHandle()
+{
+    EventHandle invalid;
+    CPPUNIT_ASSERT( !invalid.isValid() );
+    CPPUNIT_ASSERT( !scheduler->isQueued(invalid) );
+
+    EventHandle handle1 = scheduler->scheduleHandle(ObjectWithId(1, receiver), 5);
+    EventHandle handle2 = scheduler->scheduleDelayHandle(ObjectWithId(2, receiver), 3);
+    EventHandle handle3 = scheduler->scheduleNowHandle(ObjectWithId(3, receiver));
+    CPPUNIT_ASSERT( handle1.isValid() );
+    CPPUNIT_ASSERT( handle1 != handle2 );
+    CPPUNIT_ASSERT( scheduler->isQueued(handle1) );
+    CPPUNIT_ASSERT( scheduler->isQueued(handle2) );
+    CPPUNIT_ASSERT( scheduler->isQueued(handle3) );
+    CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(3), scheduler->size() );
+
+    scheduler->start();
+
+    CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(3), receiver->objects.size() );
+    CPPUNIT_ASSERT_EQUAL( static_cast<long int>(3), receiver->objects[0].getID() );
+    CPPUNIT_ASSERT_EQUAL( static_cast<long int>(2), receiver->objects[1].getID() );
+    CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), receiver->objects[2].getID() );
+    CPPUNIT_ASSERT_EQUAL( 5.0, scheduler->getTime() );
+    CPPUNIT_ASSERT( !scheduler->isQueued(handle1) );
+    CPPUNIT_ASSERT( !scheduler->isQueued(handle2) );
+    CPPUNIT_ASSERT( !scheduler->isQueued(handle3) );
+    CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), scheduler->size() );
+}
+
+void
+InterfaceTest::testCancelEventHandle()
+{
+    IEventPtr event = scheduler->schedule(ObjectWithId(1, receiver), 5);
+    EventHandle handle = scheduler->scheduleHandle(ObjectWithId(2, receiver), 5);
+    scheduler->schedule(ObjectWithId(3, receiver), 5);
+
+    scheduler->cancelEvent(handle);
+    CPPUNIT_ASSERT( !scheduler->isQueued(handle) );
+    CPPUNIT_ASSERT( event->isQueued() );
+    CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), scheduler->size() );
+
+    scheduler->start();
+    CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), receiver->objects.size() );
+    CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), receiver->objects[0].getID() );
+    CPPUNIT_ASSERT_EQUAL( static_cast<long int>(3), receiver->objects[1].getID() );
+    CPPUNIT_ASSERT( event->isFinished() );
+}
+
+void
+InterfaceTest::testCancelStaleEventHandle()
+{
+    EventHandle handle = scheduler->scheduleHandle(NoOp(), 5);
+    scheduler->cancelEvent(handle);
+    CPPUNIT_ASSERT_THROW( scheduler->cancelEvent(handle), IEvent::CancelException );
+
+    // the slot of the canceled event is re-used, the old handle must not
+    // refer to the new event
+    EventHandle handle2 = scheduler->scheduleHandle(ObjectWithId(1, receiver), 5);
+    CPPUNIT_ASSERT( handle != handle2 );
+    CPPUNIT_ASSERT( !scheduler->isQueued(handle) );
+    CPPUNIT_ASSERT_THROW( scheduler->cancelEvent(handle), IEvent::CancelException );
+    CPPUNIT_ASSERT( scheduler->isQueued(handle2) );
+
+    scheduler->start();
+    CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), receiver->objects.size() );
+    CPPUNIT_ASSERT_THROW( scheduler->cancelEvent(handle2), IEvent::CancelException );
+    CPPUNIT_ASSERT_THROW( scheduler->cancelEvent(EventHandle()), IEvent::CancelException );
+}
+
+void
+InterfaceTest::testEventHandleAfterReset()
+{
+    EventHandle handle = scheduler->scheduleHandle(NoOp(), 5);
+    IEventPtr event = scheduler->schedule(NoOp(), 7);
+    scheduler->reset();
+
+    CPPUNIT_ASSERT( !scheduler->isQueued(handle) );
+    CPPUNIT_ASSERT_THROW( scheduler->cancelEvent(handle), IEvent::CancelException );
+
+    // events which survived the reset can still be canceled
+    CPPUNIT_ASSERT( event->isQueued() );
+    scheduler->cancelEvent(event);
+    CPPUNIT_ASSERT( event->isCanceled() );
+    CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), scheduler->size() );
+}
+
 void
 InterfaceTest::testOnProcessOneEvent()
 {
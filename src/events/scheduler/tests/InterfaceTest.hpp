@@ -51,6 +51,8 @@ namespace wns { namespace events { namespace scheduler { namespace tests {
         CPPUNIT_TEST( testReset );
         CPPUNIT_TEST( testCommand );
         CPPUNIT_TEST( testGetTime );
+        CPPUNIT_TEST( testTickResolution );
+        CPPUNIT_TEST( testFarFuture );
         CPPUNIT_TEST( testdeleteEvent );
         CPPUNIT_TEST( testSendNow );
         CPPUNIT_TEST( testSendDelay );
@@ -74,6 +76,10 @@ namespace wns { namespace events { namespace scheduler { namespace tests {
         CPPUNIT_TEST( testCancelAlreadyCanceledEvent );
         CPPUNIT_TEST( testCancelAlreadyCalledEvent );
         CPPUNIT_TEST( testCancelCurrentlyProcessedEvent );
+        CPPUNIT_TEST( testEventHandle );
+        CPPUNIT_TEST( testCancelEventHandle );
+        CPPUNIT_TEST( testCancelStaleEventHandle );
+        CPPUNIT_TEST( testEventHandleAfterReset );
         CPPUNIT_TEST_SUITE_END_ABSTRACT();
 
         class EventHandlerStub;
@@ -281,6 +287,8 @@ namespace wns { namespace events { namespace scheduler { namespace tests {
         void testReset();
         void testCommand();
         void testGetTime();
+        void testTickResolution();
+        void testFarFuture();
         void testdeleteEvent();
         void testSendNow();
         void testSendDelay();
@@ -303,6 +311,10 @@ namespace wns { namespace events { namespace scheduler { namespace tests {
         void testCancelAlreadyCalledEvent();
         void testCancelAlreadyCanceledEvent();
         void testCancelCurrentlyProcessedEvent();
+        void testEventHandle();
+        void testCancelEventHandle();
+        void testCancelStaleEventHandle();
+        void testEventHandleAfterReset();
 
     private:
         virtual Interface*
@@ -0,0 +1,350 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/events/scheduler/Parallel.hpp>
+#include <WNS/events/scheduler/Map.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <boost/bind.hpp>
+
+#include <vector>
+
+namespace wns { namespace events { namespace scheduler { namespace tests {
+
+    /**
+     * @brief Compares Parallel (different numbers of threads) and Map
+     */
+    class ParallelTest :
+        public CppUnit::TestFixture
+    {
+        CPPUNIT_TEST_SUITE( ParallelTest );
+        CPPUNIT_TEST( testSequentialEqualsMap );
+        CPPUNIT_TEST( testWindowsEqualMap );
+        CPPUNIT_TEST( testDeterministic );
+        CPPUNIT_TEST( testLogicalProcess );
+        CPPUNIT_TEST( testLookaheadViolation );
+        CPPUNIT_TEST( testStopAt );
+        CPPUNIT_TEST( testException );
+        CPPUNIT_TEST_SUITE_END();
+
+        /**
+         * @brief What happened in a logical process
+         */
+        struct Entry
+        {
+            Entry(wns::simulator::Time _time, unsigned long int _value) :
+                time(_time),
+                value(_value)
+            {
+            }
+
+            bool
+            operator==(const Entry& other) const
+            {
+                return time == other.time && value == other.value;
+            }
+
+            wns::simulator::Time time;
+
+            unsigned long int value;
+        };
+
+        typedef std::vector<Entry> Trace;
+
+        /**
+         * @brief Nodes exchanging messages with a minimum delay
+         *
+         * Each node (logical process) has its own random number generator
+         * and trace. For Map all events are scheduled with schedule(), for
+         * Parallel messages to other nodes are sent with scheduleOn().
+         */
+        class Model
+        {
+        public:
+            Model(Interface* scheduler, unsigned int numberOfNodes, wns::simulator::Time lookahead, unsigned long int seed) :
+                scheduler_(scheduler),
+                parallel_(dynamic_cast<Parallel*>(scheduler)),
+                lookahead_(lookahead),
+                random_(numberOfNodes),
+                traces_(numberOfNodes),
+                timers_(numberOfNodes)
+            {
+                for (unsigned int ii = 0; ii < numberOfNodes; ++ii)
+                {
+                    random_[ii] = seed * 7919 + ii;
+                    send(ii, ii, random(ii) % 1000 * 1e-3);
+                }
+            }
+
+            void
+            onMessage(unsigned int node, unsigned long int value)
+            {
+                CPPUNIT_ASSERT_EQUAL( scheduler_->getTime(), currentTime(node) );
+                traces_[node].push_back(Entry(scheduler_->getTime(), value));
+
+                if (scheduler_->getTime() > 20.0)
+                {
+                    return;
+                }
+
+                unsigned long int r = random(node);
+
+                // a local timer which is canceled now and then
+                if (r % 3 == 0)
+                {
+                    if (timers_[node].isValid() && scheduler_->isQueued(timers_[node]))
+                    {
+                        scheduler_->cancelEvent(timers_[node]);
+                    }
+                    timers_[node] = scheduler_->scheduleDelayHandle(
+                        boost::bind(&Model::onTimer, this, node, r),
+                        random(node) % 1000 * 1e-4);
+                }
+
+                // every message causes exactly one new message, either to
+                // another node or to the node itself
+                if (r % 2 == 0)
+                {
+                    unsigned int receiver = random(node) % random_.size();
+                    send(receiver, r, lookahead_ + random(node) % 10007 * 1e-5);
+                }
+                else
+                {
+                    send(node, r, random(node) % 10007 * 1e-5);
+                }
+            }
+
+            void
+            onTimer(unsigned int node, unsigned long int value)
+            {
+                traces_[node].push_back(Entry(scheduler_->getTime(), value + 1000000));
+            }
+
+            const std::vector<Trace>&
+            getTraces() const
+            {
+                return traces_;
+            }
+
+        private:
+            void
+            send(unsigned int node, unsigned long int value, wns::simulator::Time delay)
+            {
+                Callable callable = boost::bind(&Model::onMessage, this, node, value);
+                if (parallel_ != NULL)
+                {
+                    parallel_->scheduleDelayOn(node, callable, delay);
+                }
+                else
+                {
+                    scheduler_->scheduleDelay(callable, delay);
+                }
+            }
+
+            wns::simulator::Time
+            currentTime(unsigned int node) const
+            {
+                if (parallel_ != NULL)
+                {
+                    CPPUNIT_ASSERT_EQUAL( node, parallel_->getCurrentLogicalProcess() );
+                }
+                return scheduler_->getTime();
+            }
+
+            unsigned long int
+            random(unsigned int node)
+            {
+                random_[node] = random_[node] * 1103515245UL + 12345UL;
+                return (random_[node] >> 8) & 0xffffff;
+            }
+
+            Interface* scheduler_;
+
+            Parallel* parallel_;
+
+            wns::simulator::Time lookahead_;
+
+            std::vector<unsigned long int> random_;
+
+            std::vector<Trace> traces_;
+
+            std::vector<EventHandle> timers_;
+        };
+
+        struct Thrower
+        {
+            void
+            operator()()
+            {
+                throw wns::Exception("Thrower");
+            }
+        };
+
+        struct NoThrow
+        {
+            void
+            operator()()
+            {
+            }
+        };
+
+        void
+        record(std::vector<wns::simulator::Time>* times, Interface* scheduler)
+        {
+            times->push_back(scheduler->getTime());
+        }
+
+        std::vector<Trace>
+        run(Interface* scheduler, unsigned long int seed)
+        {
+            Model model(scheduler, numberOfNodes, lookahead, seed);
+            scheduler->start();
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), scheduler->size() );
+            delete scheduler;
+            return model.getTraces();
+        }
+
+        static const unsigned int numberOfNodes = 32;
+
+        static const wns::simulator::Time lookahead;
+
+    public:
+        void
+        setUp()
+        {
+        }
+
+        void
+        tearDown()
+        {
+        }
+
+        void
+        testSequentialEqualsMap()
+        {
+            std::vector<Trace> reference = run(new Map(), 1);
+            CPPUNIT_ASSERT( reference[0].size() > 100 );
+            CPPUNIT_ASSERT( reference == run(new Parallel(), 1) );
+        }
+
+        void
+        testWindowsEqualMap()
+        {
+            for (unsigned long int seed = 1; seed < 4; ++seed)
+            {
+                std::vector<Trace> reference = run(new Map(), seed);
+                CPPUNIT_ASSERT( reference == run(new Parallel(lookahead, 1), seed) );
+                CPPUNIT_ASSERT( reference == run(new Parallel(lookahead, 4), seed) );
+            }
+        }
+
+        void
+        testDeterministic()
+        {
+            std::vector<Trace> reference = run(new Parallel(lookahead, 8), 42);
+            for (int ii = 0; ii < 5; ++ii)
+            {
+                CPPUNIT_ASSERT( reference == run(new Parallel(lookahead, 8), 42) );
+            }
+            CPPUNIT_ASSERT( reference == run(new Parallel(lookahead, 3), 42) );
+        }
+
+        void
+        testLogicalProcess()
+        {
+            Parallel scheduler(lookahead, 2);
+            std::vector<wns::simulator::Time> times;
+            scheduler.scheduleOn(3, boost::bind(&ParallelTest::record, this, &times, &scheduler), 2.0);
+            scheduler.schedule(boost::bind(&ParallelTest::record, this, &times, &scheduler), 1.0);
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), scheduler.size() );
+            CPPUNIT_ASSERT_EQUAL( static_cast<Parallel::LogicalProcessId>(0), scheduler.getCurrentLogicalProcess() );
+
+            scheduler.start();
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), times.size() );
+            CPPUNIT_ASSERT_EQUAL( 1.0, times[0] );
+            CPPUNIT_ASSERT_EQUAL( 2.0, times[1] );
+            CPPUNIT_ASSERT_EQUAL( 2.0, scheduler.getTime() );
+        }
+
+        void
+        testLookaheadViolation()
+        {
+            Parallel scheduler(lookahead, 1);
+            // from outside any event there is no restriction
+            scheduler.scheduleOn(1, boost::bind(&Parallel::scheduleDelayOn, &scheduler, 2, Thrower(), lookahead / 2), 0.0);
+            CPPUNIT_ASSERT_THROW( scheduler.start(), wns::Exception );
+        }
+
+        void
+        testStopAt()
+        {
+            Parallel scheduler(lookahead, 4);
+            std::vector<wns::simulator::Time> times1;
+            std::vector<wns::simulator::Time> times2;
+            for (int ii = 0; ii < 100; ++ii)
+            {
+                scheduler.scheduleOn(1, boost::bind(&ParallelTest::record, this, &times1, &scheduler), ii * 0.01);
+                scheduler.scheduleOn(2, boost::bind(&ParallelTest::record, this, &times2, &scheduler), ii * 0.01);
+            }
+            scheduler.stopAt(0.5);
+            scheduler.start();
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(51), times1.size() );
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(51), times2.size() );
+            CPPUNIT_ASSERT_EQUAL( 0.5, scheduler.getTime() );
+        }
+
+        void
+        testException()
+        {
+            Parallel scheduler(lookahead, 4);
+            for (Parallel::LogicalProcessId ii = 0; ii < 8; ++ii)
+            {
+                scheduler.scheduleOn(ii, NoThrow(), 0.0);
+            }
+            scheduler.scheduleOn(5, Thrower(), 0.0);
+            CPPUNIT_ASSERT_THROW( scheduler.start(), wns::Exception );
+
+            // the failed event gave its slot back and the workers are ready
+            // for the next window
+            for (Parallel::LogicalProcessId ii = 0; ii < 8; ++ii)
+            {
+                scheduler.scheduleOn(ii, NoThrow(), 1.0);
+            }
+            scheduler.start();
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), scheduler.size() );
+        }
+    };
+
+    const wns::simulator::Time ParallelTest::lookahead = 0.01;
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( ParallelTest );
+
+} // tests
+} // scheduler
+} // events
+} // wns
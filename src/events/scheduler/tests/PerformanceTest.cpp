@@ -26,10 +26,17 @@
  ******************************************************************************/
 
 #include <WNS/events/scheduler/tests/PerformanceTest.hpp>
+#include <WNS/events/scheduler/tests/Benchmark.hpp>
 #include <WNS/events/NoOp.hpp>
+#include <WNS/events/MemberFunction.hpp>
 #include <WNS/StopWatch.hpp>
+#include <WNS/TypeInfo.hpp>
+
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
 
 #include <list>
+#include <fstream>
 
 using namespace wns::events::scheduler::tests;
 using namespace wns::events::scheduler;
@@ -210,3 +217,73 @@ PerformanceTest::testJistStyle()
     std::cout << "testJistStyle() took " << sw.toString() << std::endl;
     std::cout << "Events/s " << 5000000/sw.getInSeconds() << std::endl;
 }
+
+void
+PerformanceTest::testAllocationsPerEvent()
+{
+    std::cout << "\ntestAllocationsPerEvent(): processing " << this->numberOfEvents
+              << " events bound to a member function with two arguments"
+              << std::endl;
+
+    typedef boost::function<void ()> BoostFunction;
+    std::cout << "Inline buffer of Callable: " << Callable::bufferSize
+              << " bytes, boost::function: " << sizeof(BoostFunction) << " bytes"
+              << std::endl;
+
+    BindTarget target;
+    unsigned long int heapAllocations = Callable::getHeapAllocations();
+    wns::StopWatch sw;
+    sw.start();
+    for(int ii = 0; ii < this->numberOfEvents; ++ii)
+    {
+        this->scheduler->scheduleDelayHandle(boost::bind(&BindTarget::add, &target, ii, 1), 0.001*ii);
+    }
+    this->scheduler->start();
+    sw.stop();
+    heapAllocations = Callable::getHeapAllocations() - heapAllocations;
+
+    std::cout << "testAllocationsPerEvent() took " << sw.toString() << std::endl;
+    std::cout << "Events/s " << this->numberOfEvents/sw.getInSeconds() << std::endl;
+    std::cout << "Heap allocations of Callable per event: "
+              << static_cast<double>(heapAllocations)/this->numberOfEvents << std::endl;
+
+    // the typical callables must not need any allocation
+    CPPUNIT_ASSERT_EQUAL(0UL, heapAllocations);
+    CPPUNIT_ASSERT( Callable::isStoredInline<MemberFunction<BindTarget> >() );
+}
+
+void
+PerformanceTest::testBenchmark()
+{
+    // the scheduler is reset between the runs, nothing is left for cleanup()
+    std::string name = wns::TypeInfo::create(*this->scheduler).toString();
+
+    std::vector<size_t> queueSizes;
+    queueSizes.push_back(10);
+    queueSizes.push_back(1000);
+    queueSizes.push_back(100000);
+
+    std::vector<Benchmark::Workload> workloads = Benchmark::getStandardWorkloads(queueSizes);
+
+    std::cout << "\ntestBenchmark(): " << workloads.size()
+              << " hold and up/down workloads for " << name << std::endl;
+
+    Benchmark benchmark;
+    Benchmark::ResultContainer results;
+    for (std::vector<Benchmark::Workload>::const_iterator itr = workloads.begin();
+         itr != workloads.end();
+         ++itr)
+    {
+        results.push_back(benchmark.run(this->scheduler, name, *itr));
+        CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), this->scheduler->size() );
+    }
+
+    // machine readable, e.g. to compare revisions
+    std::string fileName = "SchedulerBenchmark." + name + ".json";
+    std::replace(fileName.begin(), fileName.end(), ':', '_');
+    std::ofstream file(fileName.c_str());
+    Benchmark::writeJSON(file, results);
+
+    Benchmark::writeJSON(std::cout, results);
+    std::cout << "Results written to " << fileName << std::endl;
+}
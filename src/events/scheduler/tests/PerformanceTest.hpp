@@ -52,6 +52,8 @@ namespace wns { namespace events { namespace scheduler { namespace tests {
         CPPUNIT_TEST( testIncreasingTime );
         CPPUNIT_TEST( testQueuingDuringRun );
         CPPUNIT_TEST( testQueueAndDelete );
+        CPPUNIT_TEST( testAllocationsPerEvent );
+        CPPUNIT_TEST( testBenchmark );
         CPPUNIT_TEST_SUITE_END_ABSTRACT();
 
         class SelfQueuing
@@ -110,6 +112,26 @@ namespace wns { namespace events { namespace scheduler { namespace tests {
             wns::events::scheduler::Interface* scheduler;
         };
 
+        /**
+         * @brief Target of bound member function calls
+         */
+        class BindTarget
+        {
+        public:
+            BindTarget() :
+                sum(0)
+            {
+            }
+
+            void
+            add(int a, int b)
+            {
+                sum += a + b;
+            }
+
+            long int sum;
+        };
+
         class SchedulerObserver :
             public Observer<INotification>,
             public wns::events::scheduler::IgnoreAllNotifications
@@ -138,6 +160,8 @@ namespace wns { namespace events { namespace scheduler { namespace tests {
         void testQueuingDuringRun();
         void testQueueAndDelete();
         void testJistStyle();
+        void testAllocationsPerEvent();
+        void testBenchmark();
 
     private:
         virtual Interface*
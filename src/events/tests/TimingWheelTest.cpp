@@ -0,0 +1,349 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/events/TimingWheel.hpp>
+#include <WNS/events/scheduler/Map.hpp>
+#include <WNS/TestFixture.hpp>
+
+#include <boost/bind.hpp>
+
+#include <vector>
+#include <cstdlib>
+
+namespace wns { namespace events { namespace tests {
+
+    class TimingWheelTest :
+        public wns::TestFixture
+    {
+        CPPUNIT_TEST_SUITE( TimingWheelTest );
+        CPPUNIT_TEST( testFire );
+        CPPUNIT_TEST( testLevels );
+        CPPUNIT_TEST( testCancel );
+        CPPUNIT_TEST( testCancelPromoted );
+        CPPUNIT_TEST( testArmWhileRunning );
+        CPPUNIT_TEST( testSameAsScheduler );
+        CPPUNIT_TEST( testReset );
+        CPPUNIT_TEST_SUITE_END();
+
+        struct Entry
+        {
+            Entry(wns::simulator::Time _time, int _id) :
+                time(_time),
+                id(_id)
+            {
+            }
+
+            bool
+            operator==(const Entry& other) const
+            {
+                return time == other.time && id == other.id;
+            }
+
+            wns::simulator::Time time;
+            int id;
+        };
+
+        typedef std::vector<Entry> Log;
+
+        /**
+         * @brief Timers that are restarted and canceled like ARQ timeouts.
+         * Runs either on the wheel or directly on the scheduler.
+         */
+        class Model
+        {
+        public:
+            Model(scheduler::Interface* scheduler, TimingWheel* wheel, int numberOfTimers) :
+                scheduler_(scheduler),
+                wheel_(wheel),
+                timers_(numberOfTimers),
+                log_(),
+                seed_(1)
+            {
+                for (int ii = 0; ii < numberOfTimers; ++ii)
+                {
+                    arm(ii);
+                }
+            }
+
+            void
+            onTimeout(int id)
+            {
+                log_.push_back(Entry(scheduler_->getTime(), id));
+                if (scheduler_->getTime() > 10.0)
+                {
+                    return;
+                }
+                arm(id);
+
+                // restart some other timer
+                int other = random() % timers_.size();
+                if (isArmed(timers_[other]))
+                {
+                    cancel(timers_[other]);
+                    arm(other);
+                }
+            }
+
+            const Log&
+            getLog() const
+            {
+                return log_;
+            }
+
+        private:
+            void
+            arm(int id)
+            {
+                // from a fraction of a tick up to some seconds
+                wns::simulator::Time delay = (random() % 1000000) * 3.3e-6;
+                scheduler::Callable callable = boost::bind(&Model::onTimeout, this, id);
+                if (wheel_ != NULL)
+                {
+                    timers_[id] = wheel_->arm(callable, delay);
+                }
+                else
+                {
+                    timers_[id] = scheduler_->scheduleDelayHandle(callable, delay);
+                }
+            }
+
+            bool
+            isArmed(const scheduler::EventHandle& handle) const
+            {
+                return wheel_ != NULL ? wheel_->isArmed(handle) : scheduler_->isQueued(handle);
+            }
+
+            void
+            cancel(const scheduler::EventHandle& handle)
+            {
+                if (wheel_ != NULL)
+                {
+                    wheel_->cancel(handle);
+                }
+                else
+                {
+                    scheduler_->cancelEvent(handle);
+                }
+            }
+
+            unsigned long int
+            random()
+            {
+                seed_ = seed_ * 1103515245UL + 12345UL;
+                return (seed_ >> 8) & 0xffffff;
+            }
+
+            scheduler::Interface* scheduler_;
+            TimingWheel* wheel_;
+            std::vector<scheduler::EventHandle> timers_;
+            Log log_;
+            unsigned long int seed_;
+        };
+
+    public:
+        void
+        prepare()
+        {
+            scheduler_ = new scheduler::Map();
+            wheel_ = new TimingWheel(scheduler_, 1e-3);
+            log_.clear();
+        }
+
+        void
+        cleanup()
+        {
+            delete wheel_;
+            delete scheduler_;
+        }
+
+        void
+        testFire()
+        {
+            wheel_->arm(boost::bind(&TimingWheelTest::record, this, 1), 0.0105);
+            wheel_->arm(boost::bind(&TimingWheelTest::record, this, 2), 0.0);
+            wheel_->arm(boost::bind(&TimingWheelTest::record, this, 3), 0.0104);
+            wheel_->arm(boost::bind(&TimingWheelTest::record, this, 4), 0.0003);
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(4), wheel_->size() );
+
+            scheduler_->start();
+
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(4), log_.size() );
+            CPPUNIT_ASSERT( Entry(0.0, 2) == log_[0] );
+            CPPUNIT_ASSERT( Entry(0.0003, 4) == log_[1] );
+            CPPUNIT_ASSERT( Entry(0.0104, 3) == log_[2] );
+            CPPUNIT_ASSERT( Entry(0.0105, 1) == log_[3] );
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), wheel_->size() );
+            CPPUNIT_ASSERT_EQUAL( 4UL, wheel_->getPromotions() );
+        }
+
+        void
+        testLevels()
+        {
+            // 1 tick up to 10^10 ticks (levels 0 to 4)
+            wns::simulator::Time delay = 1e-3;
+            for (int ii = 0; ii < 11; ++ii)
+            {
+                wheel_->arm(boost::bind(&TimingWheelTest::record, this, ii), delay + 1e-4);
+                delay *= 10.0;
+            }
+            scheduler_->start();
+
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(11), log_.size() );
+            delay = 1e-3;
+            for (int ii = 0; ii < 11; ++ii)
+            {
+                CPPUNIT_ASSERT_EQUAL( ii, log_[ii].id );
+                // the scheduler may round to its tick (WNS_FIXED_POINT_TIME)
+                CPPUNIT_ASSERT_DOUBLES_EQUAL( delay + 1e-4, log_[ii].time, 1e-6 );
+                delay *= 10.0;
+            }
+        }
+
+        void
+        testCancel()
+        {
+            std::vector<scheduler::EventHandle> timers;
+            for (int ii = 0; ii < 1000; ++ii)
+            {
+                timers.push_back(wheel_->arm(boost::bind(&TimingWheelTest::record, this, ii), 1.0 + ii * 0.01));
+            }
+            // only the tick event is in the scheduler
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), scheduler_->size() );
+
+            for (int ii = 0; ii < 1000; ++ii)
+            {
+                CPPUNIT_ASSERT( wheel_->isArmed(timers[ii]) );
+                CPPUNIT_ASSERT_DOUBLES_EQUAL( 1.0 + ii * 0.01, wheel_->getExpiry(timers[ii]), 1e-9 );
+                if (ii != 500)
+                {
+                    wheel_->cancel(timers[ii]);
+                    CPPUNIT_ASSERT( !wheel_->isArmed(timers[ii]) );
+                }
+            }
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), wheel_->size() );
+
+            scheduler_->start();
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), log_.size() );
+            CPPUNIT_ASSERT( Entry(6.0, 500) == log_[0] );
+            CPPUNIT_ASSERT_EQUAL( 1UL, wheel_->getPromotions() );
+
+            // nothing left, the wheel must not keep the scheduler running
+            scheduler::EventHandle timer = wheel_->arm(boost::bind(&TimingWheelTest::record, this, 0), 5.0);
+            wheel_->cancel(timer);
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), scheduler_->size() );
+            scheduler_->start();
+            CPPUNIT_ASSERT_EQUAL( 6.0, scheduler_->getTime() );
+        }
+
+        void
+        testCancelPromoted()
+        {
+            scheduler::EventHandle timer = wheel_->arm(boost::bind(&TimingWheelTest::record, this, 1), 0.0);
+            CPPUNIT_ASSERT_EQUAL( 1UL, wheel_->getPromotions() );
+            CPPUNIT_ASSERT( wheel_->isArmed(timer) );
+            wheel_->cancel(timer);
+            CPPUNIT_ASSERT( !wheel_->isArmed(timer) );
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), scheduler_->size() );
+            scheduler_->start();
+            CPPUNIT_ASSERT( log_.empty() );
+        }
+
+        void
+        testArmWhileRunning()
+        {
+            // skip a few thousand empty ticks, then arm a timer
+            scheduler_->schedule(boost::bind(&TimingWheelTest::armRecord, this, 1, 0.5), 3.21);
+            wheel_->arm(boost::bind(&TimingWheelTest::record, this, 2), 100.0);
+            scheduler_->start();
+
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), log_.size() );
+            CPPUNIT_ASSERT( Entry(3.71, 1) == log_[0] );
+            CPPUNIT_ASSERT( Entry(100.0, 2) == log_[1] );
+        }
+
+        void
+        testSameAsScheduler()
+        {
+            Model onWheel(scheduler_, wheel_, 100);
+            scheduler_->start();
+
+            scheduler::Map reference;
+            Model onScheduler(&reference, NULL, 100);
+            reference.start();
+
+            CPPUNIT_ASSERT( onScheduler.getLog().size() > 500 );
+            CPPUNIT_ASSERT( onScheduler.getLog() == onWheel.getLog() );
+            // most timers have been canceled before reaching the scheduler
+            CPPUNIT_ASSERT( wheel_->getPromotions() < 2 * onWheel.getLog().size() );
+        }
+
+        void
+        testReset()
+        {
+            scheduler::EventHandle timer = wheel_->arm(boost::bind(&TimingWheelTest::record, this, 1), 1.0);
+            wheel_->arm(boost::bind(&TimingWheelTest::record, this, 2), 0.0);
+
+            wheel_->reset();
+            CPPUNIT_ASSERT( !wheel_->isArmed(timer) );
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), wheel_->size() );
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), scheduler_->size() );
+
+            // reset of the scheduler is detected
+            wheel_->arm(boost::bind(&TimingWheelTest::record, this, 3), 1.0);
+            scheduler_->reset();
+            wheel_->arm(boost::bind(&TimingWheelTest::record, this, 4), 2.0);
+            scheduler_->start();
+
+            CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), log_.size() );
+            CPPUNIT_ASSERT( Entry(2.0, 4) == log_[0] );
+        }
+
+    private:
+        void
+        record(int id)
+        {
+            log_.push_back(Entry(scheduler_->getTime(), id));
+        }
+
+        void
+        armRecord(int id, wns::simulator::Time delay)
+        {
+            wheel_->arm(boost::bind(&TimingWheelTest::record, this, id), delay);
+        }
+
+        scheduler::Interface* scheduler_;
+
+        TimingWheel* wheel_;
+
+        Log log_;
+    };
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( TimingWheelTest );
+
+} // tests
+} // events
+} // wns
@@ -37,7 +37,21 @@
 #include <WNS/logger/Logger.hpp>
 #include <WNS/pyconfig/Parser.hpp>
 
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/contains.hpp>
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/distance.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/find.hpp>
+#include <boost/mpl/next.hpp>
+#include <boost/mpl/size.hpp>
+
 #include <string>
+#include <vector>
 
 #include <iostream>
 
@@ -59,10 +73,18 @@ namespace wns { namespace fsm {
      * The different states of this FSM are represented by different classes
      * (or better objects of different classes).
      *
+     * The optional STATES is a boost::mpl::vector of all state classes
+     * created by createState<NEWSTATE>(). If given, createState() of a
+     * state not in STATES does not compile, and each state is constructed
+     * only once (on first use or by preconstructStates()) and owned by the
+     * FSM. A state change is then a pointer swap without any allocation.
+     * Since the state objects are reused, they have to (re)initialize
+     * their members in initState() rather than in their constructor.
+     *
      * @sa @ref HowToWriteFiniteStateMachine
      */
 
-    template <typename SIGNALS, typename VARIABLES>
+    template <typename SIGNALS, typename VARIABLES, typename STATES = boost::mpl::vector<> >
     class FSM
     {
     public:
@@ -81,7 +103,7 @@ namespace wns { namespace fsm {
             /**
              * @brief The basic FSM this state will operate on
              */
-            typedef FSM<SIGNALS, VARIABLES> FSMType;
+            typedef FSM<SIGNALS, VARIABLES, STATES> FSMType;
 
             /**
              * @brief Each state will automatically get the FSM it belongs to
@@ -89,7 +111,9 @@ namespace wns { namespace fsm {
             explicit
                 StateInterface(FSMType* _fsm, const std::string& _stateName) :
                 fsm(_fsm),
-                stateName(_stateName)
+                stateName(_stateName),
+                preconstructed(false),
+                stateIndex(0)
             {
             }
 
@@ -149,6 +173,19 @@ namespace wns { namespace fsm {
              * @brief Name of current state
              */
             std::string stateName;
+
+            /**
+             * @brief One of STATES, owned by the FSM and not deleted on
+             * state changes
+             */
+            bool preconstructed;
+
+            /**
+             * @brief Position in STATES if preconstructed
+             */
+            std::size_t stateIndex;
+
+            friend class FSM<SIGNALS, VARIABLES, STATES>;
         };
 
         /**
@@ -161,33 +198,88 @@ namespace wns { namespace fsm {
             currentState(NULL),
             variables(v),
             logger("WNS", TypeInfo::create(*this).toString()),
-            stateCreated(false)
+            stateCreated(false),
+            preconstructedStates(boost::mpl::size<STATES>::value, static_cast<StateInterface*>(NULL)),
+            copiedState(false),
+            copiedStateIndex(0)
+        {
+        }
+
+        /**
+         * @brief Copy constructor
+         *
+         * A current state that is not one of STATES is shared with
+         * other. Otherwise the copy gets its own instance of that state
+         * type and enters it (calling initState()) when it is first used.
+         */
+        FSM(const FSM& other) :
+            currentState(other.currentState),
+            variables(other.variables),
+            logger(other.logger),
+            stateCreated(other.stateCreated),
+            preconstructedStates(boost::mpl::size<STATES>::value, static_cast<StateInterface*>(NULL)),
+            copiedState(other.copiedState),
+            copiedStateIndex(other.copiedStateIndex)
         {
+            if (currentState != NULL && currentState->preconstructed)
+            {
+                // The states of other can't be constructed for this FSM
+                // here, they may need the fully constructed derived FSM
+                copiedState = true;
+                copiedStateIndex = currentState->stateIndex;
+                currentState = NULL;
+            }
         }
 
         /**
          * @brief Destructor
          *
+         * Deletes the states of STATES.
+         *
          * @note If VARIABLES is a POINTER(!!) to a struct, it will not be
          * deleted.
          */
         virtual
         ~FSM()
         {
+            for (typename StateContainer::iterator it = preconstructedStates.begin();
+                 it != preconstructedStates.end();
+                 ++it)
+            {
+                delete *it;
+            }
         }
 
     public:
         /**
          * @brief Creates the state the FSM shall change to
+         *
+         * If STATES is given, NEWSTATE must be one of them and the
+         * instance owned by the FSM is returned.
          */
         template <typename NEWSTATE>
         StateInterface*
         createState()
         {
-            assure(!stateCreated, "A new state has been created already.");
+            BOOST_STATIC_ASSERT((boost::is_base_of<StateInterface, NEWSTATE>::value));
 
-            stateCreated = true;
-            return new NEWSTATE(this);
+            return createState<NEWSTATE>(typename boost::mpl::empty<STATES>::type());
+        }
+
+        /**
+         * @brief Constructs all states of STATES now rather than on their
+         * first use
+         *
+         * To be called from the constructor of the derived FSM at the
+         * earliest, the states may need it.
+         */
+        void
+        preconstructStates()
+        {
+            for (std::size_t ii = 0; ii < preconstructedStates.size(); ++ii)
+            {
+                getPreconstructedState(ii);
+            }
         }
 
     private:
@@ -241,31 +333,45 @@ namespace wns { namespace fsm {
          * @brief Replaces the current state of the FSM
          */
         void
-        replaceState(SIGNALS* newState)
+        replaceState(StateInterface* newState)
         {
-            assureType(newState, StateInterface*);
-            StateInterface* si = dynamic_cast<StateInterface*>(newState);
+            StateInterface* oldState = enterCopiedState();
 
-            if (si == currentState)
+            if (newState == oldState && !stateCreated)
                 throw wns::Exception("replaceState(...) called with current state.");
 
-            if (currentState)
+            if (oldState)
             {
                 MESSAGE_BEGIN(NORMAL, logger, m, "State replacement: ");
-                m << wns::TypeInfo::create(*currentState)
+                m << wns::TypeInfo::create(*oldState)
                   << " -> "
-                  << wns::TypeInfo::create(*si);
+                  << wns::TypeInfo::create(*newState);
                 MESSAGE_END();
 
-                delete currentState;
+                if (!oldState->preconstructed)
+                {
+                    delete oldState;
+                }
             }
 
             stateCreated = false;
 
-            currentState = si;
+            currentState = newState;
             currentState->initState();
         }
 
+        /**
+         * @brief Replaces the current state of the FSM
+         *
+         * Needs a dynamic_cast, prefer replaceState(StateInterface*).
+         */
+        void
+        replaceState(SIGNALS* newState)
+        {
+            assureType(newState, StateInterface*);
+            replaceState(dynamic_cast<StateInterface*>(newState));
+        }
+
     protected:
         /**
          * @brief Returns the current state
@@ -273,42 +379,164 @@ namespace wns { namespace fsm {
         StateInterface*
         getState() const
         {
+            if (currentState == NULL)
+            {
+                const_cast<FSM*>(this)->enterCopiedState();
+            }
             assure(currentState, "FSM not initialized. Please set state berfore sending signals.");
             return currentState;
         }
 
         /**
          * @brief Changes the state of the FSM (if necessary)
+         *
+         * Returning the current state from a signal keeps the FSM in it.
+         * A state created by createState() is entered (calling exitState()
+         * and initState()) even if it is the current one.
          */
         void
-        changeState(SIGNALS* newState)
+        changeState(StateInterface* newState)
         {
-            assureType(newState, StateInterface*);
-            StateInterface* si = dynamic_cast<StateInterface*>(newState);
+            StateInterface* oldState = enterCopiedState();
 
-            if (si == currentState)
+            if (newState == oldState && !stateCreated)
                 return;
 
-            if (currentState)
+            if (oldState)
             {
-                currentState->exitState();
+                oldState->exitState();
 
                 MESSAGE_BEGIN(NORMAL, logger, m, "State transition: ");
-                m << wns::TypeInfo::create(*currentState)
+                m << wns::TypeInfo::create(*oldState)
                   << " -> "
-                  << wns::TypeInfo::create(*si);
+                  << wns::TypeInfo::create(*newState);
                 MESSAGE_END();
 
-                delete currentState;
+                if (!oldState->preconstructed)
+                {
+                    delete oldState;
+                }
             }
 
             stateCreated = false;
 
-            currentState = si;
+            currentState = newState;
             currentState->initState();
         }
 
+        /**
+         * @brief Changes the state of the FSM (if necessary)
+         *
+         * Needs a dynamic_cast unless newState is the current state,
+         * prefer changeState(StateInterface*).
+         */
+        void
+        changeState(SIGNALS* newState)
+        {
+            if (currentState != NULL && newState == currentState && !stateCreated)
+                return;
+
+            assureType(newState, StateInterface*);
+            changeState(dynamic_cast<StateInterface*>(newState));
+        }
+
     private:
+        typedef std::vector<StateInterface*> StateContainer;
+
+        /**
+         * @brief Constructs the state at position index of the range
+         * [FIRST, LAST) of STATES
+         */
+        template <typename FIRST, typename LAST>
+        struct StateConstructor
+        {
+            static StateInterface*
+            create(FSM* fsm, std::size_t index)
+            {
+                if (index == 0)
+                {
+                    return new typename boost::mpl::deref<FIRST>::type(fsm);
+                }
+                return StateConstructor<typename boost::mpl::next<FIRST>::type, LAST>::create(fsm, index - 1);
+            }
+        };
+
+        template <typename LAST>
+        struct StateConstructor<LAST, LAST>
+        {
+            static StateInterface*
+            create(FSM*, std::size_t)
+            {
+                assure(false, "No such state.");
+                return NULL;
+            }
+        };
+
+        /**
+         * @brief Without STATES: a new NEWSTATE for each transition
+         */
+        template <typename NEWSTATE>
+        StateInterface*
+        createState(boost::mpl::true_)
+        {
+            assure(!stateCreated, "A new state has been created already.");
+
+            stateCreated = true;
+            return new NEWSTATE(this);
+        }
+
+        /**
+         * @brief With STATES: the NEWSTATE owned by the FSM
+         */
+        template <typename NEWSTATE>
+        StateInterface*
+        createState(boost::mpl::false_)
+        {
+            BOOST_MPL_ASSERT((boost::mpl::contains<STATES, NEWSTATE>));
+
+            assure(!stateCreated, "A new state has been created already.");
+
+            stateCreated = true;
+            return getPreconstructedState(
+                boost::mpl::distance<
+                    typename boost::mpl::begin<STATES>::type,
+                    typename boost::mpl::find<STATES, NEWSTATE>::type>::value);
+        }
+
+        StateInterface*
+        getPreconstructedState(std::size_t index)
+        {
+            StateInterface*& state = preconstructedStates[index];
+
+            if (state == NULL)
+            {
+                state = StateConstructor<
+                    typename boost::mpl::begin<STATES>::type,
+                    typename boost::mpl::end<STATES>::type>::create(this, index);
+                state->preconstructed = true;
+                state->stateIndex = index;
+            }
+            return state;
+        }
+
+        /**
+         * @brief Enters the state of the FSM this one has been copied
+         * from, if not done yet
+         *
+         * @return the current state
+         */
+        StateInterface*
+        enterCopiedState()
+        {
+            if (copiedState)
+            {
+                copiedState = false;
+                currentState = getPreconstructedState(copiedStateIndex);
+                currentState->initState();
+            }
+            return currentState;
+        }
+
         /**
          * @brief Current State of the FSM
          */
@@ -329,6 +557,19 @@ namespace wns { namespace fsm {
          */
         bool stateCreated;
 
+        /**
+         * @brief The states of STATES, in the order of STATES, NULL
+         * until constructed
+         */
+        StateContainer preconstructedStates;
+
+        /**
+         * @brief Copied from an FSM in state copiedStateIndex of STATES
+         * which has not been entered yet
+         */
+        bool copiedState;
+        std::size_t copiedStateIndex;
+
     }; // FSM
 
 } // fsm
@@ -193,16 +193,140 @@ namespace wns { namespace fsm { namespace tests {
         };
         // end example
 
+        /**
+         * A switch whose states are kept by the FSM
+         */
+        class SwitchSignals
+        {
+        public:
+            virtual SwitchSignals*
+            toggle() = 0;
+
+            virtual SwitchSignals*
+            reset() = 0;
+
+            virtual SwitchSignals*
+            keep() = 0;
+
+            virtual
+            ~SwitchSignals()
+            {
+            }
+        };
+
+        struct Transitions
+        {
+            Transitions() :
+                inits(0),
+                exits(0)
+            {
+            }
+
+            int inits;
+            int exits;
+        };
+
+        class Off;
+        class On;
+
+        typedef FSM<SwitchSignals, Transitions, boost::mpl::vector<Off, On> > SwitchInterface;
+
+        class Switch :
+            public SwitchInterface
+        {
+        public:
+            Switch();
+
+            void
+            toggle();
+
+            void
+            reset();
+
+            void
+            keep();
+
+            SwitchInterface::StateInterface*
+            state() const
+            {
+                return getState();
+            }
+
+            Transitions&
+            transitions()
+            {
+                return getVariables();
+            }
+        };
+
+        class Off :
+            public SwitchInterface::StateInterface
+        {
+        public:
+            Off(SwitchInterface* si) :
+                SwitchInterface::StateInterface(si, "wns_fsm_tests_Off")
+            {
+            }
+
+            virtual void
+            initState();
+
+            virtual void
+            exitState();
+
+            virtual StateInterface*
+            toggle();
+
+            virtual StateInterface*
+            reset();
+
+            virtual StateInterface*
+            keep();
+        };
+
+        class On :
+            public SwitchInterface::StateInterface
+        {
+        public:
+            On(SwitchInterface* si) :
+                SwitchInterface::StateInterface(si, "wns_fsm_tests_On")
+            {
+            }
+
+            virtual void
+            initState();
+
+            virtual void
+            exitState();
+
+            virtual StateInterface*
+            toggle();
+
+            virtual StateInterface*
+            reset();
+
+            virtual StateInterface*
+            keep();
+        };
+
         ///////////////////////////////////////////////////////////////
         // Test setup
         void prepare();
         void cleanup();
         void sendSignals();
         void multipleStateCreations();
+        void keptStates();
+        void keptStateSelfTransition();
+        void keptStateCreations();
+        void keptStatesCopy();
 
         CPPUNIT_TEST_SUITE( FSMTest );
         CPPUNIT_TEST( sendSignals );
         CPPUNIT_TEST( multipleStateCreations );
+        CPPUNIT_TEST( keptStates );
+        CPPUNIT_TEST( keptStateSelfTransition );
+        CPPUNIT_TEST( keptStateCreations );
+        CPPUNIT_TEST( keptStatesCopy );
         CPPUNIT_TEST_SUITE_END();
 
         Lamp* l;
@@ -267,6 +391,78 @@ namespace wns { namespace fsm { namespace tests {
         WNS_ASSERT_ASSURE_EXCEPTION( lc->createState<LampOn>() );
     }
 
+    void
+    FSMTest::keptStates()
+    {
+        Switch s;
+        SwitchInterface::StateInterface* off = s.state();
+        CPPUNIT_ASSERT_EQUAL( std::string("wns_fsm_tests_Off"), s.getStateName() );
+
+        s.toggle();
+        SwitchInterface::StateInterface* on = s.state();
+        CPPUNIT_ASSERT_EQUAL( std::string("wns_fsm_tests_On"), s.getStateName() );
+        CPPUNIT_ASSERT( on != off );
+
+        // the same instances are used for every transition
+        s.toggle();
+        CPPUNIT_ASSERT( off == s.state() );
+        s.toggle();
+        CPPUNIT_ASSERT( on == s.state() );
+
+        CPPUNIT_ASSERT_EQUAL( 4, s.transitions().inits );
+        CPPUNIT_ASSERT_EQUAL( 3, s.transitions().exits );
+    }
+
+    void
+    FSMTest::keptStateSelfTransition()
+    {
+        Switch s;
+        SwitchInterface::StateInterface* off = s.state();
+        CPPUNIT_ASSERT_EQUAL( 1, s.transitions().inits );
+        CPPUNIT_ASSERT_EQUAL( 0, s.transitions().exits );
+
+        // staying in the current state does not leave it
+        s.keep();
+        CPPUNIT_ASSERT( off == s.state() );
+        CPPUNIT_ASSERT_EQUAL( 1, s.transitions().inits );
+        CPPUNIT_ASSERT_EQUAL( 0, s.transitions().exits );
+
+        // creating the current state leaves and enters it again
+        s.reset();
+        CPPUNIT_ASSERT( off == s.state() );
+        CPPUNIT_ASSERT_EQUAL( 2, s.transitions().inits );
+        CPPUNIT_ASSERT_EQUAL( 1, s.transitions().exits );
+    }
+
+    void
+    FSMTest::keptStateCreations()
+    {
+        Switch s;
+        s.createState<On>();
+        WNS_ASSERT_ASSURE_EXCEPTION( s.createState<On>() );
+    }
+
+    void
+    FSMTest::keptStatesCopy()
+    {
+        Switch* original = new Switch();
+        original->toggle();
+        SwitchInterface::StateInterface* on = original->state();
+
+        Switch copy(*original);
+        delete original;
+
+        // the copy enters its own instance of the state it was copied in
+        CPPUNIT_ASSERT_EQUAL( 2, copy.transitions().inits );
+        CPPUNIT_ASSERT_EQUAL( std::string("wns_fsm_tests_On"), copy.getStateName() );
+        CPPUNIT_ASSERT( on != copy.state() );
+        CPPUNIT_ASSERT_EQUAL( 3, copy.transitions().inits );
+
+        copy.toggle();
+        CPPUNIT_ASSERT_EQUAL( std::string("wns_fsm_tests_Off"), copy.getStateName() );
+        CPPUNIT_ASSERT_EQUAL( 2, copy.transitions().exits );
+    }
+
     // begin example "FSM::LightControlMethods.example"
     FSMTest::LightControl::LightControl(const FSMTest::LightControlInterface::VariablesType& v) :
         FSMTest::LightControlInterface(v)
@@ -402,6 +598,90 @@ STATIC_FACTORY_REGISTER_WITH_CREATOR(FSMTest::LampOn,
     }
     // end example
 
+    FSMTest::Switch::Switch() :
+        FSMTest::SwitchInterface(Transitions())
+    {
+        changeState(createState<Off>());
+    }
+
+    void
+    FSMTest::Switch::toggle()
+    {
+        changeState(getState()->toggle());
+    }
+
+    void
+    FSMTest::Switch::reset()
+    {
+        changeState(getState()->reset());
+    }
+
+    void
+    FSMTest::Switch::keep()
+    {
+        changeState(getState()->keep());
+    }
+
+    void
+    FSMTest::Off::initState()
+    {
+        ++vars().inits;
+    }
+
+    void
+    FSMTest::Off::exitState()
+    {
+        ++vars().exits;
+    }
+
+    FSMTest::Off::StateInterface*
+    FSMTest::Off::toggle()
+    {
+        return getFSM()->createState<On>();
+    }
+
+    FSMTest::Off::StateInterface*
+    FSMTest::Off::reset()
+    {
+        return getFSM()->createState<Off>();
+    }
+
+    FSMTest::Off::StateInterface*
+    FSMTest::Off::keep()
+    {
+        return this;
+    }
+
+    void
+    FSMTest::On::initState()
+    {
+        ++vars().inits;
+    }
+
+    void
+    FSMTest::On::exitState()
+    {
+        ++vars().exits;
+    }
+
+    FSMTest::On::StateInterface*
+    FSMTest::On::toggle()
+    {
+        return getFSM()->createState<Off>();
+    }
+
+    FSMTest::On::StateInterface*
+    FSMTest::On::reset()
+    {
+        return getFSM()->createState<Off>();
+    }
+
+    FSMTest::On::StateInterface*
+    FSMTest::On::keep()
+    {
+        return this;
+    }
+
 } // tests
 } // fsm
 } // wsn
@@ -28,8 +28,10 @@
 #ifndef WNS_LDK_COMMAND_HPP
 #define WNS_LDK_COMMAND_HPP
 
+#include <WNS/ldk/CommandArena.hpp>
 #include <WNS/simulator/Bit.hpp>
 #include <WNS/Assure.hpp>
+#include <WNS/FreeList.hpp>
 
 #include <cstdlib>
 
@@ -47,18 +49,61 @@ namespace wns { namespace ldk {
 	 * <p>
 	 * The destructor of a Command will be called, when the containing
 	 * CommandPool is deleted.
+	 * <p>
+	 * Commands are allocated from thread-local freelists, one per size
+	 * class (see wns::SizeClassAllocation), since each FU on the path
+	 * creates one per compound.
+	 * <p>
+	 * Copies of a CommandPool share their Commands until a Command is
+	 * retrieved for writing (copy-on-write, see CommandProxy::getCommand).
 	 */
-	class Command
+	class Command :
+		public wns::SizeClassAllocation<Command>
 	{
 		friend class CommandProxy;
+		friend class CommandPool;
 
 	public:
 		Command() :
 			commited(false),
 			commandPoolSize(0),
-			payloadSize(0)
+			payloadSize(0),
+			position(0),
+			pools(1),
+			arena(NULL)
+#ifndef WNS_NDEBUG
+			, sealed(false),
+			fingerprint(0),
+			sealedSize(0)
+#endif
+		{}
+
+		/**
+		 * @brief A copy is owned by exactly one CommandPool
+		 */
+		Command(const Command& other) :
+			commited(other.commited),
+			commandPoolSize(other.commandPoolSize),
+			payloadSize(other.payloadSize),
+			position(other.position),
+			pools(1),
+			arena(NULL)
+#ifndef WNS_NDEBUG
+			, sealed(false),
+			fingerprint(0),
+			sealedSize(0)
+#endif
 		{}
 
+		Command&
+		operator=(const Command& other)
+		{
+			commited = other.commited;
+			commandPoolSize = other.commandPoolSize;
+			payloadSize = other.payloadSize;
+			return *this;
+		}
+
 		virtual
 		~Command()
 		{}
@@ -70,6 +115,11 @@ namespace wns { namespace ldk {
 		}
 
 	private:
+		bool isShared() const
+		{
+			return CommandSharing::get(pools) > 1;
+		}
+
 		bool sizeCommited() const
 	        {
 			return commited;
@@ -114,6 +164,46 @@ namespace wns { namespace ldk {
 		Bit commandPoolSize;
 		Bit payloadSize;
 
+		/**
+		 * @brief Index of this Command within the activation path
+		 *
+		 * Copies of a CommandPool keep the order of the path, so the
+		 * index is valid for all CommandPools sharing this Command.
+		 */
+		unsigned long int position;
+
+		/**
+		 * @brief Number of CommandPools sharing this Command (see
+		 * CommandSharing)
+		 */
+		long int pools;
+
+		/**
+		 * @brief The CommandArena this Command has been constructed in
+		 * (NULL if allocated on its own)
+		 */
+		CommandArena* arena;
+
+#ifndef WNS_NDEBUG
+		/**
+		 * @brief The Command has been shared and must not be modified
+		 * until it is retrieved for writing again (see CommandPool::seal)
+		 */
+		bool sealed;
+
+		/**
+		 * @brief Fingerprint of the contents when it has been sealed
+		 */
+		unsigned long int fingerprint;
+
+		/**
+		 * @brief Size of the object covered by the fingerprint
+		 *
+		 * Taken when sealing, since the FunctionalUnit knowing the size
+		 * may be gone when the last CommandPool releases the Command.
+		 */
+		std::size_t sealedSize;
+#endif
 	};
 
 	class EmptyCommand :
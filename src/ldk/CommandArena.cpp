@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/CommandArena.hpp>
+#include <WNS/Assure.hpp>
+
+#include <new>
+
+using namespace wns::ldk;
+
+const std::size_t CommandArena::alignment;
+
+CommandArena*
+CommandArena::create(std::size_t capacity)
+{
+	// arena | block header | storage
+	const std::size_t header = align(sizeof(CommandArena));
+	Block* first = createBlock(header, align(capacity));
+	return new (reinterpret_cast<unsigned char*>(first) - header) CommandArena(first);
+} // create
+
+
+CommandArena::Block*
+CommandArena::createBlock(std::size_t header, std::size_t capacity)
+{
+	unsigned char* memory = static_cast<unsigned char*>(
+		::operator new(header + Block::headerSize() + capacity));
+	Block* block = new (memory + header) Block();
+	block->next = NULL;
+	block->capacity = capacity;
+	block->fill = 0;
+	return block;
+} // createBlock
+
+
+CommandArena::CommandArena(Block* _first) :
+	references(1),
+	used(0),
+	first(_first),
+	current(_first)
+{
+} // CommandArena
+
+
+CommandArena::~CommandArena()
+{
+	Block* block = first->next;
+	while (block != NULL)
+	{
+		Block* next = block->next;
+		::operator delete(static_cast<void*>(block));
+		block = next;
+	}
+} // ~CommandArena
+
+
+void*
+CommandArena::allocate(std::size_t size)
+{
+	size = align(size);
+	if (current->capacity - current->fill < size)
+	{
+		std::size_t capacity = 2 * current->capacity;
+		if (capacity < size)
+		{
+			capacity = size;
+		}
+		Block* block = createBlock(0, capacity);
+		current->next = block;
+		current = block;
+	}
+
+	void* memory = current->storage() + current->fill;
+	current->fill += size;
+	used += size;
+	return memory;
+} // allocate
+
+
+bool
+CommandArena::contains(const void* p) const
+{
+	const unsigned char* byte = static_cast<const unsigned char*>(p);
+	for (const Block* block = first; block != NULL; block = block->next)
+	{
+		if (byte >= block->storage() && byte < block->storage() + block->capacity)
+		{
+			return true;
+		}
+	}
+	return false;
+} // contains
+
+
+std::size_t
+CommandArena::getNumberOfBlocks() const
+{
+	std::size_t number = 0;
+	for (const Block* block = first; block != NULL; block = block->next)
+	{
+		++number;
+	}
+	return number;
+} // getNumberOfBlocks
+
+
+void
+CommandArena::release()
+{
+	const long int remaining = CommandSharing::decrement(references);
+	assure(remaining >= 0, "CommandArena released too often");
+	if (remaining == 0)
+	{
+		this->~CommandArena();
+		::operator delete(static_cast<void*>(this));
+	}
+} // release
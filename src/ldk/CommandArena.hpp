@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_LDK_COMMANDARENA_HPP
+#define WNS_LDK_COMMANDARENA_HPP
+
+#include <WNS/RefCountable.hpp>
+
+#include <cstdlib>
+
+namespace wns { namespace ldk {
+
+	/**
+	 * @brief Counting policy for Commands and CommandArenas shared among
+	 * copies of a CommandPool
+	 *
+	 * The copies travel with their compounds, so the counts are atomic
+	 * if the reference counts of PDUs are (WNS_ATOMIC_PDU_REFCOUNT).
+	 */
+#ifdef WNS_ATOMIC_PDU_REFCOUNT
+	typedef wns::refcount::Atomic CommandSharing;
+#else
+	typedef wns::refcount::SingleThreaded CommandSharing;
+#endif
+
+	/**
+	 * @brief Contiguous storage for the Commands of a CommandPool
+	 * @ingroup commandtypespecifier
+	 *
+	 * The first block is allocated together with the arena (a single heap
+	 * allocation). Its capacity is chosen by the CommandPool: the size of
+	 * a whole activation path for pools that activate Commands, a single
+	 * Command for copies that only copy a shared Command on write.
+	 * Commands are constructed in the arena with placement new. If a
+	 * block is full, another block of at least twice its capacity is
+	 * appended, Commands never move.
+	 * <p>
+	 * Commands may outlive their CommandPool if they are shared with
+	 * copies of the pool (see CommandPool). Hence, the arena counts its
+	 * references (the owning pool plus each live Command in it) and
+	 * frees itself when the last one is released.
+	 */
+	class CommandArena
+	{
+	public:
+		/**
+		 * @brief Alignment of each Command within the arena
+		 */
+		static const std::size_t alignment = 16;
+
+		/**
+		 * @brief Create an arena with capacity bytes in its first block,
+		 * referenced once (by the creating CommandPool)
+		 */
+		static CommandArena*
+		create(std::size_t capacity);
+
+		/**
+		 * @brief Round size up to the alignment
+		 */
+		static std::size_t
+		align(std::size_t size)
+		{
+			return (size + alignment - 1) / alignment * alignment;
+		}
+
+		/**
+		 * @brief Storage for an object of size bytes
+		 */
+		void*
+		allocate(std::size_t size);
+
+		/**
+		 * @brief True if p points into this arena's storage
+		 */
+		bool
+		contains(const void* p) const;
+
+		/**
+		 * @brief Number of bytes handed out so far (aligned)
+		 */
+		std::size_t
+		getUsed() const
+		{
+			return used;
+		}
+
+		/**
+		 * @brief Number of blocks allocated so far
+		 */
+		std::size_t
+		getNumberOfBlocks() const;
+
+		void
+		acquire()
+		{
+			CommandSharing::increment(references);
+		}
+
+		/**
+		 * @brief Drop one reference, the arena is freed with the last one
+		 */
+		void
+		release();
+
+	private:
+		/**
+		 * @brief Header of each block, followed by its storage
+		 */
+		struct Block
+		{
+			Block* next;
+			std::size_t capacity;
+			std::size_t fill;
+
+			unsigned char*
+			storage()
+			{
+				return reinterpret_cast<unsigned char*>(this) + headerSize();
+			}
+
+			const unsigned char*
+			storage() const
+			{
+				return reinterpret_cast<const unsigned char*>(this) + headerSize();
+			}
+
+			static std::size_t
+			headerSize()
+			{
+				return align(sizeof(Block));
+			}
+		};
+
+		CommandArena(Block* first);
+
+		~CommandArena();
+
+		/**
+		 * @brief Allocate a block with capacity bytes of storage
+		 * (behind header bytes for the arena itself)
+		 */
+		static Block*
+		createBlock(std::size_t header, std::size_t capacity);
+
+		long int references;
+		std::size_t used;
+
+		/**
+		 * @brief The block allocated with the arena
+		 */
+		Block* first;
+
+		/**
+		 * @brief The block allocations are served from
+		 */
+		Block* current;
+	};
+
+} // ldk
+} // wns
+
+#endif // NOT defined WNS_LDK_COMMANDARENA_HPP
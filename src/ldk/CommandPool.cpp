@@ -28,6 +28,7 @@
 #include <WNS/ldk/Layer.hpp>
 #include <WNS/ldk/FunctionalUnit.hpp>
 #include <WNS/ldk/Command.hpp>
+#include <WNS/ldk/CommandArena.hpp>
 #include <WNS/TypeInfo.hpp>
 
 #include <WNS/Exception.hpp>
@@ -43,6 +44,10 @@ CommandPool::CommandPool(const CommandProxy* _proxy,
 	path(),
 	proxy(_proxy),
 	commands(),
+	arena(NULL),
+	sizesEpoch(0),
+	cachedCommandPoolSize(0),
+	cachedDataSize(0),
 	origin(_origin),
 	receiver(NULL)
 {
@@ -54,6 +59,10 @@ CommandPool::CommandPool(const CommandPool& that) :
 	PCI(that),
 	proxy(that.proxy),
 	commands(),
+	arena(NULL),
+	sizesEpoch(0),
+	cachedCommandPoolSize(0),
+	cachedDataSize(0),
 	origin(that.origin),
 	receiver(that.receiver)
 {
@@ -63,17 +72,19 @@ CommandPool::CommandPool(const CommandPool& that) :
 
 CommandPool::~CommandPool()
 {
-	CommandContainer::const_iterator end = commands.end();
-	for (CommandContainer::const_iterator ii = commands.begin();
-	     ii != end;
-	     ++ii)
+	for (CommandProxy::CommandIDType id = 0; id < commands.size(); ++id)
 	{
-		Command* command = *ii;
+		Command* command = commands[id];
 		if (NULL != command)
 		{
-			delete command;
+			release(id, command);
 		}
 	}
+
+	if (NULL != arena)
+	{
+		arena->release();
+	}
 } // ~CommandPool
 
 
@@ -97,6 +108,7 @@ CommandPool::setSDUPtr(osi::PDUPtr& sdu)
 	}
 
 	PCI::setSDU(sdu);
+	CommandProxy::invalidateSizes(this);
 } // setSDU
 
 std::string
@@ -158,8 +170,148 @@ CommandPool::insert(
 	}
 
 	commands.at(id) = command;
+
+	if (NULL != arena && arena->contains(command))
+	{
+		command->arena = arena;
+		arena->acquire();
+	}
+}
+
+void*
+CommandPool::allocateCommand(std::size_t size, std::size_t capacity) const
+{
+	if (0 == size)
+	{
+		return NULL;
+	}
+
+	if (NULL == arena)
+	{
+		arena = CommandArena::create(capacity < size ? size : capacity);
+	}
+	return arena->allocate(size);
 }
 
+void
+CommandPool::release(
+	const CommandProxy::CommandIDType& id,
+	Command* command) const
+{
+#ifndef WNS_NDEBUG
+	checkSeal(id, command);
+#endif
+	if (CommandSharing::decrement(command->pools) == 0)
+	{
+		destroy(command);
+	}
+}
+
+void
+CommandPool::destroy(Command* command)
+{
+	CommandArena* home = command->arena;
+	if (NULL != home)
+	{
+		command->~Command();
+		home->release();
+	}
+	else
+	{
+		delete command;
+	}
+}
+
+void
+CommandPool::share(
+	const CommandProxy::CommandIDType& id,
+	Command* command)
+{
+	insert(id, command);
+	CommandSharing::increment(command->pools);
+#ifndef WNS_NDEBUG
+	seal(id, command);
+#endif
+}
+
+wns::ldk::Command*
+CommandPool::unshare(
+	const CommandProxy::CommandIDType& id,
+	Command* copy) const
+{
+	Command* shared = commands.at(id);
+	assure(shared->isShared(), "Command is not shared");
+#ifndef WNS_NDEBUG
+	checkSeal(id, shared);
+#endif
+	assure(copy->pools == 1, "Copy must not be shared");
+	commands.at(id) = copy;
+	// the other CommandPools may have released it meanwhile
+	if (CommandSharing::decrement(shared->pools) == 0)
+	{
+		destroy(shared);
+	}
+
+	if (NULL != arena && arena->contains(copy))
+	{
+		copy->arena = arena;
+		arena->acquire();
+	}
+	return copy;
+}
+
+#ifndef WNS_NDEBUG
+void
+CommandPool::seal(
+	const CommandProxy::CommandIDType& id,
+	Command* command) const
+{
+	if (command->sealed)
+	{
+		// shared already, still unmodified?
+		checkSeal(id, command);
+		return;
+	}
+	command->sealedSize = proxy->getCommandObjSize(id);
+	command->fingerprint = calculateFingerprint(command);
+	command->sealed = true;
+}
+
+void
+CommandPool::checkSeal(
+	const CommandProxy::CommandIDType& id,
+	const Command* command) const
+{
+	assure(!command->sealed || command->fingerprint == calculateFingerprint(command),
+	       "Command " << TypeInfo::create(*command) << " (Command ID: " << id << ") "
+	       "has been modified while shared by copies of its CommandPool. "
+	       "A Command* retrieved before copying a CommandPool must not be "
+	       "used for writing afterwards, use getCommand again.");
+}
+
+unsigned long int
+CommandPool::calculateFingerprint(const Command* command)
+{
+	// FNV-1a over the object, skipping the Command base class whose
+	// bookkeeping (e.g. the number of sharing CommandPools) changes
+	const unsigned char* object = static_cast<const unsigned char*>(dynamic_cast<const void*>(command));
+	const unsigned char* base = reinterpret_cast<const unsigned char*>(command);
+	const size_t size = command->sealedSize;
+
+	unsigned long int hash = 2166136261UL;
+	for (size_t ii = 0; ii < size; ++ii)
+	{
+		const unsigned char* byte = object + ii;
+		if (byte >= base && byte < base + sizeof(Command))
+		{
+			continue;
+		}
+		hash = (hash ^ *byte) * 16777619UL;
+	}
+	return hash;
+}
+#endif
+
 wns::ldk::Command*
 CommandPool::find(const CommandProxy::CommandIDType& id) const
 {
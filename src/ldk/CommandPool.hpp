@@ -33,6 +33,7 @@
 #include <WNS/osi/PDU.hpp>
 #include <WNS/osi/PCI.hpp>
 #include <WNS/container/Registry.hpp>
+#include <WNS/FreeList.hpp>
 
 #include <vector>
 
@@ -41,6 +42,7 @@ namespace wns { namespace ldk {
 	class FunctionalUnit;
 	class Command;
 	class CommandTypeSpecifierInterface;
+	class CommandArena;
 
 	/**
 	 * @brief Build a PCI from a set of Commands.
@@ -70,10 +72,15 @@ namespace wns { namespace ldk {
 	 * This is why we chose the second approach. CommandPool is a PCI
 	 * built from a set of Commands. A CommandPool will never be accessed
 	 * directly. Use a CommandProxy instead.
-	 *
+	 * <p>
+	 * CommandPools are allocated from a thread-local freelist (see
+	 * wns::PooledAllocation). The Commands of a CommandPool are
+	 * constructed in its CommandArena, sized by the CommandProxy for
+	 * a whole activation path.
 	 */
 	class CommandPool :
-		public wns::osi::PCI
+		public wns::osi::PCI,
+		public wns::PooledAllocation<CommandPool>
 	{
 		// Only CommandProxy instances are allowed to create new CommandPool
 		// instances and access their data directly.
@@ -102,11 +109,20 @@ namespace wns { namespace ldk {
 		 * It is not allowed to change any Command that has been activated before
 		 * segmentation between segmentation and reassembly.
 		 * The reassembler may assert that.
+		 * <p>
+		 * The Commands are not copied right away but shared with that. A
+		 * Command is copied when it is retrieved for writing from one of
+		 * the sharing CommandPools (see CommandProxy::getCommand). Hence,
+		 * a Command* retrieved before copying the CommandPool must not be
+		 * used to modify the Command afterwards. Retrieve it again with
+		 * getCommand instead. Debug builds detect such modifications the
+		 * next time the Command is accessed (see seal).
 		 */
 		CommandPool(const CommandPool& that);
 
 		/**
-		 * @brief Destructor - call destructor of all Commands.
+		 * @brief Destructor - call destructor of all Commands not shared
+		 * with other CommandPools.
 		 *
 		 */
 		~CommandPool();
@@ -188,6 +204,77 @@ namespace wns { namespace ldk {
 			const CommandProxy::CommandIDType& id,
 			Command* command);
 
+		/**
+		 * @brief Storage for a Command of size bytes within the
+		 * CommandArena of this CommandPool, NULL if size is unknown (0)
+		 *
+		 * The arena is created on first use with room for capacity
+		 * bytes and grows if needed.
+		 */
+		void*
+		allocateCommand(std::size_t size, std::size_t capacity) const;
+
+		/**
+		 * @brief Drop this CommandPool's reference to the Command id
+		 */
+		void
+		release(
+			const CommandProxy::CommandIDType& id,
+			Command* command) const;
+
+		/**
+		 * @brief Destroy a Command no CommandPool refers to anymore
+		 */
+		static void
+		destroy(Command* command);
+
+		/**
+		 * @brief Insert a Command of another CommandPool, both share it
+		 * afterwards
+		 */
+		void
+		share(
+			const CommandProxy::CommandIDType& id,
+			Command* command);
+
+		/**
+		 * @brief Replace the shared Command id by its private copy
+		 */
+		Command*
+		unshare(
+			const CommandProxy::CommandIDType& id,
+			Command* copy) const;
+
+#ifndef WNS_NDEBUG
+		/**
+		 * @brief Remember the contents of a Command that becomes shared
+		 *
+		 * A sealed Command must not be modified until a CommandPool
+		 * retrieves it for writing (CommandProxy::getCommand), which
+		 * either copies or unseals it. checkSeal detects modifications
+		 * through a Command* retrieved before the CommandPool was copied.
+		 */
+		void
+		seal(
+			const CommandProxy::CommandIDType& id,
+			Command* command) const;
+
+		/**
+		 * @brief Assure that a sealed Command has not been modified
+		 */
+		void
+		checkSeal(
+			const CommandProxy::CommandIDType& id,
+			const Command* command) const;
+
+		/**
+		 * @brief Hash over the first sealedSize bytes of the Command
+		 * (without the bookkeeping of the Command base class)
+		 */
+		static unsigned long int
+		calculateFingerprint(const Command* command);
+#endif
+
 		/**
 		 * @brief find a Command in the CommandPool
 		 */
@@ -208,8 +295,33 @@ namespace wns { namespace ldk {
 
 		/**
 		 * @brief Commands are stored here
+		 *
+		 * Mutable since copy-on-write replaces shared Commands even on
+		 * const access (the content stays the same).
+		 */
+		mutable CommandContainer commands;
+
+		/**
+		 * @brief Storage of the Commands activated in (or copied to)
+		 * this CommandPool
+		 */
+		mutable CommandArena* arena;
+
+		/**
+		 * @brief CommandProxy::getSizeEpoch() when the cached sizes
+		 * were calculated (0: invalid)
+		 */
+		mutable unsigned long int sizesEpoch;
+
+		/**
+		 * @brief Cached result of calculateSizes without questioner
+		 */
+		mutable Bit cachedCommandPoolSize;
+
+		/**
+		 * @brief Cached result of calculateSizes without questioner
 		 */
-		CommandContainer commands;
+		mutable Bit cachedDataSize;
 
 		/**
 		 * @brief Origin where this commandPool was created
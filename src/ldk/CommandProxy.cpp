@@ -30,6 +30,7 @@
 #include <WNS/ldk/fun/FUN.hpp>
 #include <WNS/ldk/FunctionalUnit.hpp>
 #include <WNS/ldk/Command.hpp>
+#include <WNS/ldk/CommandArena.hpp>
 #include <WNS/ldk/Compound.hpp>
 #include <WNS/TypeInfo.hpp>
 #include <WNS/Exception.hpp>
@@ -38,9 +39,23 @@
 using namespace wns::ldk;
 
 CommandProxy::CommandIDType CommandProxy::serial = CommandIDType(0);
+unsigned long int CommandProxy::sizeEpoch = 1;
+
+namespace {
+	/**
+	 * @brief Counts size calculations of whole CommandPools and
+	 * invalidations of single CommandPools in this thread
+	 *
+	 * If it changes while the sizes of a CommandPool are calculated,
+	 * they depend on another CommandPool or the CommandPool has been
+	 * modified meanwhile, and the result is not cached.
+	 */
+	__thread unsigned long int sizeEvents = 0;
+}
 
 CommandProxy::CommandProxy(const wns::pyconfig::View& config) :
-	logger(config.get("logger"))
+	logger(config.get("logger")),
+	arenaCapacity(0)
 {
     wns::simulator::getResetSignal()->connect(&wns::ldk::CommandProxy::clearRegistries);
 }
@@ -201,9 +216,51 @@ CommandProxy::getCommand(
 
 	Command* command = commandPool->find(n);
 
+	// the caller may modify the command and thus the sizes
+	invalidateSizes(commandPool);
+
+	if (command->isShared())
+	{
+		// copy-on-write: the caller may modify the command
+		// a copy usually modifies few Commands, its arena only grows as
+		// needed
+		const CopyCommandInterface* copier = this->getCopyCommandRegistry().find(n);
+		const std::size_t size = this->getCommandObjSize(n);
+		void* memory = commandPool->allocateCommand(size, size);
+		command = commandPool->unshare(
+			n,
+			memory != NULL ? copier->copy(command, memory) : copier->copy(command));
+	}
+#ifndef WNS_NDEBUG
+	else
+	{
+		// formerly shared, the only remaining owner may write again
+		commandPool->checkSeal(n, command);
+		command->sealed = false;
+	}
+#endif
+
 	return command;
 } // getCommand
 
+
+const wns::ldk::Command*
+CommandProxy::peekCommand(
+	const CommandPool* commandPool,
+	CommandIDType n) const
+{
+	assure(commandPool != NULL, "Invalid argument.");
+	assure(commandPool->knows(n),
+	       "Command (Command ID: " << n << ") not activated in CommandPool. Only activated Commands may be retrieved." <<
+	       "\nThe following commands are in the CommandPool:\n" << commandPool->dumpCommandTypes() <<
+	       "\nThe following commands are registered at the CommandProxy:\n" << dumpCommandIDRegistry());
+
+#ifndef WNS_NDEBUG
+	commandPool->checkSeal(n, commandPool->find(n));
+#endif
+	return commandPool->find(n);
+} // peekCommand
+
 CommandReaderInterface*
 CommandProxy::getCommandReader(const std::string& role) const
 {
@@ -245,7 +302,15 @@ CommandProxy::activateCommand(
             << " already added to command pool. Trying to activate an already activated Command.\n"
             << dumpCommandIDRegistry());
 
-	Command* command = kind->createCommand();
+	// new CommandPools reserve room for the longest activation path seen
+	const CommandProxy* owner = commandPool->proxy;
+	void* memory = commandPool->allocateCommand(kind->getCommandObjSize(), owner->arenaCapacity);
+	Command* command = memory != NULL ? kind->createCommand(memory) : kind->createCommand();
+
+	if (NULL != commandPool->arena && commandPool->arena->getUsed() > owner->arenaCapacity)
+	{
+		owner->arenaCapacity = commandPool->arena->getUsed();
+	}
 
 	commandPool->insert(kind->getPCIID(), command);
 
@@ -255,7 +320,9 @@ CommandProxy::activateCommand(
 	    ++i)
 		assure(*i != kind->getPCIID(), "Corrupted path: trying to add a CommandTypeSpecifierInterface twice.");
 #endif
+	command->position = commandPool->path.size();
 	commandPool->path.push_back(kind->getPCIID());
+	invalidateSizes(commandPool);
 
 	return command;
 } // activateCommand
@@ -291,23 +358,19 @@ CommandProxy::getNext(
 		return getCommandTypeSpecifier(commandPool->path.back());
 	}
 
-	CommandPool::PathContainer::const_iterator i;
-	for(i = commandPool->path.begin();
-	    i != commandPool->path.end();
-	    ++i)
-	{
-		if(*i == questioner->getPCIID())
-			break;
-	}
-	assure(i != commandPool->path.end(), "Questioner is not in path. This could mean that you have included a FU on the receiver side but not on the sender side.");
+	// Every Command knows its index in the path, no need to search it
+	const CommandIDType id = questioner->getPCIID();
+	assure(commandPool->knows(id) &&
+	       commandPool->path.at(commandPool->find(id)->position) == id,
+	       "Questioner is not in path. This could mean that you have included a FU on the receiver side but not on the sender side.");
+
+	const unsigned long int position = commandPool->find(id)->position;
 
 	// delegate up one level.
-	if(i == commandPool->path.begin())
+	if(position == 0)
 		return NULL;
 
-	--i;
-
-	return this->getCommandTypeSpecifier(*i);
+	return this->getCommandTypeSpecifier(commandPool->path[position - 1]);
 } // getNext
 
 
@@ -325,11 +388,74 @@ CommandProxy::createReply(
 } // createReplyPCI
 
 
+void
+CommandProxy::invalidateSizes(const CommandPool* commandPool)
+{
+	commandPool->sizesEpoch = 0;
+	++sizeEvents;
+} // invalidateSizes
+
 void
 CommandProxy::calculateSizes(
 	const CommandPool* commandPool,
 	Bit& commandPoolSize, Bit& dataSize,
 	const CommandTypeSpecifierInterface* questioner) const
+{
+#ifndef WNS_NO_SIZE_CACHE
+	// The sizes of the whole CommandPool (no questioner) are asked for
+	// repeatedly by schedulers and probes, remember them until something
+	// may have changed.
+	if(!questioner)
+	{
+		// a container asking for the sizes of its content must not
+		// cache its own
+		++sizeEvents;
+
+		const unsigned long int epoch = getSizeEpoch();
+		if(commandPool->sizesEpoch == epoch)
+		{
+			commandPoolSize = commandPool->cachedCommandPoolSize;
+			dataSize = commandPool->cachedDataSize;
+#ifndef WNS_NDEBUG
+			// Catch modifications the cache has not been told about
+			Bit currentCommandPoolSize = 0;
+			Bit currentDataSize = 0;
+			this->calculatePathSizes(commandPool, currentCommandPoolSize, currentDataSize, NULL);
+			assure(currentCommandPoolSize == commandPoolSize && currentDataSize == dataSize,
+			       "Cached sizes of the CommandPool are stale (cached: "
+			       << commandPoolSize << "+" << dataSize << " bit, actual: "
+			       << currentCommandPoolSize << "+" << currentDataSize << " bit). "
+			       "A Command has been modified through a Command* retrieved "
+			       "before the last size query, or a FunctionalUnit changed "
+			       "state used in its calculateSizes without calling "
+			       "CommandProxy::invalidateSizes().");
+#endif
+			return;
+		}
+
+		const unsigned long int events = sizeEvents;
+		this->calculatePathSizes(commandPool, commandPoolSize, dataSize, NULL);
+
+		// not if FunctionalUnits called getCommand or asked for the
+		// sizes of other CommandPools during the calculation
+		if(events == sizeEvents)
+		{
+			commandPool->cachedCommandPoolSize = commandPoolSize;
+			commandPool->cachedDataSize = dataSize;
+			commandPool->sizesEpoch = epoch;
+		}
+		return;
+	}
+#endif
+	this->calculatePathSizes(commandPool, commandPoolSize, dataSize, questioner);
+} // calculateSizes
+
+
+void
+CommandProxy::calculatePathSizes(
+	const CommandPool* commandPool,
+	Bit& commandPoolSize, Bit& dataSize,
+	const CommandTypeSpecifierInterface* questioner) const
 {
 	const CommandTypeSpecifierInterface* next = this->getNext(commandPool, questioner);
 
@@ -372,7 +498,7 @@ CommandProxy::calculateSizes(
 	MESSAGE_BEGIN(VERBOSE, logger,m,"End of recursion, adding SDU size ");
 	m << " - commandPoolSize: " << commandPoolSize << " dataSize: " << dataSize;
 	MESSAGE_END();
-} // calculateSizes
+} // calculatePathSizes
 
 
 void
@@ -463,14 +589,23 @@ CommandProxy::cleanup(CommandPool* commandPool) const
 void
 CommandProxy::copy(CommandPool* dst, const CommandPool* src) const
 {
+	// Segmentation copies a CommandPool per segment. Size the
+	// containers once instead of growing them Command by Command.
+	if (dst->commands.size() < src->commands.size())
+	{
+		dst->commands.resize(src->commands.size(), NULL);
+	}
+	dst->path.reserve(dst->path.size() + src->path.size());
+
 	for(CommandPool::PathContainer::const_iterator it = src->path.begin();
 	    it != src->path.end();
 	    ++it)
 	{
 		CommandIDType id = *it;
-		dst->insert(id, this->getCopyCommandRegistry().find(id)->copy(src->find(id)));
+		dst->share(id, src->find(id));
 		dst->path.push_back(id);
 	}
+	invalidateSizes(dst);
 } // copy
 
 
@@ -481,6 +616,8 @@ CommandProxy::partialCopy(
 {
 	CommandIDType initiatorID = initiator->getPCIID();
 
+	dst->path.reserve(dst->path.size() + src->path.size());
+
 	CommandPool::PathContainer::const_iterator it = src->path.begin();
 	for(;it != src->path.end();
 	    ++it)
@@ -490,10 +627,11 @@ CommandProxy::partialCopy(
 		if(id == initiatorID)
 			break;
 
-		dst->insert(id, this->getCopyCommandRegistry().find(id)->copy(src->find(id)));
+		dst->share(id, src->find(id));
 		dst->path.push_back(id);
 	}
 	assure(it != src->path.end(), "partial copy failed, initiator was not found in activation path");
+	invalidateSizes(dst);
 } // partialCopy
 
 
@@ -556,7 +694,6 @@ CommandProxy::clearRegistries()
 	CommandProxy::getCommandReaderRegistry().clear();
 }
 
-#ifndef NDEBUG
 size_t
 CommandProxy::getCommandObjSize(const CommandIDType& id) const
 {
@@ -568,6 +705,5 @@ CommandProxy::getCommandObjSize(const CommandIDType& id) const
         return 0;
     }
 }
-#endif
 
 
@@ -113,7 +113,8 @@ namespace wns { namespace ldk {
 		CommandProxy() :
 			logger("default","default"),
 			commandTypeSpecifiers(),
-			commandTypeSpecifierCloned()
+			commandTypeSpecifierCloned(),
+			arenaCapacity(0)
 		{
             wns::simulator::getResetSignal()->connect(&wns::ldk::CommandProxy::clearRegistries); 
 		}
@@ -212,6 +213,13 @@ namespace wns { namespace ldk {
 		 * FunctionalUnit in turn may choose to delegate the size
 		 * calculation request back to the proxy with itself as
 		 * questioner.
+		 * <p>
+		 * The sizes of the whole CommandPool (no questioner) are cached
+		 * within the CommandPool until a Command of it is activated or
+		 * retrieved for modification, its SDU is set or
+		 * invalidateSizes is called (define WNS_NO_SIZE_CACHE to
+		 * disable). Sizes depending on other CommandPools (e.g. of
+		 * containers) are not cached.
 		 */
 		void
 		calculateSizes(
@@ -219,6 +227,43 @@ namespace wns { namespace ldk {
 			Bit& commandPoolSize, Bit& sduSize,
 			const CommandTypeSpecifierInterface* questioner = NULL) const;
 
+		/**
+		 * @brief Mark all size results cached by CommandPools as
+		 * stale.
+		 *
+		 * calculateSizes caches the sizes seen from the top of the
+		 * activation path per CommandPool. Activating or retrieving a
+		 * Command for modification, setting the SDU and copying
+		 * Commands into a CommandPool invalidate the cache of that
+		 * CommandPool automatically. Call this if the sizes change
+		 * otherwise, e.g. if a FunctionalUnit changes state it uses in
+		 * calculateSizes or writes to a Command it obtained before the
+		 * last size query.
+		 * Builds with assures enabled recalculate the sizes on every
+		 * cache hit and assure that they did not change.
+		 */
+		static void
+		invalidateSizes()
+		{
+			__sync_add_and_fetch(&sizeEpoch, 1);
+		}
+
+		/**
+		 * @brief Cached sizes are valid as long as this has not
+		 * changed
+		 */
+		static unsigned long int
+		getSizeEpoch()
+		{
+			return __atomic_load_n(&sizeEpoch, __ATOMIC_RELAXED);
+		}
+
+		/**
+		 * @brief Mark the sizes cached by commandPool as stale
+		 */
+		static void
+		invalidateSizes(const CommandPool* commandPool);
+
 		/**
 		 * @brief 
 		 */
@@ -246,10 +291,21 @@ namespace wns { namespace ldk {
 
 		/**
 		 * @brief Return the nth Command within a CommandPool.
+		 *
+		 * If the Command is shared with a copy of the CommandPool, the
+		 * CommandPool gets its own copy of the Command first
+		 * (copy-on-write), since the caller may modify it.
 		 */
 		Command*
 		getCommand(const CommandPool* commandPool, CommandIDType n) const;
 
+		/**
+		 * @brief Read-only access to the nth Command within a
+		 * CommandPool, shared Commands are not copied.
+		 */
+		const Command*
+		peekCommand(const CommandPool* commandPool, CommandIDType n) const;
+
 		/**
 		 * @brief Return a reference to a Command instance within a CommandPool.
 		 *
@@ -365,10 +421,20 @@ namespace wns { namespace ldk {
                 return dumpCommandIDRegistry();
             }
 
-#ifndef NDEBUG
 		size_t
 		getCommandObjSize(const CommandIDType& id) const;
-#endif
+
+		/**
+		 * @brief Capacity of the CommandArena of a new CommandPool
+		 *
+		 * The largest number of bytes activated Commands have needed in
+		 * a CommandPool so far, i.e. usually one activation path.
+		 */
+		std::size_t
+		getArenaCapacity() const
+		{
+			return arenaCapacity;
+		}
 	private:
 		/**
 		 * @brief Call destructors of Commands within the CommandPool.
@@ -387,6 +453,15 @@ namespace wns { namespace ldk {
 		const CommandTypeSpecifierInterface*
 		getCommandTypeSpecifier(CommandIDType id) const;
 
+		/**
+		 * @brief Size calculation without cache, see calculateSizes
+		 */
+		void
+		calculatePathSizes(
+			const CommandPool* commandPool,
+			Bit& commandPoolSize, Bit& sduSize,
+			const CommandTypeSpecifierInterface* questioner) const;
+
 		/**
 		 * @brief Returns the CommandTypeSpecifier above the questioner.
 		 */
@@ -399,8 +474,12 @@ namespace wns { namespace ldk {
 
 		BoolContainer commandTypeSpecifierCloned;
 
+		mutable std::size_t arenaCapacity;
+
 		static CommandIDType serial;
 
+		static unsigned long int sizeEpoch;
+
 		static CommandIDRegistry&
 		getCommandIDRegistry();
 
@@ -34,4 +34,12 @@ using namespace wns::ldk;
 
 const unsigned long CommandTypeSpecifierInterface::invalidID = std::numeric_limits<int>::max();
 
+const Command*
+CommandTypeSpecifierInterface::peekCommandBase(const CommandPool* commandPool) const
+{
+	assure(commandPool != NULL, "Invalid argument.");
+
+	return getFUN()->getProxy()->peekCommand(commandPool, this->getPCIID());
+} // peekCommandBase
+
 
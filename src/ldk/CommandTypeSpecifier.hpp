@@ -41,6 +41,7 @@
 #include <vector>
 #include <cstdlib>				// NULL, size_t
 #include <limits>
+#include <new>
 
 
 namespace wns { namespace ldk {
@@ -113,6 +114,23 @@ namespace wns { namespace ldk {
 			return static_cast<COMMANDTYPE*>(command);
 		}
 
+		/**
+		 * @brief Read-only access to the Command of this
+		 * CommandTypeSpecifier.
+		 *
+		 * Other than getCommand this does not copy a Command that is
+		 * shared among copies of the CommandPool.
+		 */
+		const COMMANDTYPE* peekCommand(const CommandPool* commandPool) const
+		{
+			assure(commandPool != NULL, "Invalid argument.");
+
+			const Command* command = getFUN()->getProxy()->peekCommand(commandPool, this->getPCIID());
+
+			assureType(command, const COMMANDTYPE*);
+			return static_cast<const COMMANDTYPE*>(command);
+		}
+
 		/**
 		 * @brief Like getCommand(const CommandPool* commandPool) const
 		 * but with CompoundPtr instead
@@ -187,7 +205,7 @@ namespace wns { namespace ldk {
 		calculateSizes(const CommandPool* commandPool, Bit& commandPoolSize, Bit& dataSize) const
 		{
 			getFUN()->getProxy()->calculateSizes(commandPool, commandPoolSize, dataSize, this);
-			Command* command = getFUN()->getProxy()->getCommand(commandPool, this);
+			const Command* command = getFUN()->getProxy()->peekCommand(commandPool, this->getPCIID());
 
 			commandPoolSize += command->getSize();
 		} // calculateSizes
@@ -214,13 +232,11 @@ namespace wns { namespace ldk {
 			return new CopyCommand<COMMANDTYPE>;
 		}
 
-#ifndef NDEBUG
 		virtual size_t
 		getCommandObjSize() const
 		{
 			return sizeof( COMMANDTYPE );
 		}
-#endif
 
 	private:
 		COMMANDTYPE*
@@ -229,6 +245,13 @@ namespace wns { namespace ldk {
 			return new COMMANDTYPE();
 		} // createCommand
 
+		COMMANDTYPE*
+		createCommand(void* memory) const
+		{
+			// Command hides the global placement new
+			return ::new (memory) COMMANDTYPE();
+		} // createCommand
+
 		COMMANDTYPE*
 		copyCommand(const Command* src) const
 		{
@@ -251,6 +274,13 @@ namespace wns { namespace ldk {
 				assureType(src, const COMMAND*);
 				return new COMMAND(*(dynamic_cast<const COMMAND*>(src)));
 			}
+
+			virtual COMMAND*
+			copy(const Command* src, void* memory) const
+			{
+				assureType(src, const COMMAND*);
+				return ::new (memory) COMMAND(*(dynamic_cast<const COMMAND*>(src)));
+			}
 		};
 
 		class CommandReader :
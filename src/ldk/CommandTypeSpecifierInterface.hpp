@@ -44,6 +44,12 @@ namespace wns { namespace ldk {
 
 		virtual Command*
 		copy(const Command*) const = 0;
+
+		/**
+		 * @brief Copy into the given storage (placement new)
+		 */
+		virtual Command*
+		copy(const Command*, void* memory) const = 0;
 	};
 
 
@@ -88,6 +94,15 @@ namespace wns { namespace ldk {
 		virtual Command* getCommand(const CommandPool* commandPool) const = 0;
 		virtual Command* activateCommand(CommandPool* commandPool) const = 0;
 
+		/**
+		 * @brief Read-only access to the Command of this
+		 * CommandTypeSpecifier without knowing its type.
+		 *
+		 * Other than getCommand this does not copy a Command that is
+		 * shared among copies of the CommandPool.
+		 */
+		const Command* peekCommandBase(const CommandPool* commandPool) const;
+
 		/**
 		 * @brief Create a reply to the given CommandPool.
 		 *
@@ -110,10 +125,8 @@ namespace wns { namespace ldk {
 		virtual CopyCommandInterface*
 		getCopyCommandInterface() const = 0;
 
-#ifndef NDEBUG
 		virtual size_t
 		getCommandObjSize() const = 0;
-#endif
 
 	protected:
 		void setPCIID(unsigned long _id)
@@ -149,6 +162,10 @@ namespace wns { namespace ldk {
 		virtual void commitSizes(CommandPool* commandPool) const = 0;
 	private:
 		virtual Command* createCommand() const = 0;
+		/**
+		 * @brief Construct the Command in the given storage (placement new)
+		 */
+		virtual Command* createCommand(void* memory) const = 0;
 		virtual Command* copyCommand(const Command* src) const = 0;
 		virtual CommandReaderInterface* getCommandReader(CommandProxy*) = 0;
 
@@ -39,15 +39,21 @@ using namespace wns::ldk;
 void
 Compound::visit(const FunctionalUnit* fu) const // JOURNEY
 {
-	simTimeType now = wns::simulator::getEventScheduler()->getTime();
+	assure(fu != NULL, "Invalid argument.");
 
-	std::stringstream ss;
-	ss << fu->getFUN()->getLayer()->getNodeName() << "."
-	   << fu->getFUN()->getName() << "."
-	   << fu->getName()
-	   << ", Type: " << TypeInfo::create(*fu);
+	// the location string is built once per FU
+	if (fu->journeyLocation == 0)
+	{
+		std::stringstream ss;
+		ss << fu->getFUN()->getLayer()->getNodeName() << "."
+		   << fu->getFUN()->getName() << "."
+		   << fu->getName()
+		   << ", Type: " << TypeInfo::create(*fu);
 
-	journey.push_back(Visit(now, ss.str()));
+		fu->journeyLocation = Journey::intern(ss.str());
+	}
+
+	journey.record(wns::simulator::getEventScheduler()->getTime(), fu->journeyLocation);
 } // visit
 
 
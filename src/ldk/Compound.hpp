@@ -36,53 +36,50 @@
 #include <WNS/Birthmark.hpp>
 #include <WNS/Assure.hpp>
 #include <WNS/TypeInfo.hpp>
+#include <WNS/FreeList.hpp>
 
 /*
  * for compound journeys (JOURNEY)
  * Journey records the path of a compound through FUs.
- * this is expensive and should be made optional.
  * to find all changes due to this journey path, search for
  * the tag JOURNEY (within libwns and glue.)
  */
-#include <list>
+#include <WNS/ldk/Journey.hpp>
 #include <cstdio>
 
 namespace wns { namespace ldk {
 
 	class FunctionalUnit;
 
-	struct Visit
-	{
-		Visit(simTimeType _t, const std::string& _location) :
-				t(_t),
-				location(_location)
-		{}
-
-		simTimeType t;
-		std::string location;
-
-		bool
-		operator==(const Visit& other) const
-		{
-			return (t == other.t) && (location == other.location);
-		}
-	};
-
 	/**
 	 * @brief Basic transmission unit within a fun::FUN.
+	 *
+	 * Compounds are allocated from a thread-local freelist (see
+	 * wns::PooledAllocation).
 	 */
 	class Compound :
 		public virtual HasBirthmark,
-		public wns::osi::PDU
+		public wns::osi::PDU,
+		public wns::PooledAllocation<Compound>
 	{
 	public:
-		typedef std::list<Visit> JourneyContainer;
-
 		Compound(CommandPool* commandPool = NULL, const wns::osi::PDUPtr& sdu = wns::osi::PDUPtr()) :
 			wns::osi::PDU(commandPool, sdu.getPtr()),
 			fu(NULL)
 		{}
 
+		/**
+		 * @brief Compound with its own CommandPool, but the same data,
+		 * birthmark and journey as origin
+		 */
+		Compound(CommandPool* commandPool, const Compound& origin) :
+			wns::osi::PDU(commandPool, origin.getData().getPtr()),
+			journey(origin.journey),
+			fu(NULL)
+		{
+			setBirthmark(origin.getBirthmark());
+		}
+
 		CommandPool*
 		getCommandPool() const
 		{
@@ -113,23 +110,10 @@ namespace wns { namespace ldk {
 		std::string
 		dumpJourney() const		// JOURNEY
 		{
-			std::stringstream ss;
-
-			for(JourneyContainer::iterator it = journey.begin();
-				it != journey.end();
-				++it) {
-				ss << "\n(";
-				ss.width(11);
-				ss.setf(std::ios_base::fixed, std::ios_base::floatfield);
-				ss.precision(7);
-				ss << std::right << it->t << ") " << it->location.c_str();
-			}
-
-			return ss.str();
-
+			return journey.dump();
 		} // dumpJourney
 
-		const JourneyContainer&
+		const Journey&
 		getJourney() const
 		{
 			return journey;
@@ -150,10 +134,7 @@ namespace wns { namespace ldk {
 		virtual Compound*
 		clone()
 		{
-			Compound* result = new Compound(new CommandPool(*this->getCommandPool()), getData());
-			result->setBirthmark(this->getBirthmark());
-			result->journey = journey;
-			return result;
+			return new Compound(new CommandPool(*this->getCommandPool()), *this);
 		}
 
 #ifndef NDEBUG
@@ -181,7 +162,7 @@ namespace wns { namespace ldk {
 		} // getLengthInBits
 
 
-		mutable JourneyContainer journey; // JOURNEY
+		mutable Journey journey; // JOURNEY
 		FunctionalUnit* fu;
 	};
 
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_LDK_COMPOUNDSPAN_HPP
+#define WNS_LDK_COMPOUNDSPAN_HPP
+
+#include <WNS/ldk/Compound.hpp>
+#include <WNS/Assure.hpp>
+
+#include <vector>
+#include <cstddef>
+
+namespace wns { namespace ldk {
+
+    /**
+     * @brief A burst of compounds
+     * @ingroup compoundhandler
+     *
+     * Refers to a sequence of consecutive CompoundPtrs (e.g. the content
+     * of a std::vector) without owning them. Bursts are passed through
+     * the FUN with sendDataBurst / onDataBurst, see
+     * IConnectorReceptacle and IDelivererReceptacle.
+     */
+    class CompoundSpan
+    {
+    public:
+        typedef const CompoundPtr* const_iterator;
+
+        CompoundSpan() :
+            first_(NULL),
+            size_(0)
+        {}
+
+        CompoundSpan(const CompoundPtr* first, std::size_t size) :
+            first_(first),
+            size_(size)
+        {}
+
+        explicit
+        CompoundSpan(const std::vector<CompoundPtr>& compounds) :
+            first_(compounds.empty() ? NULL : &compounds[0]),
+            size_(compounds.size())
+        {}
+
+        /**
+         * @brief Burst of a single compound
+         */
+        explicit
+        CompoundSpan(const CompoundPtr& compound) :
+            first_(&compound),
+            size_(1)
+        {}
+
+        const_iterator
+        begin() const
+        {
+            return first_;
+        }
+
+        const_iterator
+        end() const
+        {
+            return first_ + size_;
+        }
+
+        std::size_t
+        size() const
+        {
+            return size_;
+        }
+
+        bool
+        empty() const
+        {
+            return size_ == 0;
+        }
+
+        const CompoundPtr&
+        operator[](std::size_t n) const
+        {
+            assure(n < size_, "Index out of range");
+            return first_[n];
+        }
+
+        /**
+         * @brief The first count compounds
+         */
+        CompoundSpan
+        head(std::size_t count) const
+        {
+            assure(count <= size_, "Span too short");
+            return CompoundSpan(first_, count);
+        }
+
+        /**
+         * @brief All but the first count compounds
+         */
+        CompoundSpan
+        tail(std::size_t count) const
+        {
+            assure(count <= size_, "Span too short");
+            return CompoundSpan(first_ + count, size_ - count);
+        }
+
+    private:
+        const CompoundPtr* first_;
+        std::size_t size_;
+    };
+
+} // ldk
+} // wns
+
+#endif // NOT defined WNS_LDK_COMPOUNDSPAN_HPP
@@ -76,6 +76,19 @@ namespace wns { namespace ldk {
              * Always send a Compound using doSendData to the FU retrieved using getAcceptor.
              */
             virtual IConnectorReceptacle* getAcceptor(const CompoundPtr& compound) = 0;
+
+            /**
+             * @brief Return the FU all compounds go to, if the choice does
+             * not depend on the compound.
+             *
+             * Bursts of compounds can only be passed on as a whole to such
+             * a FU (see IConnectorReceptacle::isAcceptingBurst). Returns NULL
+             * by default.
+             */
+            virtual IConnectorReceptacle* getBurstAcceptor()
+            {
+                return NULL;
+            }
         };
     }
 }
@@ -155,7 +155,7 @@ namespace wns { namespace ldk {
 
 			if(!inWakeup && hasCapacity()) {
 				inWakeup = true;
-				getReceptor()->wakeup();
+				wakeupUpper();
 				inWakeup = false;
 			}
 		} // tryToSend
@@ -190,7 +190,7 @@ namespace wns { namespace ldk {
 			if(!getConnector()->hasAcceptor(compound))
 				return false;
 
-			IConnectorReceptacle* target = getConnector()->getAcceptor(compound);
+			IConnectorReceptacle* target = getLowerAcceptor(compound);
 			target->sendData(getSomethingToSend());
 
 			return true;
@@ -63,6 +63,37 @@ namespace wns { namespace ldk {
             {}
 
             virtual IDelivererReceptacle* getAcceptor(const CompoundPtr& compound) = 0;
+
+            /**
+             * @brief Deliver a burst of compounds.
+             *
+             * Consecutive compounds for the same FU are delivered with a
+             * single onDataBurst.
+             */
+            virtual void deliverBurst(const CompoundSpan& compounds)
+            {
+                std::size_t begin = 0;
+                IDelivererReceptacle* acceptor = compounds.empty() ? NULL : getAcceptor(compounds[0]);
+
+                while (begin < compounds.size())
+                {
+                    std::size_t end = begin + 1;
+                    IDelivererReceptacle* next = NULL;
+                    for (; end < compounds.size(); ++end)
+                    {
+                        next = getAcceptor(compounds[end]);
+                        if (next != acceptor)
+                        {
+                            break;
+                        }
+                    }
+
+                    acceptor->onDataBurst(compounds.tail(begin).head(end - begin));
+
+                    begin = end;
+                    acceptor = next;
+                }
+            }
         };
     }
 }
@@ -100,7 +100,7 @@ namespace wns { namespace ldk {
 			} else {
 				processOutgoing(compound);
 
-				getConnector()->getAcceptor(compound)->sendData(compound);
+				getLowerAcceptor(compound)->sendData(compound);
 			}
 		} // doSendData
 
@@ -110,8 +110,9 @@ namespace wns { namespace ldk {
 		{
 			processIncoming(compound);
 
-			if(getDeliverer()->size())
-				getDeliverer()->getAcceptor(compound)->onData(compound);
+			IDelivererReceptacle* upper = getUpperAcceptor(compound);
+			if(upper != NULL)
+				upper->onData(compound);
 		} // doOnData
 
 
@@ -127,7 +128,7 @@ namespace wns { namespace ldk {
 		virtual void
 		doWakeup()
 		{
-			getReceptor()->wakeup();
+			wakeupUpper();
 		} // wakeup
 	};
 }}
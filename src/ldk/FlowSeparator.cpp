@@ -58,8 +58,7 @@ FlowSeparator::ConnectorReceptacleSeparator::sendData(const CompoundPtr& compoun
 void
 FlowSeparator::ConnectorReceptacleSeparator::doSendData(const CompoundPtr& compound)
 {
-    IConnectorReceptacle* receptacle = tryGetInstanceAndInsertPermanent(compound, Direction::OUTGOING());
-    receptacle->sendData(compound);
+    tryGetInstanceAndInsertPermanent(compound, Direction::OUTGOING()).receptacle->sendData(compound);
 }
 
 bool
@@ -73,15 +72,12 @@ FlowSeparator::ConnectorReceptacleSeparator::doIsAccepting(const CompoundPtr& co
 {
     try
     {
-        IConnectorReceptacle* candidate = _getInstance(compound, Direction::OUTGOING());
-        // either no one may be busy, or the instance in question
-
-    ConstKeyPtr key = (*(fs_->keyBuilder))(compound, Direction::OUTGOING());
-    FunctionalUnit* candidateFU = fs_->instances[key];
+        const Instance& candidate = _getInstance(compound, Direction::OUTGOING());
 
-    if (fs_->instanceBusy == NULL || fs_->instanceBusy == candidateFU)
+        // either no one may be busy, or the instance in question
+        if (fs_->instanceBusy == NULL || fs_->instanceBusy == candidate.fu)
         {
-            return candidate->isAccepting(compound);
+            return candidate.receptacle->isAccepting(compound);
         }
     }
     catch(const InstanceNotFound& ifn)
@@ -131,12 +127,11 @@ FlowSeparator::DelivererReceptacleSeparator::onData(const CompoundPtr& compound)
 void
 FlowSeparator::DelivererReceptacleSeparator::doOnData(const CompoundPtr& compound)
 {
-    IDelivererReceptacle* receptacle = tryGetInstanceAndInsertPermanent(compound, Direction::INCOMING());
+    const Instance& instance = tryGetInstanceAndInsertPermanent(compound, Direction::INCOMING());
 
     // Mark this as the "Busy" instance. 
-    ConstKeyPtr key = (*(fs_->keyBuilder))(compound, Direction::INCOMING());
-    fs_->instanceBusy = fs_->instances[key];
-    receptacle->onData(compound);
+    fs_->instanceBusy = instance.fu;
+    instance.receptacle->onData(compound);
     fs_->instanceBusy = NULL;
 }
 
@@ -176,8 +171,8 @@ FlowSeparator::ReceptorReceptacleSeparator::doWakeup()
     for(ReceptacleContainer::iterator i = somewhere;
         i != end; ++i)
     {
-        fs_->instanceBusy = fs_->instances[(*i).first];
-        (*i).second->wakeup();
+        fs_->instanceBusy = i->second.value.fu;
+        i->second.value.receptacle->wakeup();
         fs_->instanceBusy = NULL;
     }
 
@@ -185,8 +180,8 @@ FlowSeparator::ReceptorReceptacleSeparator::doWakeup()
     for(ReceptacleContainer::iterator i = begin;
         i != somewhere; ++i)
     {
-        fs_->instanceBusy = fs_->instances[(*i).first];
-        (*i).second->wakeup();
+        fs_->instanceBusy = i->second.value.fu;
+        i->second.value.receptacle->wakeup();
         fs_->instanceBusy = NULL;
     }
 }
@@ -420,11 +415,13 @@ FlowSeparator::~FlowSeparator()
 {
     assure(instanceBusy == NULL, "One FU in FlowSeparator is still busy. Can't delete FlowSeparator!");
 
-    while(instances.empty() == false)
+    for(InstanceMap::iterator it = instances.begin();
+        it != instances.end();
+        ++it)
     {
-        delete instances.begin()->second;
-        instances.erase(instances.begin());
+        delete it->second.value;
     }
+    instances.clear();
 
     notFound.reset();
     keyBuilder.reset();
@@ -492,19 +489,31 @@ FlowSeparator::size() const
 FunctionalUnit*
 FlowSeparator::getInstance(const ConstKeyPtr& key) const
 {
-    InstanceMap::const_iterator it = instances.find(key);
-    if(it == instances.end())
+    FunctionalUnit* const* instance = instances.find(*key);
+    if(instance == NULL)
     {
         return NULL;
     }
 
-    return it->second;
+    return *instance;
 } // getInstance
 
 FunctionalUnit*
 FlowSeparator::getInstance(const CompoundPtr& compound, int direction) const
 {
-    return(this->getInstance(this->getKey(compound, direction)));
+    const Key* key = keyBuilder->peekKey(compound, direction);
+    if(key == NULL)
+    {
+        return(this->getInstance(this->getKey(compound, direction)));
+    }
+
+    FunctionalUnit* const* instance = instances.find(*key);
+    if(instance == NULL)
+    {
+        return NULL;
+    }
+
+    return *instance;
 } // getInstance
 
 ConstKeyPtr
@@ -617,7 +626,7 @@ FlowSeparator::integrate(const ConstKeyPtr& key, FunctionalUnit* functionalUnit)
          connectorReceptaclesIter++)
     {
         (static_cast<ConnectorReceptacleSeparator*>(getFromConnectorReceptacleRegistry(*connectorReceptaclesIter)))
-            ->addInstance(key, functionalUnit->getFromConnectorReceptacleRegistry(*connectorReceptaclesIter));
+            ->addInstance(key, functionalUnit->getFromConnectorReceptacleRegistry(*connectorReceptaclesIter), functionalUnit);
     }
 
     StringList delivererReceptacles = prototypeFU_->getKeysFromDelivererReceptacleRegistry();
@@ -627,7 +636,7 @@ FlowSeparator::integrate(const ConstKeyPtr& key, FunctionalUnit* functionalUnit)
          delivererReceptaclesIter++)
     {
         (static_cast<DelivererReceptacleSeparator*>(getFromDelivererReceptacleRegistry(*delivererReceptaclesIter)))
-            ->addInstance(key, functionalUnit->getFromDelivererReceptacleRegistry(*delivererReceptaclesIter));
+            ->addInstance(key, functionalUnit->getFromDelivererReceptacleRegistry(*delivererReceptaclesIter), functionalUnit);
     }
 
     StringList receptorReceptacles = prototypeFU_->getKeysFromReceptorReceptacleRegistry();
@@ -637,21 +646,22 @@ FlowSeparator::integrate(const ConstKeyPtr& key, FunctionalUnit* functionalUnit)
          receptorReceptaclesIter++)
     {
         (static_cast<ReceptorReceptacleSeparator*>(getFromReceptorReceptacleRegistry(*receptorReceptaclesIter)))
-            ->addInstance(key, functionalUnit->getFromReceptorReceptacleRegistry(*receptorReceptaclesIter));
+            ->addInstance(key, functionalUnit->getFromReceptorReceptacleRegistry(*receptorReceptaclesIter), functionalUnit);
     }
 
-    instances[key] = functionalUnit;
+    instances.insert(key, functionalUnit);
 } // instance.integrate
 
 
 void
 FlowSeparator::disintegrate(const ConstKeyPtr& key)
 {
-    InstanceMap::iterator it = instances.find(key);
-    assure(it != instances.end(),
+    FunctionalUnit** instance = instances.find(*key);
+    assure(instance != NULL,
            "trying to disintegrate FU for an unknown key.");
 
-    assure( instanceBusy != it->second,
+    FunctionalUnit* functionalUnit = *instance;
+    assure( instanceBusy != functionalUnit,
             "FlowSeparator::disintegrate: Can't disintegrate busy Instance/Flow!");
 
     StringList connectorReceptacles = prototypeFU_->getKeysFromConnectorReceptacleRegistry();
@@ -684,8 +694,8 @@ FlowSeparator::disintegrate(const ConstKeyPtr& key)
             ->removeInstance(key);
     }
 
-    delete it->second;
-    instances.erase(it);
+    instances.erase(*key);
+    delete functionalUnit;
 } // instance.disintegrate
 
 
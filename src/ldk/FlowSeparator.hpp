@@ -36,10 +36,10 @@
 #include <WNS/ldk/flowseparator/NotFoundStrategy.hpp>
 #include <WNS/ldk/flowseparator/FlowInfoProvider.hpp>
 #include <WNS/ldk/flowseparator/CreatorStrategy.hpp>
+#include <WNS/ldk/flowseparator/KeyIndex.hpp>
 
 #include <WNS/distribution/Uniform.hpp>
 
-#include <WNS/DerefLess.hpp>
 #include <WNS/logger/Logger.hpp>
 
 #include <WNS/StaticFactory.hpp>
@@ -104,7 +104,22 @@ namespace wns { namespace ldk {
             class ReceptacleManagement
             {
             public:
-                typedef std::map<ConstKeyPtr, RECEPTACLETYPE*, DerefLess<ConstKeyPtr> > ReceptacleContainer;
+                /**
+                 * @brief The receptacle of an instance and the instance
+                 * itself
+                 */
+                struct Instance
+                {
+                    Instance(RECEPTACLETYPE* _receptacle, FunctionalUnit* _fu) :
+                        receptacle(_receptacle),
+                        fu(_fu)
+                    {}
+
+                    RECEPTACLETYPE* receptacle;
+                    FunctionalUnit* fu;
+                };
+
+                typedef flowseparator::KeyIndex<Instance> ReceptacleContainer;
 
                 ReceptacleManagement(FlowSeparator* fs)
                     : fs_(fs),
@@ -115,7 +130,7 @@ namespace wns { namespace ldk {
                 {}
 
                 void
-                addInstance(const ConstKeyPtr& key, RECEPTACLETYPE* receptacle)
+                addInstance(const ConstKeyPtr& key, RECEPTACLETYPE* receptacle, FunctionalUnit* fu)
                 {
                     assure(NULL == getInstance(key),
                            "trying to add an instance for an already known key.");
@@ -125,45 +140,63 @@ namespace wns { namespace ldk {
                       << ";       FU: " << receptacle->getFU()->getName();
                     MESSAGE_END();
 
-                    receptacleContainer_[key] = receptacle;
+                    receptacleContainer_.insert(key, Instance(receptacle, fu));
                 }
 
                 void
                 removeInstance(const ConstKeyPtr& key)
                 {
-                    typename ReceptacleContainer::iterator it = receptacleContainer_.find(key);
-                    assure(it != receptacleContainer_.end(),
+                    Instance* instance = receptacleContainer_.find(*key);
+                    assure(instance != NULL,
                            "trying to disintegrate receptacle for an unknown key.");
 
-                    assure(fs_->instanceBusy != fs_->instances.find(key)->second,
+                    assure(fs_->instanceBusy != instance->fu,
                             "ReceptacleManagement::removeInstance: Can't remove busy Instance/Flow!");
 
-                    receptacleContainer_.erase(it);
+                    receptacleContainer_.erase(*key);
                 }
 
                 RECEPTACLETYPE*
                 getInstance(const ConstKeyPtr& key) const
                 {
-                    typename ReceptacleContainer::const_iterator it = receptacleContainer_.find(key);
+                    const Instance* instance = receptacleContainer_.find(*key);
 
-                    if(it == receptacleContainer_.end())
+                    if(instance == NULL)
                     {
                         return NULL;
                     }
 
-                    return it->second;
+                    return instance->receptacle;
                 } // getInstance
 
-                RECEPTACLETYPE*
+                /**
+                 * @brief The instance in charge of compound
+                 *
+                 * Looks the instance up by a Key filled in place if the
+                 * KeyBuilder supports it. A Key is allocated only if the
+                 * instance is not found (to be passed on with
+                 * InstanceNotFound).
+                 */
+                const Instance&
                 _getInstance(const CompoundPtr& compound, int direction) const
                 {
-                    ConstKeyPtr key = (*(fs_->keyBuilder))(compound, direction);
+                    ConstKeyPtr builtKey;
+                    const Key* key = fs_->keyBuilder->peekKey(compound, direction);
+                    if (key == NULL)
+                    {
+                        builtKey = (*(fs_->keyBuilder))(compound, direction);
+                        key = builtKey.getPtr();
+                    }
 
-                    typename ReceptacleContainer::const_iterator it = receptacleContainer_.find(key);
+                    const Instance* instance = receptacleContainer_.find(*key);
 
-                    if(it == receptacleContainer_.end())
+                    if(instance == NULL)
                     {
-                        throw InstanceNotFound(key);
+                        if (!builtKey)
+                        {
+                            builtKey = (*(fs_->keyBuilder))(compound, direction);
+                        }
+                        throw InstanceNotFound(builtKey);
                     }
 
                     MESSAGE_BEGIN(VERBOSE, fs_->logger, m, fs_->getFUN()->getName());
@@ -172,16 +205,16 @@ namespace wns { namespace ldk {
                       << key->str();
                     MESSAGE_END();
 
-                    return it->second;
+                    return *instance;
                 } // getInstance
 
-                RECEPTACLETYPE*
+                const Instance&
                 tryGetInstanceAndInsertPermanent(const CompoundPtr& compound, int direction)
                 {
-                    RECEPTACLETYPE* receptacle = NULL;
+                    const Instance* instance = NULL;
                     try
                     {
-                        receptacle = _getInstance(compound, direction);
+                        instance = &_getInstance(compound, direction);
                     }
                     catch(const InstanceNotFound& ifn)
                     {
@@ -197,7 +230,7 @@ namespace wns { namespace ldk {
                         // try, if we now get the missing instance
                         try
                         {
-                            receptacle = _getInstance(compound, direction);
+                            instance = &_getInstance(compound, direction);
                         }
                         catch(const InstanceNotFound& ifn)
                         {
@@ -211,7 +244,7 @@ namespace wns { namespace ldk {
                     {
                         throw;
                     }
-                    return receptacle;
+                    return *instance;
                 }
 
             protected:
@@ -285,7 +318,7 @@ namespace wns { namespace ldk {
             };
 
 	public:
- 		typedef std::map<ConstKeyPtr, FunctionalUnit*, DerefLess<ConstKeyPtr> > InstanceMap;
+ 		typedef flowseparator::KeyIndex<FunctionalUnit*> InstanceMap;
             typedef std::list<std::string> StringList;
             typedef std::list<ConnectorReceptacleSeparator*> ConnectorReceptacleSeparatorList;
             typedef std::list<DelivererReceptacleSeparator*> DelivererReceptacleSeparatorList;
@@ -30,9 +30,36 @@
 #include <WNS/ldk/Deliverer.hpp>
 #include <WNS/ldk/fun/FUN.hpp>
 #include <WNS/ldk/LinkHandlerInterface.hpp>
+#include <WNS/ldk/SingleConnector.hpp>
+#include <WNS/ldk/SingleDeliverer.hpp>
+#include <WNS/ldk/SingleReceptor.hpp>
 
 using namespace wns::ldk;
 
+void
+FunctionalUnit::freeze()
+{
+    thaw();
+
+    SingleConnector* connector = dynamic_cast<SingleConnector*>(getConnector());
+    if (connector != NULL && connector->size() == 1)
+    {
+        frozen.lower = connector->get().front();
+    }
+
+    SingleDeliverer* deliverer = dynamic_cast<SingleDeliverer*>(getDeliverer());
+    if (deliverer != NULL && deliverer->size() == 1)
+    {
+        frozen.upper = deliverer->get().front();
+    }
+
+    SingleReceptor* receptor = dynamic_cast<SingleReceptor*>(getReceptor());
+    if (receptor != NULL && receptor->size() == 1)
+    {
+        frozen.receptor = receptor->get().front();
+    }
+} // freeze
+
 void
 FunctionalUnit::doConnect(FunctionalUnit* that, const std::string& srcPort, const std::string& dstPort)
 {
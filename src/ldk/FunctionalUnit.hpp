@@ -74,9 +74,22 @@ namespace wns { namespace ldk {
 	{
 	public:
 		friend class CommandProxy;
+		friend class Compound;
 
 		FunctionalUnit() :
-			name("None")
+			name("None"),
+			journeyLocation(0),
+			frozen()
+		{}
+
+		/**
+		 * @brief A copy lives in another place and thus gets its own
+		 * journey location and links
+		 */
+		FunctionalUnit(const FunctionalUnit& other) :
+			name(other.name),
+			journeyLocation(0),
+			frozen()
 		{}
 
 		virtual ~FunctionalUnit()
@@ -149,6 +162,8 @@ namespace wns { namespace ldk {
                 T* connect(T* that, const std::string& srcPort = "SinglePort", const std::string& dstPort = "SinglePort")
 		{
 			FunctionalUnit* connectee = that->whenConnecting();
+			thaw();
+			connectee->thaw();
                         doConnect(connectee, srcPort, dstPort);
 			return that;
 		}
@@ -165,6 +180,8 @@ namespace wns { namespace ldk {
 		T* downConnect(T* that, const std::string& srcPort = "SinglePort", const std::string& dstPort = "SinglePort")
 		{
 			FunctionalUnit* connectee = that->whenConnecting();
+			thaw();
+			connectee->thaw();
 			doDownConnect(connectee, srcPort, dstPort);
 			return that;
 		}
@@ -181,6 +198,8 @@ namespace wns { namespace ldk {
 		T* upConnect(T* that, const std::string& srcPort = "SinglePort", const std::string& dstPort = "SinglePort")
 		{
 			FunctionalUnit* connectee = that->whenConnecting();
+			thaw();
+			connectee->thaw();
 			doUpConnect(connectee, srcPort, dstPort);
 			return that;
 		}
@@ -212,6 +231,41 @@ namespace wns { namespace ldk {
                 onShutdown()
                 {}
 
+		/**
+		 * @brief Resolve single-successor links to direct pointers.
+		 *
+		 * If the Connector, Deliverer or Receptor of this FU is a
+		 * SingleConnector, SingleDeliverer or SingleReceptor with a FU
+		 * attached, its receptacle is remembered, and
+		 * getLowerAcceptor, getUpperAcceptor and wakeupUpper skip the
+		 * link objects from then on. Links of other types are still
+		 * resolved per call.
+		 *
+		 * Connecting this FU thaws it again. Changing the links by
+		 * other means (Link::set, Link::clear) requires an explicit
+		 * thaw. Usually called for all FUs by fun::Main::freeze.
+		 */
+		void
+		freeze();
+
+		/**
+		 * @brief Forget the links resolved by freeze
+		 */
+		void
+		thaw()
+		{
+			frozen = Frozen();
+		}
+
+		/**
+		 * @brief True if at least one link has been resolved by freeze
+		 */
+		bool
+		isFrozen() const
+		{
+			return frozen.lower != NULL || frozen.upper != NULL || frozen.receptor != NULL;
+		}
+
 		/**
 		 * @brief Return the FunctionalUnit holding the connector set for this FunctionalUnit.
 		 *
@@ -267,6 +321,7 @@ namespace wns { namespace ldk {
 		setName(std::string _name)
 		{
 			name = _name;
+			journeyLocation = 0;
 		}
 
 		/**
@@ -279,6 +334,57 @@ namespace wns { namespace ldk {
 		}
 
 	protected:
+		/**
+		 * @brief The receptacle below to send the compound to.
+		 *
+		 * Same as getConnector()->getAcceptor(compound), including the
+		 * precondition that the Connector has an acceptor for the
+		 * compound.
+		 */
+		IConnectorReceptacle*
+		getLowerAcceptor(const CompoundPtr& compound) const
+		{
+			if (frozen.lower != NULL)
+			{
+				return frozen.lower;
+			}
+			return getConnector()->getAcceptor(compound);
+		}
+
+		/**
+		 * @brief The receptacle above to deliver the compound to, NULL
+		 * if no FU is connected above.
+		 */
+		IDelivererReceptacle*
+		getUpperAcceptor(const CompoundPtr& compound) const
+		{
+			if (frozen.upper != NULL)
+			{
+				return frozen.upper;
+			}
+			if (getDeliverer()->size() == 0)
+			{
+				return NULL;
+			}
+			return getDeliverer()->getAcceptor(compound);
+		}
+
+		/**
+		 * @brief Same as getReceptor()->wakeup()
+		 */
+		void
+		wakeupUpper() const
+		{
+			if (frozen.receptor != NULL)
+			{
+				frozen.receptor->wakeup();
+			}
+			else
+			{
+				getReceptor()->wakeup();
+			}
+		}
+
 		/**
 		 * @brief Returns the name and the type like this: name (type)
 		 *
@@ -341,6 +447,30 @@ namespace wns { namespace ldk {
 		doUpConnect(FunctionalUnit* that, const std::string& srcPort, const std::string& dstPort);
 
 		std::string name;
+
+		/**
+		 * @brief This FU interned for compound journeys (0: not yet
+		 * interned, see Compound::visit)
+		 */
+		mutable Journey::LocationID journeyLocation;
+
+		/**
+		 * @brief Receptacles of the single-successor links, see freeze
+		 */
+		struct Frozen
+		{
+			Frozen() :
+				lower(NULL),
+				upper(NULL),
+				receptor(NULL)
+			{}
+
+			IConnectorReceptacle* lower;
+			IDelivererReceptacle* upper;
+			IReceptorReceptacle* receptor;
+		};
+
+		Frozen frozen;
 	};
 	typedef FUNConfigCreator<FunctionalUnit> FunctionalUnitCreator;
 	typedef wns::StaticFactory<FunctionalUnitCreator> FunctionalUnitFactory;
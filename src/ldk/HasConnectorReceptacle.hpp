@@ -88,6 +88,18 @@ namespace wns { namespace ldk {
                     return fu_->doIsAccepting(compound, Port<PORTID>());
                 }
 
+                virtual std::size_t
+                isAcceptingBurst(const CompoundSpan& compounds)
+                {
+                    return fu_->getFUN()->getLinkHandler()->isAcceptingBurst(this, compounds);
+                }
+
+                virtual void
+                sendDataBurst(const CompoundSpan& compounds)
+                {
+                    fu_->getFUN()->getLinkHandler()->sendDataBurst(this, compounds);
+                }
+
                 virtual FunctionalUnit*
                 getFU()
                 {
@@ -147,6 +159,18 @@ namespace wns { namespace ldk {
                 return getFUN()->getLinkHandler()->isAccepting(this, compound);
             }
 
+            virtual std::size_t
+            isAcceptingBurst(const CompoundSpan& compounds)
+            {
+                return getFUN()->getLinkHandler()->isAcceptingBurst(this, compounds);
+            }
+
+            virtual void
+            sendDataBurst(const CompoundSpan& compounds)
+            {
+                getFUN()->getLinkHandler()->sendDataBurst(this, compounds);
+            }
+
             virtual FunctionalUnit*
             getFU()
             {
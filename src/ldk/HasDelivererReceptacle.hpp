@@ -76,6 +76,12 @@ namespace wns { namespace ldk {
                     fu_->doOnData(compound, Port<PORTID>());
                 }
 
+                virtual void
+                onDataBurst(const CompoundSpan& compounds)
+                {
+                    fu_->getFUN()->getLinkHandler()->onDataBurst(this, compounds);
+                }
+
                 virtual FunctionalUnit*
                 getFU()
                 {
@@ -129,6 +135,12 @@ namespace wns { namespace ldk {
                 getFUN()->getLinkHandler()->onData(this, compound);
             }
 
+            virtual void
+            onDataBurst(const CompoundSpan& compounds)
+            {
+                getFUN()->getLinkHandler()->onDataBurst(this, compounds);
+            }
+
             virtual FunctionalUnit*
             getFU()
             {
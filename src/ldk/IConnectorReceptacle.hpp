@@ -14,6 +14,7 @@
 #define WNS_LDK_ICONNECTORRECEPTACLE_HPP
 
 #include <WNS/ldk/Compound.hpp>
+#include <WNS/ldk/CompoundSpan.hpp>
 
 namespace wns { namespace ldk {
 
@@ -41,6 +42,58 @@ namespace wns { namespace ldk {
             virtual FunctionalUnit*
             getFU() = 0;
 
+            /**
+             * @brief Number of leading compounds of the burst that
+             * would be accepted if sent in order
+             *
+             * Bursts may be passed on with a single call per
+             * FunctionalUnit. Only as many compounds as accepted here
+             * may be given to sendDataBurst afterwards. The default
+             * answers for the first compound only.
+             */
+            virtual std::size_t
+            isAcceptingBurst(const CompoundSpan& compounds)
+            {
+                if (compounds.empty() || !isAccepting(compounds[0]))
+                {
+                    return 0;
+                }
+                return 1;
+            }
+
+            virtual std::size_t
+            doIsAcceptingBurst(const CompoundSpan& compounds) const
+            {
+                if (compounds.empty() || !doIsAccepting(compounds[0]))
+                {
+                    return 0;
+                }
+                return 1;
+            }
+
+            /**
+             * @brief Accept a burst of compounds, see isAcceptingBurst
+             *
+             * The default calls sendData for each compound.
+             */
+            virtual void
+            sendDataBurst(const CompoundSpan& compounds)
+            {
+                for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+                {
+                    sendData(*it);
+                }
+            }
+
+            virtual void
+            doSendDataBurst(const CompoundSpan& compounds)
+            {
+                for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+                {
+                    doSendData(*it);
+                }
+            }
+
         };
 
     } // ldk
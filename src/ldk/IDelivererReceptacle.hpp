@@ -14,6 +14,7 @@
 #define WNS_LDK_IDELIVERERRECEPTACLE_HPP
 
 #include <WNS/ldk/Compound.hpp>
+#include <WNS/ldk/CompoundSpan.hpp>
 
 namespace wns { namespace ldk {
 
@@ -35,6 +36,29 @@ namespace wns { namespace ldk {
             virtual FunctionalUnit*
             getFU() = 0;
 
+            /**
+             * @brief Receive a burst of compounds with a single call
+             *
+             * The default calls onData for each compound.
+             */
+            virtual void
+            onDataBurst(const CompoundSpan& compounds)
+            {
+                for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+                {
+                    onData(*it);
+                }
+            }
+
+            virtual void
+            doOnDataBurst(const CompoundSpan& compounds)
+            {
+                for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+                {
+                    doOnData(*it);
+                }
+            }
+
         };
 
     } // ldk
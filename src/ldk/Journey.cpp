@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/Journey.hpp>
+
+#include <vector>
+#include <map>
+#include <sstream>
+
+using namespace wns::ldk;
+
+const std::size_t Journey::capacity;
+bool Journey::tracing = false;
+
+namespace {
+
+	struct Locations
+	{
+		Locations() :
+			names(1, std::string("unknown location"))
+		{}
+
+		// LocationID -> name, index 0 is the unknown location
+		std::vector<std::string> names;
+		std::map<std::string, Journey::LocationID> ids;
+	};
+
+	Locations&
+	getLocations()
+	{
+		static Locations locations;
+		return locations;
+	}
+
+} // namespace
+
+
+bool
+Journey::operator==(const Journey& other) const
+{
+	if (length != other.length || visits != other.visits)
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0; i < length; ++i)
+	{
+		if (!(at(i) == other.at(i)))
+		{
+			return false;
+		}
+	}
+	return true;
+} // operator==
+
+
+std::string
+Journey::dump() const
+{
+	std::stringstream ss;
+
+	if (visits > length)
+	{
+		ss << "\n(" << visits - length << " earlier hops dropped)";
+	}
+
+	for (std::size_t i = 0; i < length; ++i)
+	{
+		ss << "\n(";
+		ss.width(11);
+		ss.setf(std::ios_base::fixed, std::ios_base::floatfield);
+		ss.precision(7);
+		ss << std::right << at(i).t << ") " << at(i).getLocation();
+	}
+
+	return ss.str();
+} // dump
+
+
+Journey::LocationID
+Journey::intern(const std::string& location)
+{
+	Locations& locations = getLocations();
+
+	std::map<std::string, LocationID>::const_iterator it = locations.ids.find(location);
+	if (it != locations.ids.end())
+	{
+		return it->second;
+	}
+
+	LocationID id = locations.names.size();
+	locations.names.push_back(location);
+	locations.ids[location] = id;
+	return id;
+} // intern
+
+
+const std::string&
+Journey::resolve(LocationID location)
+{
+	const Locations& locations = getLocations();
+
+	if (location >= locations.names.size())
+	{
+		return locations.names[0];
+	}
+	return locations.names[location];
+} // resolve
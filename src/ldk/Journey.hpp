@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_LDK_JOURNEY_HPP
+#define WNS_LDK_JOURNEY_HPP
+
+#include <WNS/simulator/Time.hpp>
+#include <WNS/Assure.hpp>
+
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Number of hops a Journey remembers (older ones are overwritten)
+ */
+#ifndef WNS_LDK_JOURNEY_LENGTH
+#define WNS_LDK_JOURNEY_LENGTH 8
+#endif
+
+namespace wns { namespace ldk {
+
+	/**
+	 * @brief Path of a Compound through the FunctionalUnits (JOURNEY)
+	 *
+	 * The last WNS_LDK_JOURNEY_LENGTH hops are kept in a ring stored
+	 * within the Compound. A hop consists of the time and an interned
+	 * location, so recording a hop neither allocates memory nor copies
+	 * strings. Locations are resolved to strings only when the Journey
+	 * is dumped.
+	 *
+	 * Hops are recorded by the LinkHandlers if either
+	 * traceCompoundJourney is set in their configuration or tracing has
+	 * been switched on at runtime (see setTracing).
+	 */
+	class Journey
+	{
+	public:
+		/**
+		 * @brief Interned location, 0 is no location
+		 */
+		typedef unsigned int LocationID;
+
+		/**
+		 * @brief A single hop
+		 */
+		struct Hop
+		{
+			simTimeType t;
+			LocationID location;
+
+			/**
+			 * @brief Resolve the location
+			 */
+			const std::string&
+			getLocation() const
+			{
+				return Journey::resolve(location);
+			}
+
+			bool
+			operator==(const Hop& other) const
+			{
+				return (t == other.t) && (location == other.location);
+			}
+		};
+
+		static const std::size_t capacity = WNS_LDK_JOURNEY_LENGTH;
+
+		Journey() :
+			first(0),
+			length(0),
+			visits(0)
+		{}
+
+		Journey(const Journey& other)
+		{
+			*this = other;
+		}
+
+		Journey&
+		operator=(const Journey& other)
+		{
+			first = other.first;
+			length = other.length;
+			visits = other.visits;
+			// only the hops in use
+			for (std::size_t i = 0; i < length; ++i)
+			{
+				std::size_t slot = (first + i) % capacity;
+				hops[slot] = other.hops[slot];
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Append a hop, overwriting the oldest one if the ring
+		 * is full
+		 */
+		void
+		record(simTimeType t, LocationID location)
+		{
+			std::size_t slot = (first + length) % capacity;
+			hops[slot].t = t;
+			hops[slot].location = location;
+
+			if (length < capacity)
+			{
+				++length;
+			}
+			else
+			{
+				first = (first + 1) % capacity;
+			}
+			++visits;
+		}
+
+		/**
+		 * @brief Number of hops remembered
+		 */
+		std::size_t
+		size() const
+		{
+			return length;
+		}
+
+		bool
+		empty() const
+		{
+			return length == 0;
+		}
+
+		/**
+		 * @brief Number of hops recorded, including overwritten ones
+		 */
+		unsigned long int
+		getNumberOfVisits() const
+		{
+			return visits;
+		}
+
+		/**
+		 * @brief n-th hop remembered, 0 is the oldest one
+		 */
+		const Hop&
+		at(std::size_t n) const
+		{
+			assure(n < length, "No such hop in journey");
+			return hops[(first + n) % capacity];
+		}
+
+		/**
+		 * @brief The most recent hop
+		 */
+		const Hop&
+		back() const
+		{
+			return at(length - 1);
+		}
+
+		bool
+		operator==(const Journey& other) const;
+
+		/**
+		 * @brief One line per hop: (time) location
+		 */
+		std::string
+		dump() const;
+
+		/**
+		 * @brief Intern a location
+		 *
+		 * Equal strings result in the same LocationID. Interned
+		 * locations are kept until the end of the simulation.
+		 */
+		static LocationID
+		intern(const std::string& location);
+
+		/**
+		 * @brief String of an interned location
+		 */
+		static const std::string&
+		resolve(LocationID location);
+
+		/**
+		 * @brief Switch tracing of all Compounds on or off at runtime
+		 */
+		static void
+		setTracing(bool enabled)
+		{
+			tracing = enabled;
+		}
+
+		static bool
+		isTracing()
+		{
+			return tracing;
+		}
+
+	private:
+		std::size_t first;
+		std::size_t length;
+		unsigned long int visits;
+		Hop hops[capacity];
+
+		static bool tracing;
+	};
+
+}}
+
+#endif // NOT defined WNS_LDK_JOURNEY_HPP
@@ -35,23 +35,85 @@
 #include <WNS/ldk/FUNConfigCreator.hpp>
 
 #include <string>
+#include <cstddef>
 
 namespace wns { namespace ldk {
 	class ILayer;
 
+	/**
+	 * @brief Identifies a flow within a FlowSeparator
+	 *
+	 * Keys need to be strictly weakly ordered by operator<. In addition
+	 * a Key may carry a precomputed hash (see setHash), which lets the
+	 * FlowSeparator find its instance without walking an ordered
+	 * container. Keys of one type either all have a hash or none, and
+	 * equal Keys must have equal hashes.
+	 */
 	class Key :
 		virtual public RefCountable
 	{
 	public:
+		Key() :
+			hash(0),
+			hashed(false)
+		{}
+
 		virtual bool
 		operator<(const Key& other) const = 0;
 
+		/**
+		 * @brief Equality, defaults to !(a < b) && !(b < a)
+		 *
+		 * Override this in hashed Keys, it is called for every lookup.
+		 */
+		virtual bool
+		equals(const Key& other) const
+		{
+			return !(*this < other) && !(other < *this);
+		}
+
 		virtual std::string
 		str() const = 0;
 
+		bool
+		hasHash() const
+		{
+			return hashed;
+		}
+
+		std::size_t
+		getHash() const
+		{
+			return hash;
+		}
+
 		virtual
 		~Key()
 		{}
+
+	protected:
+		/**
+		 * @brief To be called whenever the content of the Key changes
+		 */
+		void
+		setHash(std::size_t _hash)
+		{
+			hash = _hash;
+			hashed = true;
+		}
+
+		/**
+		 * @brief Mix another value into a hash
+		 */
+		static std::size_t
+		combineHash(std::size_t seed, std::size_t value)
+		{
+			return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+		}
+
+	private:
+		std::size_t hash;
+		bool hashed;
 	};
 
 	typedef SmartPtr<Key> KeyPtr;
@@ -66,11 +128,61 @@ namespace wns { namespace ldk {
 		virtual ConstKeyPtr
 		operator () (const CompoundPtr& compound, int direction) const = 0;
 
+		/**
+		 * @brief The Key of a compound without allocating it
+		 *
+		 * Returns a Key owned by the KeyBuilder, which is valid until
+		 * the next call only. Never wrap it in a SmartPtr. Returns NULL
+		 * if the KeyBuilder does not support this (the default), see
+		 * InPlaceKeyBuilder.
+		 */
+		virtual const Key*
+		peekKey(const CompoundPtr& /* compound */, int /* direction */) const
+		{
+			return NULL;
+		}
+
 		virtual
 		~KeyBuilder()
 		{}
 	};
 
+	/**
+	 * @brief KeyBuilder filling a single Key in place
+	 *
+	 * Implement fill() for a default constructible KEY. Lookups use
+	 * peekKey, which refills the same Key object for every
+	 * compound. Only when a new instance is needed, operator() allocates
+	 * a Key to be kept by the FlowSeparator.
+	 */
+	template <typename KEY>
+	class InPlaceKeyBuilder :
+		public KeyBuilder
+	{
+	public:
+		virtual void
+		fill(KEY& key, const CompoundPtr& compound, int direction) const = 0;
+
+		virtual ConstKeyPtr
+		operator () (const CompoundPtr& compound, int direction) const
+		{
+			KEY* key = new KEY();
+			ConstKeyPtr result(key);
+			this->fill(*key, compound, direction);
+			return result;
+		}
+
+		virtual const Key*
+		peekKey(const CompoundPtr& compound, int direction) const
+		{
+			this->fill(scratch, compound, direction);
+			return &scratch;
+		}
+
+	private:
+		mutable KEY scratch;
+	};
+
 	typedef FUNConfigCreator<KeyBuilder> KeyBuilderCreator;
 	typedef wns::StaticFactory<KeyBuilderCreator> KeyBuilderFactory;
 } // namespace ldk
@@ -50,6 +50,42 @@ namespace wns { namespace ldk {
             virtual void
             onData(IDelivererReceptacle* dr, const CompoundPtr& compound) = 0;
 
+            /**
+             * @name Bursts
+             *
+             * @brief The defaults handle the compounds one by one as
+             * above.
+             */
+            //@{
+            virtual std::size_t
+            isAcceptingBurst(IConnectorReceptacle* cr, const CompoundSpan& compounds)
+            {
+                if (compounds.empty() || !isAccepting(cr, compounds[0]))
+                {
+                    return 0;
+                }
+                return 1;
+            }
+
+            virtual void
+            sendDataBurst(IConnectorReceptacle* cr, const CompoundSpan& compounds)
+            {
+                for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+                {
+                    sendData(cr, *it);
+                }
+            }
+
+            virtual void
+            onDataBurst(IDelivererReceptacle* dr, const CompoundSpan& compounds)
+            {
+                for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+                {
+                    onData(dr, *it);
+                }
+            }
+            //@}
+
             virtual
             ~LinkHandlerInterface()
             {}
@@ -78,6 +114,24 @@ namespace wns { namespace ldk {
             {
                 dr->doOnData(compound);
             }
+
+            virtual std::size_t
+            doIsAcceptingBurst(IConnectorReceptacle* cr, const CompoundSpan& compounds)
+            {
+                return cr->doIsAcceptingBurst(compounds);
+            }
+
+            virtual void
+            doSendDataBurst(IConnectorReceptacle* cr, const CompoundSpan& compounds)
+            {
+                cr->doSendDataBurst(compounds);
+            }
+
+            virtual void
+            doOnDataBurst(IDelivererReceptacle* dr, const CompoundSpan& compounds)
+            {
+                dr->doOnDataBurst(compounds);
+            }
         };
 
     } // ldk
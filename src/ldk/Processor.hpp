@@ -86,7 +86,7 @@ namespace wns { namespace ldk {
 		{
 			processOutgoing(compound);
 
-			getConnector()->getAcceptor(compound)->sendData(compound);
+			getLowerAcceptor(compound)->sendData(compound);
 		} // doSendData
 
 
@@ -95,11 +95,54 @@ namespace wns { namespace ldk {
 		{
 			processIncoming(compound);
 
-			if(getDeliverer()->size())
-				getDeliverer()->getAcceptor(compound)->onData(compound);
+			IDelivererReceptacle* upper = getUpperAcceptor(compound);
+			if(upper != NULL)
+				upper->onData(compound);
 		} // doOnData
 
 
+		/**
+		 * @brief Process the whole burst, then pass it on with a single call
+		 *
+		 * Falls back to doSendData per compound if the Connector has no
+		 * single receptacle for the burst.
+		 */
+		virtual void
+		doSendDataBurst(const CompoundSpan& compounds)
+		{
+			IConnectorReceptacle* acceptor = getConnector()->getBurstAcceptor();
+
+			if (acceptor == NULL)
+			{
+				for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+				{
+					doSendData(*it);
+				}
+				return;
+			}
+
+			for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+			{
+				processOutgoing(*it);
+			}
+
+			acceptor->sendDataBurst(compounds);
+		} // doSendDataBurst
+
+
+		virtual void
+		doOnDataBurst(const CompoundSpan& compounds)
+		{
+			for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+			{
+				processIncoming(*it);
+			}
+
+			if(getDeliverer()->size())
+				getDeliverer()->deliverBurst(compounds);
+		} // doOnDataBurst
+
+
 	protected:
 		virtual bool
 		doIsAccepting(const CompoundPtr& compound) const
@@ -107,6 +150,19 @@ namespace wns { namespace ldk {
 			return getConnector()->hasAcceptor(compound);
 		} // isAccepting
 
+
+		virtual std::size_t
+		doIsAcceptingBurst(const CompoundSpan& compounds) const
+		{
+			IConnectorReceptacle* acceptor = getConnector()->getBurstAcceptor();
+
+			if (acceptor == NULL)
+			{
+				return (compounds.empty() || !doIsAccepting(compounds[0])) ? 0 : 1;
+			}
+			return acceptor->isAcceptingBurst(compounds);
+		} // doIsAcceptingBurst
+
 	private:
 
 		virtual void
@@ -115,7 +171,7 @@ namespace wns { namespace ldk {
 			if (!inWakeup)
 			{
 				inWakeup = true;
-				getReceptor()->wakeup();
+				wakeupUpper();
 				inWakeup = false;
 			}
 		} // wakeup
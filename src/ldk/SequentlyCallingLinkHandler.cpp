@@ -202,10 +202,8 @@ SequentlyCallingLinkHandler::mainHandler()
 			  << ", compound: " << sendDataFUCompound.compound.getPtr();
 			MESSAGE_END();
 
-#ifndef WNS_NO_LOGGING
-			if (traceCompoundJourney && sendDataFUCompound.compound)
+			if ((traceCompoundJourney || Journey::isTracing()) && sendDataFUCompound.compound)
 				sendDataFUCompound.compound->visit(sendDataFUCompound.fu); // JOURNEY
-#endif
 
 			FUCompound sendDataFUCompoundHelp = sendDataFUCompound;
 
@@ -237,10 +235,8 @@ SequentlyCallingLinkHandler::mainHandler()
 			  << ", compound: " << onDataFUCompoundHelp.compound.getPtr();
 			MESSAGE_END();
 
-#ifndef WNS_NO_LOGGING
-			if (traceCompoundJourney && onDataFUCompoundHelp.compound)
+			if ((traceCompoundJourney || Journey::isTracing()) && onDataFUCompoundHelp.compound)
 				onDataFUCompoundHelp.compound->visit(onDataFUCompoundHelp.fu); // JOURNEY
-#endif
 
 			doOnData(onDataFUCompoundHelp.fu, onDataFUCompoundHelp.compound);
 
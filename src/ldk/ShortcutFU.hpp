@@ -143,7 +143,7 @@ namespace wns { namespace ldk {
             {
                 while (not compoundQueue.empty())
                 {
-                    const wns::ldk::CompoundPtr compound = compoundQueue.front();
+                    const wns::ldk::CompoundPtr compound = wns::move(compoundQueue.front());
                     compoundQueue.erase(compoundQueue.begin());
 
                     if (isBroadcast(compound))
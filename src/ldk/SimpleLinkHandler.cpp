@@ -82,10 +82,8 @@ SimpleLinkHandler::sendData(IConnectorReceptacle* cr, const CompoundPtr& compoun
       << "\ncompound: " << compound.getPtr();
     MESSAGE_END();
 
-#ifndef WNS_NO_LOGGING
-    if (traceCompoundJourney && compound)
+    if ((traceCompoundJourney || Journey::isTracing()) && compound)
         compound->visit(cr->getFU()); // JOURNEY
-#endif
 
     doSendData(cr, compound);
 } // sendDataForwarded
@@ -110,12 +108,65 @@ SimpleLinkHandler::onData(IDelivererReceptacle* dr, const CompoundPtr& compound)
       << "\ncompound: " << compound.getPtr();
     MESSAGE_END();
 
-#ifndef WNS_NO_LOGGING
-    if (traceCompoundJourney && compound)
+    if ((traceCompoundJourney || Journey::isTracing()) && compound)
         compound->visit(dr->getFU()); // JOURNEY
-#endif
 
     doOnData(dr, compound);
 } // onDataForwarded
 
+std::size_t
+SimpleLinkHandler::isAcceptingBurst(IConnectorReceptacle* cr, const CompoundSpan& compounds)
+{
+    std::size_t accepted = doIsAcceptingBurst(cr, compounds);
+
+    MESSAGE_BEGIN(VERBOSE, isAcceptingLogger, m, cr->getFU()->getFUN()->getName());
+    m << " function isAcceptingBurst(...) of FU "
+      << cr->getFU()->getName() << " called: FU is accepting "
+      << accepted << " of " << compounds.size() << " compounds";
+    MESSAGE_END();
+
+    return accepted;
+} // isAcceptingBurst
+
+void
+SimpleLinkHandler::sendDataBurst(IConnectorReceptacle* cr, const CompoundSpan& compounds)
+{
+    MESSAGE_BEGIN(VERBOSE, sendDataLogger, m, cr->getFU()->getFUN()->getName());
+    m << " function sendDataBurst(...) of FU "
+      << cr->getFU()->getName() << " called with "
+      << compounds.size() << " compounds";
+    MESSAGE_END();
+
+    visit(cr->getFU(), compounds);
+
+    doSendDataBurst(cr, compounds);
+} // sendDataBurst
+
+void
+SimpleLinkHandler::onDataBurst(IDelivererReceptacle* dr, const CompoundSpan& compounds)
+{
+    MESSAGE_BEGIN(VERBOSE, onDataLogger, m, dr->getFU()->getFUN()->getName());
+    m << " function onDataBurst(...) of FU "
+      << dr->getFU()->getName() << " called with "
+      << compounds.size() << " compounds";
+    MESSAGE_END();
+
+    visit(dr->getFU(), compounds);
+
+    doOnDataBurst(dr, compounds);
+} // onDataBurst
+
+void
+SimpleLinkHandler::visit(FunctionalUnit* fu, const CompoundSpan& compounds) const
+{
+    if (!traceCompoundJourney && !Journey::isTracing())
+        return;
+
+    for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+    {
+        if (*it)
+            (*it)->visit(fu); // JOURNEY
+    }
+} // visit
+
 
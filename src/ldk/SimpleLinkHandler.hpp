@@ -55,7 +55,19 @@ namespace wns { namespace ldk {
             virtual void
             onData(IDelivererReceptacle* dr, const CompoundPtr& compound);
 
+            virtual std::size_t
+            isAcceptingBurst(IConnectorReceptacle* cr, const CompoundSpan& compounds);
+
+            virtual void
+            sendDataBurst(IConnectorReceptacle* cr, const CompoundSpan& compounds);
+
+            virtual void
+            onDataBurst(IDelivererReceptacle* dr, const CompoundSpan& compounds);
+
         private:
+            void
+            visit(FunctionalUnit* fu, const CompoundSpan& compounds) const;
+
             wns::pyconfig::View config;
 
             bool traceCompoundJourney;
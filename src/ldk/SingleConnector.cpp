@@ -59,3 +59,9 @@ SingleConnector::getAcceptor(const CompoundPtr&
     return getRec();
 }
 
+IConnectorReceptacle*
+SingleConnector::getBurstAcceptor()
+{
+    return getRec();
+}
+
@@ -69,6 +69,12 @@ namespace wns { namespace ldk {
              */
             virtual IConnectorReceptacle*
             getAcceptor(const CompoundPtr& compound);
+
+            /**
+             * @brief All compounds go to the single FU
+             */
+            virtual IConnectorReceptacle*
+            getBurstAcceptor();
             //@}
         };
     } // ldk
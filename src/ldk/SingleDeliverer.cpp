@@ -46,3 +46,13 @@ SingleDeliverer::getAcceptor(const CompoundPtr&)
     return getRec();
 }
 
+void
+SingleDeliverer::deliverBurst(const CompoundSpan& compounds)
+{
+    assure(getRec() != NULL, "called deliverBurst although no functional unit above available");
+    if (!compounds.empty())
+    {
+        getRec()->onDataBurst(compounds);
+    }
+}
+
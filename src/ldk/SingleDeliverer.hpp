@@ -56,6 +56,12 @@ namespace wns { namespace ldk {
 
             virtual IDelivererReceptacle*
             getAcceptor(const CompoundPtr& compound);
+
+            /**
+             * @brief The whole burst goes to the single FU
+             */
+            virtual void
+            deliverBurst(const CompoundSpan& compounds);
         };
     } // ldk
 } // wns
@@ -61,8 +61,8 @@ GoBackN::GoBackN(fun::FUN* fuNet, const wns::pyconfig::View& config) :
         NR(0),
         LA(0),
         activeCompound(CompoundPtr()),
-        sentPDUs(),
-        toRetransmit(),
+        sentPDUs(sequenceNumberSize),
+        toRetransmit(sequenceNumberSize),
         ackPDUs(),
         receivedPDUs(),
         sendNow(false),
@@ -164,7 +164,7 @@ GoBackN::getACK()
 {
     assure(hasACK(), getFUN()->getName() + " hasSomethingToSend has not been called to check whether there is something to send.");
 
-    CompoundPtr nextACKToBeSent = ackPDUs.front();
+    CompoundPtr nextACKToBeSent = wns::move(ackPDUs.front());
     ackPDUs.pop_front();
 
     MESSAGE_BEGIN(NORMAL, logger, m, getFUN()->getName());
@@ -196,7 +196,7 @@ GoBackN::getData()
         command->localTransmissionCounter++;
 
         toRetransmit.pop_front();
-        sentPDUs.push_back(nextPDUToBeRetransmit);
+        sentPDUs.push_back(command->getNS(), nextPDUToBeRetransmit);
 
         MESSAGE_BEGIN(NORMAL, logger, m, getFUN()->getName());
         m << " getData(): Outgoing/downstack: Re-Sent I frame NS=" << command->getNS();
@@ -226,10 +226,11 @@ GoBackN::getData()
     setNewTimeout(resendTimeout); // inherited from events::CanTimeout
 
     CompoundPtr it = activeCompound->copy();
+    GoBackNCommand* command = getCommand(activeCompound);
     // store the PDU we now send in the Retransmission FIFO Buffer
-    sentPDUs.push_back(activeCompound); // queue it in sentPDUs
+    sentPDUs.push_back(command->getNS(), activeCompound); // queue it in sentPDUs
     // keep track of the number of retransmissions
-    getCommand(activeCompound)->localTransmissionCounter++; // first transmission of this packet here
+    command->localTransmissionCounter++; // first transmission of this packet here
     // empty the space for new outgoing compounds
     activeCompound = CompoundPtr(); // empty
 
@@ -521,13 +522,16 @@ GoBackN::prepareRetransmission()
     show_seqnr_list("toRetransmit=",toRetransmit);
 
     // announce failed transmission to status collector for statistic collection (usable by other FUs)
-    for ( CompoundContainer::iterator it = sentPDUs.begin() ; it != sentPDUs.end() ; it++ )
+    for ( SequenceWindow::const_iterator it = sentPDUs.begin() ; it != sentPDUs.end() ; it++ )
     {
         this->statusCollector->onFailedTransmission((*it));
     }
 
-    toRetransmit.insert(toRetransmit.end(), sentPDUs.begin(), sentPDUs.end());
-    sentPDUs.clear();
+    while (!sentPDUs.empty())
+    {
+        toRetransmit.push_back(sentPDUs.begin().sequenceNumber(), sentPDUs.front());
+        sentPDUs.pop_front();
+    }
 
     MESSAGE_BEGIN(NORMAL, logger, m, getFUN()->getName());
     m << " prepareRetransmission(): RetransmitQueue=" << toRetransmit.size()
@@ -536,21 +540,21 @@ GoBackN::prepareRetransmission()
 }
 
 void
-GoBackN::removeACKed(const ARQCommand::SequenceNumber ackedNS, CompoundContainer& container)
+GoBackN::removeACKed(const ARQCommand::SequenceNumber ackedNS, SequenceWindow& window)
 {
     MESSAGE_BEGIN(NORMAL, logger, m, getFUN()->getName());
     m << " removeACKed(" << ackedNS << ")";
     MESSAGE_END();
-    show_seqnr_list("before removal: ",container);
-    CompoundPtr compoundElement;
+    show_seqnr_list("before removal: ",window);
 
-    while( !container.empty() )
+    while( !window.empty() )
     {
-        compoundElement = container.front();
-        ARQCommand::SequenceNumber NS = getCommand(compoundElement)->getNS();
+        ARQCommand::SequenceNumber NS = window.begin().sequenceNumber();
 
         if(NS <= ackedNS)
         {
+            CompoundPtr compoundElement = window.front();
+
             // a probe counting the number of transmissions needed
             transmissionAttempts->put(getCommand(compoundElement)->localTransmissionCounter);
 
@@ -561,14 +565,14 @@ GoBackN::removeACKed(const ARQCommand::SequenceNumber ackedNS, CompoundContainer
             m << " ACK for NS=" << NS
               << " received after " << getCommand(compoundElement)->localTransmissionCounter << " transmission attempts";
             MESSAGE_END();
-            container.pop_front();
+            window.pop_front();
         }
         else
         {
             break;
         }
     }
-    show_seqnr_list("after  removal: ",container);
+    show_seqnr_list("after  removal: ",window);
 }
 
 bool
@@ -578,13 +582,12 @@ GoBackN::retransmissionState() const
 }
 
 void
-GoBackN::show_seqnr_list(const char* name, CompoundContainer& compoundList) const
+GoBackN::show_seqnr_list(const char* name, const SequenceWindow& window) const
 {
     MESSAGE_BEGIN(NORMAL, logger, m, getFUN()->getName());
     m << " " << name << " [";
-    for ( CompoundContainer::iterator it = compoundList.begin() ; it != compoundList.end() ; it++ ) {
-        int seqnr = getCommand( (*it)->getCommandPool() )->getNS();
-        m << seqnr << " ";
+    for ( SequenceWindow::const_iterator it = window.begin() ; it != window.end() ; it++ ) {
+        m << it.sequenceNumber() << " ";
     }
     m << "]";
     MESSAGE_END();
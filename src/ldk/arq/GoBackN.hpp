@@ -31,6 +31,7 @@
 #include <WNS/pyconfig/View.hpp>
 
 #include <WNS/ldk/arq/ARQ.hpp>
+#include <WNS/ldk/arq/SequenceWindow.hpp>
 #include <WNS/ldk/CommandTypeSpecifier.hpp>
 #include <WNS/ldk/HasReceptor.hpp>
 #include <WNS/ldk/HasConnector.hpp>
@@ -46,7 +47,7 @@
 #include <WNS/logger/Logger.hpp>
 #include <WNS/probe/bus/ContextCollector.hpp>
 
-#include <list>
+#include <deque>
 #include <cmath>
 
 namespace wns { namespace ldk { namespace arq {
@@ -135,7 +136,10 @@ namespace wns { namespace ldk { namespace arq {
         public events::CanTimeout
     {
         friend class ::wns::ldk::arq::tests::GoBackNTest;
-        typedef std::list<CompoundPtr> CompoundContainer;
+        /**
+         * Only ever used at its ends.
+         */
+        typedef std::deque<CompoundPtr> CompoundContainer;
 
     public:
         // FUNConfigCreator interface realisation
@@ -211,9 +215,9 @@ namespace wns { namespace ldk { namespace arq {
         void
         onNAKFrame(const CompoundPtr& compound);
 
-        // remove ACKed PDU from list
+        // remove ACKed PDUs from the front of window
         void
-        removeACKed(const ARQCommand::SequenceNumber ackedNS, CompoundContainer& container);
+        removeACKed(const ARQCommand::SequenceNumber ackedNS, SequenceWindow& window);
 
         // prepare list of frames to retransmit
         void
@@ -230,7 +234,7 @@ namespace wns { namespace ldk { namespace arq {
          * @brief logger output of sequence numbers
          */
         void
-        show_seqnr_list(const char* name, CompoundContainer& compoundList) const;
+        show_seqnr_list(const char* name, const SequenceWindow& window) const;
 
         virtual bool
         onSuspend() const;
@@ -284,12 +288,12 @@ namespace wns { namespace ldk { namespace arq {
         /**
          * @brief The packets sent but not acknowledged yet (Tx side).
          */
-        CompoundContainer sentPDUs;
+        SequenceWindow sentPDUs;
 
         /**
          * @brief List of packets to be retransmit (Tx side)
          */
-        CompoundContainer toRetransmit;
+        SequenceWindow toRetransmit;
 
         /**
          * @brief list of ACK PDU to be sent (Rx side).
@@ -141,7 +141,7 @@ PiggyBacker::calculateSizes(const CommandPool* commandPool, Bit& commandPoolSize
     //What are the sizes in the upper Layers
     getFUN()->calculateSizes(commandPool, commandPoolSize, sduSize, this);
 
-    PiggyBackerCommand* command = getCommand(commandPool);
+    const PiggyBackerCommand* command = peekCommand(commandPool);
     if(command->peer.piggyBacked)
     {
         commandPoolSize += bitsIfPiggyBacked;
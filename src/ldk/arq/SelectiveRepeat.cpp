@@ -62,11 +62,12 @@ SelectiveRepeat::SelectiveRepeat(fun::FUN* fuNet, const wns::pyconfig::View& con
     NR(0),
     LA(0),
     activeCompound(CompoundPtr()),
-    sentPDUs(),
-    toRetransmit(),
+    sentPDUs(sequenceNumberSize),
+    toRetransmit(sequenceNumberSize),
     ackPDUs(),
-    receivedPDUs(),
-    receivedACKs(),
+    receivedPDUs(sequenceNumberSize),
+    receivedACKs(sequenceNumberSize),
+    highestACK(0),
     sendNow(false),
     resendTimeout(config.get<double>("resendTimeout")),
     retransmissionInterval(resendTimeout),
@@ -168,7 +169,7 @@ SelectiveRepeat::getACK()
 {
     assure(hasACK(), getFUN()->getName() + " hasSomethingToSend has not been called to check whether there is something to send.");
 
-    CompoundPtr nextACKToBeSent = ackPDUs.front();
+    CompoundPtr nextACKToBeSent = wns::move(ackPDUs.front());
     ackPDUs.pop_front();
 
     MESSAGE_BEGIN(NORMAL, logger, m, "Sent ACK frame ");
@@ -203,7 +204,7 @@ SelectiveRepeat::getData()
         // delete from beginning of retransmission buffer and store it
         // to the end of the sent buffer
         toRetransmit.pop_front();
-        sentPDUs.push_back(nextPDUToBeRetransmit);
+        sentPDUs.push_back(command->getNS(), nextPDUToBeRetransmit);
 
         MESSAGE_BEGIN(NORMAL, logger, m, "Re-Sent I frame ");
         m << getCommand(nextPDUToBeRetransmit->getCommandPool())->getNS();
@@ -233,7 +234,7 @@ SelectiveRepeat::getData()
     myCommand->localTransmissionCounter++;
     CompoundPtr it = activeCompound->copy();
     // store the PDU we now send in the Retransmission FIFO Buffer
-    sentPDUs.push_back(activeCompound);
+    sentPDUs.push_back(myCommand->getNS(), activeCompound);
     // empty the space for new outgoing compounds
     activeCompound = CompoundPtr();
 
@@ -301,26 +302,18 @@ SelectiveRepeat::onIFrame(const CompoundPtr& compound)
         ++NR;
 
         // check if there are subsequent frames we have already received
-        while (receivedPDUs.empty() == false)
+        while (receivedPDUs.contains(NR))
         {
-            ARQCommand::SequenceNumber toDeliver =  getCommand(receivedPDUs.front())->getNS();
-
-            if(toDeliver != NR)
-            {
-                break;
-            }
-
-            assure(toDeliver == NR,
-                   "NS must be equal to NR since the loop will not be entered if it's greater zero and it cannot be smaller!!");
             // if so, deliver them
             MESSAGE_BEGIN(NORMAL, logger, m, "Delivering I frame ");
             m << NR;
             MESSAGE_END();
 
-            getDeliverer()->getAcceptor(receivedPDUs.front())->onData(receivedPDUs.front());
+            CompoundPtr toDeliver = receivedPDUs.find(NR);
+            getDeliverer()->getAcceptor(toDeliver)->onData(toDeliver);
 
-            // and remove them from the receivedPDUs list.
-            receivedPDUs.pop_front();
+            // and remove them from the receivedPDUs window.
+            receivedPDUs.erase(NR);
             MESSAGE_BEGIN(NORMAL, logger, m, "Removing from receivedPDUs: I-Frame ");
             m << NR;
             MESSAGE_END();
@@ -340,7 +333,14 @@ SelectiveRepeat::onIFrame(const CompoundPtr& compound)
             MESSAGE_END();
 
             // store the received frame for later
-            keepSorted(compound, receivedPDUs);
+            if (receivedPDUs.contains(command->getNS()))
+            {
+                MESSAGE_SINGLE(NORMAL, logger, "Don't need to insert, already buffered");
+            }
+            else
+            {
+                receivedPDUs.push_back(command->getNS(), compound);
+            }
         }
         else
         {
@@ -392,18 +392,10 @@ SelectiveRepeat::onACKFrame(const CompoundPtr& compound)
         this->ackDelayProbeBus->put( compound, wns::simulator::getEventScheduler()->getTime() - command->magic.ackSentTime );
 
         // Now check if subsequent ACKs have been received before
-        while(this->receivedACKs.empty() == false)
+        while(this->receivedACKs.contains(this->LA))
         {
-            if(this->getCommand(this->receivedACKs.front())->getNS() == this->LA)
-            {
-                this->LA++;
-                this->receivedACKs.front() = CompoundPtr();
-                this->receivedACKs.pop_front();
-            }
-            else
-            {
-                break;
-            }
+            this->receivedACKs.erase(this->LA);
+            this->LA++;
         }
         this->trySuspend();
     }
@@ -421,8 +413,19 @@ SelectiveRepeat::onACKFrame(const CompoundPtr& compound)
         {
             // Enter Retransmission State
             MESSAGE_SINGLE(NORMAL, logger,"Entering retransmission state on out-of-sequence ACK");
-            // push current ACK to the list of received ones
-            this->keepSorted(compound, this->receivedACKs);
+            // push current ACK to the window of received ones
+            if (this->receivedACKs.contains(command->getNS()))
+            {
+                MESSAGE_SINGLE(NORMAL, logger, "Don't need to insert, already in window");
+            }
+            else
+            {
+                if (this->receivedACKs.empty() || command->getNS() > this->highestACK)
+                {
+                    this->highestACK = command->getNS();
+                }
+                this->receivedACKs.push_back(command->getNS(), compound);
+            }
             // prepare PDU List for Retransmission
             this->prepareRetransmission();
             if (this->retransmissionState() == false)
@@ -478,10 +481,10 @@ SelectiveRepeat::prepareRetransmission()
     else
     {
         // remember the last ACK
-        lastACK = this->getCommand(receivedACKs.back())->getNS();
+        lastACK = highestACK;
     }
 
-    for (CompoundContainer::iterator it = sentPDUs.begin(); it != sentPDUs.end();	)
+    for (SequenceWindow::const_iterator it = sentPDUs.begin(); it != sentPDUs.end();	)
     {
         SelectiveRepeatCommand* command = this->getCommand(*it);
         ARQCommand::SequenceNumber lookingAt = command->getNS();
@@ -495,13 +498,13 @@ SelectiveRepeat::prepareRetransmission()
                 m << lookingAt << " for retransmission:";
                 MESSAGE_END();
 
-                CompoundContainer::iterator copyOfIt = it++;
-                toRetransmit.push_back((*copyOfIt));
+                CompoundPtr compound = *it++;
+                toRetransmit.push_back(lookingAt, compound);
 
                 // collect statistics available for other FUs
-                this->statusCollector->onFailedTransmission((*copyOfIt));
+                this->statusCollector->onFailedTransmission(compound);
 
-                sentPDUs.erase(copyOfIt);
+                sentPDUs.erase(lookingAt);
                 continue;
             }
         }
@@ -510,62 +513,34 @@ SelectiveRepeat::prepareRetransmission()
 } // prepareRetransmission
 
 
+// remove ACKed PDU from window
 void
-SelectiveRepeat::keepSorted(const CompoundPtr& compound, CompoundContainer& container)
+SelectiveRepeat::removeACKed(const CompoundPtr& ackCompound, SequenceWindow& window)
 {
-    SelectiveRepeatCommand* command = this->getCommand(compound);
-
-    ARQCommand::SequenceNumber toInsert = command->getNS();
-    CompoundContainer::iterator it;
-    CompoundContainer::iterator itEnd = container.end();
+    SelectiveRepeatCommand* command = getCommand(ackCompound->getCommandPool());
+    ARQCommand::SequenceNumber NS = command->getNS();
+    CompoundPtr acked = window.find(NS);
 
-    for(it = container.begin(); it != itEnd; ++it)
+    if(acked == CompoundPtr())
     {
-        ARQCommand::SequenceNumber lookingAt = getCommand(*it)->getNS();
-
-        if(lookingAt == toInsert)
-        {
-            MESSAGE_SINGLE(NORMAL, logger, "Don't need to insert, already in list");
-            return;
-        }
-
-        if(lookingAt > toInsert)
-        {
-            break;
-        }
+        return;
     }
-    container.insert(it, compound);
-} // keepSorted
 
+    // a probe counting the number of transmissions needed
+    transmissionAttemptsProbeBus->put( ackCompound, getCommand(acked)->localTransmissionCounter);
+    // a probe counting the RoundTripTime needed
+    simTimeType rtt = wns::simulator::getEventScheduler()->getTime() - getCommand(acked->getCommandPool())->local.firstSentTime;
+    roundTripTimeProbeBus->put(ackCompound, rtt);
+    // adjust min time between retransmissions to two times the RTT
+    retransmissionInterval = std::min<simTimeType>(2*rtt, retransmissionInterval);
 
-// remove ACKed PDU from list
-void
-SelectiveRepeat::removeACKed(const CompoundPtr& ackCompound, CompoundContainer& container)
-{
-    SelectiveRepeatCommand* command = getCommand(ackCompound->getCommandPool());
-    int NS = command->getNS();
-    for(CompoundContainer::iterator iter = container.begin();  iter != container.end(); ++iter )
-    {
-        if(getCommand((*iter)->getCommandPool())->getNS() == NS)
-        {
-            // a probe counting the number of transmissions needed
-            transmissionAttemptsProbeBus->put( ackCompound, getCommand(*iter)->localTransmissionCounter);
-            // a probe counting the RoundTripTime needed
-            simTimeType rtt = wns::simulator::getEventScheduler()->getTime() - getCommand((*iter)->getCommandPool())->local.firstSentTime;
-            roundTripTimeProbeBus->put(ackCompound, rtt);
-            // adjust min time between retransmissions to two times the RTT
-            retransmissionInterval = std::min<simTimeType>(2*rtt, retransmissionInterval);
-
-            // collect statistics available for other FUs
-            this->statusCollector->onSuccessfullTransmission((*iter));
-
-            MESSAGE_BEGIN(NORMAL, logger, m, "ACK frame received after ");
-            m << rtt << " s and " << getCommand(*iter)->localTransmissionCounter << " transmission attempts. RTI is now " << retransmissionInterval;
-            MESSAGE_END();
-            container.erase(iter);
-            break;
-        }
-    }
+    // collect statistics available for other FUs
+    this->statusCollector->onSuccessfullTransmission(acked);
+
+    MESSAGE_BEGIN(NORMAL, logger, m, "ACK frame received after ");
+    m << rtt << " s and " << getCommand(acked)->localTransmissionCounter << " transmission attempts. RTI is now " << retransmissionInterval;
+    MESSAGE_END();
+    window.erase(NS);
 }
 
 // return whether we are in retransmission mode
@@ -593,26 +568,18 @@ SelectiveRepeat::doDeliver()
     delayingDelivery = false;
 
     // check if there are subsequent frames we have already received
-    while (!receivedPDUs.empty())
+    while (receivedPDUs.contains(NR))
     {
-        ARQCommand::SequenceNumber toDeliver =  getCommand(receivedPDUs.front())->getNS();
-
-        if(toDeliver != NR)
-        {
-            break;
-        }
-
-        assure(toDeliver == NR,
-               "NS must be equal to NR since the loop will not be entered if it's greater zero and it cannot be smaller!!");
         // if so, deliver them
         MESSAGE_BEGIN(NORMAL, logger, m, "Delivering I frame ");
         m << NR;
         MESSAGE_END();
 
-        getDeliverer()->getAcceptor(receivedPDUs.front())->onData(receivedPDUs.front());
+        CompoundPtr toDeliver = receivedPDUs.find(NR);
+        getDeliverer()->getAcceptor(toDeliver)->onData(toDeliver);
 
-        // and remove them from the receivedPDUs list.
-        receivedPDUs.pop_front();
+        // and remove them from the receivedPDUs window.
+        receivedPDUs.erase(NR);
         MESSAGE_BEGIN(NORMAL, logger, m, "Removing from receivedPDUs: I-Frame ");
         m << NR;
         MESSAGE_END();
@@ -31,6 +31,7 @@
 #include <WNS/pyconfig/View.hpp>
 
 #include <WNS/ldk/arq/ARQ.hpp>
+#include <WNS/ldk/arq/SequenceWindow.hpp>
 #include <WNS/ldk/Delayed.hpp>
 #include <WNS/ldk/SuspendableInterface.hpp>
 #include <WNS/ldk/SuspendSupport.hpp>
@@ -173,11 +174,8 @@ namespace wns { namespace ldk { namespace arq {
         void onIFrame(const CompoundPtr& compound);
         void onACKFrame(const CompoundPtr& compound);
 
-        // sort into given Compound List
-        void keepSorted(const CompoundPtr& compound, CompoundContainer& conatiner);
-
-        // remove ACKed PDU from list
-        void removeACKed(const CompoundPtr& ackCompound, CompoundContainer& container);
+        // remove ACKed PDU from window
+        void removeACKed(const CompoundPtr& ackCompound, SequenceWindow& window);
 
         // prepare list of frames to retransmit
         void prepareRetransmission();
@@ -226,14 +224,15 @@ namespace wns { namespace ldk { namespace arq {
         CompoundPtr activeCompound;
 
         /**
-         * @brief The packets sent but not acknowledged yet.
+         * @brief The packets sent but not acknowledged yet, in the
+         * order of their last transmission.
          */
-        CompoundContainer sentPDUs;
+        SequenceWindow sentPDUs;
 
         /**
-         * @brief List of packets to be retransmit
+         * @brief Packets to be retransmitted, in order.
          */
-        CompoundContainer toRetransmit;
+        SequenceWindow toRetransmit;
 
         /**
          * @brief list of ACK PDU to be sent.
@@ -241,14 +240,20 @@ namespace wns { namespace ldk { namespace arq {
         CompoundContainer ackPDUs;
 
         /**
-         * @brief received compounds.
+         * @brief received out-of-sequence compounds.
          */
-        CompoundContainer receivedPDUs;
+        SequenceWindow receivedPDUs;
 
         /**
          * @brief received out-of-sequence ACKs.
          */
-        CompoundContainer receivedACKs;
+        SequenceWindow receivedACKs;
+
+        /**
+         * @brief Highest sequence number in receivedACKs (valid if not
+         * empty).
+         */
+        ARQCommand::SequenceNumber highestACK;
 
         /**
          * @brief Remember to send the activeCompound.
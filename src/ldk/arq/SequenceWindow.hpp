@@ -0,0 +1,332 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_LDK_ARQ_SEQUENCEWINDOW_HPP
+#define WNS_LDK_ARQ_SEQUENCEWINDOW_HPP
+
+#include <WNS/ldk/arq/ARQ.hpp>
+#include <WNS/ldk/Compound.hpp>
+#include <WNS/Assure.hpp>
+
+#include <vector>
+#include <cstddef>
+
+namespace wns { namespace ldk { namespace arq {
+
+    /**
+     * @brief Compounds of an ARQ window, indexed by sequence number
+     *
+     * The compound with sequence number sn is kept in slot sn % capacity
+     * of a ring allocated once, so looking up and removing a compound by
+     * its sequence number takes constant time. At most capacity
+     * consecutive sequence numbers may be held at a time.
+     *
+     * Apart from that the compounds form a FIFO queue in the order they
+     * were added (linked through the slots), which is the order of
+     * iteration.
+     *
+     * A bitmap with one bit per slot marks the slots in use, so checking
+     * whether a sequence number is outstanding (e.g. while advancing over
+     * acknowledged frames) usually doesn't touch the slots at all.
+     */
+    class SequenceWindow
+    {
+        typedef ARQCommand::SequenceNumber SequenceNumber;
+
+        static const std::size_t npos = static_cast<std::size_t>(-1);
+
+        struct Slot
+        {
+            Slot() :
+                compound(),
+                sequenceNumber(0),
+                prev(npos),
+                next(npos)
+            {}
+
+            CompoundPtr compound;
+            SequenceNumber sequenceNumber;
+            std::size_t prev;
+            std::size_t next;
+        };
+
+    public:
+        class const_iterator
+        {
+            friend class SequenceWindow;
+
+            const_iterator(const SequenceWindow* _window, std::size_t _slot) :
+                window(_window),
+                slot(_slot)
+            {}
+
+        public:
+            const_iterator() :
+                window(NULL),
+                slot(npos)
+            {}
+
+            const CompoundPtr&
+            operator*() const
+            {
+                return window->slots[slot].compound;
+            }
+
+            const CompoundPtr*
+            operator->() const
+            {
+                return &window->slots[slot].compound;
+            }
+
+            SequenceNumber
+            sequenceNumber() const
+            {
+                return window->slots[slot].sequenceNumber;
+            }
+
+            const_iterator&
+            operator++()
+            {
+                slot = window->slots[slot].next;
+                return *this;
+            }
+
+            const_iterator
+            operator++(int)
+            {
+                const_iterator old = *this;
+                ++(*this);
+                return old;
+            }
+
+            bool
+            operator==(const const_iterator& other) const
+            {
+                return slot == other.slot;
+            }
+
+            bool
+            operator!=(const const_iterator& other) const
+            {
+                return slot != other.slot;
+            }
+
+        private:
+            const SequenceWindow* window;
+            std::size_t slot;
+        };
+
+        explicit
+        SequenceWindow(std::size_t capacity) :
+            slots(capacity),
+            held(capacity, false),
+            head(npos),
+            tail(npos),
+            count(0)
+        {
+            assure(capacity > 0, "A SequenceWindow needs at least one slot");
+        }
+
+        std::size_t
+        size() const
+        {
+            return count;
+        }
+
+        bool
+        empty() const
+        {
+            return count == 0;
+        }
+
+        std::size_t
+        capacity() const
+        {
+            return slots.size();
+        }
+
+        const_iterator
+        begin() const
+        {
+            return const_iterator(this, head);
+        }
+
+        const_iterator
+        end() const
+        {
+            return const_iterator(this, npos);
+        }
+
+        /**
+         * @brief The compound added first
+         */
+        const CompoundPtr&
+        front() const
+        {
+            assure(!empty(), "SequenceWindow is empty");
+            return slots[head].compound;
+        }
+
+        /**
+         * @brief Add a compound at the end of the queue
+         *
+         * @pre The slot of sequenceNumber is free, i.e. sequenceNumber
+         * is neither held yet nor capacity or more apart from a
+         * sequence number held.
+         */
+        void
+        push_back(SequenceNumber sequenceNumber, const CompoundPtr& compound)
+        {
+            Slot& slot = slots[index(sequenceNumber)];
+            assure(!held[index(sequenceNumber)], "Slot of sequence number " << sequenceNumber
+                   << " is occupied by " << slot.sequenceNumber << ", window too small");
+            assure(compound != CompoundPtr(), "Can't keep an empty compound");
+
+            held[index(sequenceNumber)] = true;
+            slot.compound = compound;
+            slot.sequenceNumber = sequenceNumber;
+            slot.prev = tail;
+            slot.next = npos;
+
+            if (tail == npos)
+            {
+                head = index(sequenceNumber);
+            }
+            else
+            {
+                slots[tail].next = index(sequenceNumber);
+            }
+            tail = index(sequenceNumber);
+            ++count;
+        }
+
+        void
+        pop_front()
+        {
+            assure(!empty(), "SequenceWindow is empty");
+            unlink(head);
+        }
+
+        bool
+        contains(SequenceNumber sequenceNumber) const
+        {
+            std::size_t i = index(sequenceNumber);
+            return held[i] && slots[i].sequenceNumber == sequenceNumber;
+        }
+
+        /**
+         * @brief The compound with sequenceNumber, an empty CompoundPtr
+         * if not held
+         */
+        CompoundPtr
+        find(SequenceNumber sequenceNumber) const
+        {
+            if (contains(sequenceNumber) == false)
+            {
+                return CompoundPtr();
+            }
+            return slots[index(sequenceNumber)].compound;
+        }
+
+        /**
+         * @brief Remove the compound with sequenceNumber
+         *
+         * @return the removed compound, an empty CompoundPtr if not held
+         */
+        CompoundPtr
+        erase(SequenceNumber sequenceNumber)
+        {
+            if (contains(sequenceNumber) == false)
+            {
+                return CompoundPtr();
+            }
+
+            std::size_t i = index(sequenceNumber);
+            CompoundPtr compound = slots[i].compound;
+            unlink(i);
+            return compound;
+        }
+
+        void
+        clear()
+        {
+            while (!empty())
+            {
+                unlink(head);
+            }
+        }
+
+    private:
+        std::size_t
+        index(SequenceNumber sequenceNumber) const
+        {
+            assure(sequenceNumber >= 0, "Negative sequence number");
+            return static_cast<std::size_t>(sequenceNumber % static_cast<SequenceNumber>(slots.size()));
+        }
+
+        void
+        unlink(std::size_t i)
+        {
+            Slot& slot = slots[i];
+
+            if (slot.prev == npos)
+            {
+                head = slot.next;
+            }
+            else
+            {
+                slots[slot.prev].next = slot.next;
+            }
+
+            if (slot.next == npos)
+            {
+                tail = slot.prev;
+            }
+            else
+            {
+                slots[slot.next].prev = slot.prev;
+            }
+
+            held[i] = false;
+            slot.compound = CompoundPtr();
+            slot.prev = npos;
+            slot.next = npos;
+            --count;
+        }
+
+        std::vector<Slot> slots;
+        std::vector<bool> held;
+        std::size_t head;
+        std::size_t tail;
+        std::size_t count;
+    };
+
+} // arq
+} // ldk
+} // wns
+
+#endif // NOT defined WNS_LDK_ARQ_SEQUENCEWINDOW_HPP
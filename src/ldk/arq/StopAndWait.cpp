@@ -284,7 +284,7 @@ StopAndWait::calculateSizes(const CommandPool* commandPool, Bit& commandPoolSize
     //What are the sizes in the upper Layers
     this->getFUN()->calculateSizes(commandPool, commandPoolSize, sduSize, this);
 
-    StopAndWaitCommand* command = this->getCommand(commandPool);
+    const StopAndWaitCommand* command = this->peekCommand(commandPool);
 
     switch(command->peer.type)
     {
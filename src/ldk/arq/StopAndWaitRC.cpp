@@ -286,7 +286,7 @@ StopAndWaitRC::calculateSizes(const CommandPool* commandPool, Bit& commandPoolSi
     //What are the sizes in the upper Layers
     getFUN()->calculateSizes(commandPool, commandPoolSize, sduSize, this);
 
-    StopAndWaitRCCommand* command = getCommand(commandPool);
+    const StopAndWaitRCCommand* command = peekCommand(commandPool);
 
     switch(command->peer.type)
     {
@@ -63,7 +63,6 @@ namespace wns { namespace ldk { namespace arq { namespace tests {
 		CPPUNIT_TEST( ACKPending );
 		CPPUNIT_TEST( outOfSeqIFrames );
 		CPPUNIT_TEST( speedWithLoss );
-		CPPUNIT_TEST( keepSorted );
 		CPPUNIT_TEST_SUITE_END();
 	public:
 		void
@@ -111,9 +110,6 @@ namespace wns { namespace ldk { namespace arq { namespace tests {
 		void
 		speedWithLoss();
 
-		void
-		keepSorted();
-
 	private:
 		virtual void
 		prepare();
@@ -705,33 +701,6 @@ namespace wns { namespace ldk { namespace arq { namespace tests {
 	} // speedWithLoss
 
 
-	void
-	SelectiveRepeatTest::keepSorted()
-	{
-		// CAUTION -- some hard-coded numbers in this
-		// Test are directly related to the windowsize
-
-		std::list<CompoundPtr> myList;
-
-		const int v[4] = { 1, 0, 3, 2 };
-
-		myList.clear();
-
-		for (int i=0; i<4; i++)
-		{
-			getTestee<SelectiveRepeat>()->keepSorted(createIFrame(v[i]), myList);
-		}
-
-		int counter=0;
-		std::list<CompoundPtr>::iterator i;
-
-		for (i = myList.begin(); i != myList.end() ; i++)
-		{
-			CPPUNIT_ASSERT( getTestee<SelectiveRepeat>()->getCommand(((*i)->getCommandPool()))->getNS() == counter++ );
-		}
-
-		myList.clear();
-	} // keepSorted
 
 
 	wns::ldk::CompoundPtr
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/arq/SequenceWindow.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace wns { namespace ldk { namespace arq { namespace tests {
+
+    class SequenceWindowTest :
+        public CppUnit::TestFixture
+    {
+        CPPUNIT_TEST_SUITE( SequenceWindowTest );
+        CPPUNIT_TEST( testQueueOrder );
+        CPPUNIT_TEST( testEraseBySequenceNumber );
+        CPPUNIT_TEST( testWrapAround );
+        CPPUNIT_TEST( testSequenceOrder );
+        CPPUNIT_TEST_SUITE_END();
+
+    public:
+        void
+        setUp()
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                compounds.push_back(CompoundPtr(new Compound()));
+            }
+        }
+
+        void
+        tearDown()
+        {
+            compounds.clear();
+        }
+
+        void
+        testQueueOrder()
+        {
+            SequenceWindow window(4);
+            CPPUNIT_ASSERT(window.empty());
+
+            // the queue keeps the order of insertion, not the order of
+            // sequence numbers
+            window.push_back(2, compounds[2]);
+            window.push_back(0, compounds[0]);
+            window.push_back(1, compounds[1]);
+            CPPUNIT_ASSERT_EQUAL(std::size_t(3), window.size());
+
+            SequenceWindow::const_iterator it = window.begin();
+            CPPUNIT_ASSERT_EQUAL(ARQCommand::SequenceNumber(2), it.sequenceNumber());
+            CPPUNIT_ASSERT(*it == compounds[2]);
+            ++it;
+            CPPUNIT_ASSERT_EQUAL(ARQCommand::SequenceNumber(0), it.sequenceNumber());
+            ++it;
+            CPPUNIT_ASSERT_EQUAL(ARQCommand::SequenceNumber(1), it.sequenceNumber());
+            ++it;
+            CPPUNIT_ASSERT(it == window.end());
+
+            CPPUNIT_ASSERT(window.front() == compounds[2]);
+            window.pop_front();
+            CPPUNIT_ASSERT(window.front() == compounds[0]);
+            CPPUNIT_ASSERT(!window.contains(2));
+
+            window.clear();
+            CPPUNIT_ASSERT(window.empty());
+            CPPUNIT_ASSERT(window.begin() == window.end());
+        }
+
+        void
+        testEraseBySequenceNumber()
+        {
+            SequenceWindow window(4);
+            for (int i = 0; i < 4; ++i)
+            {
+                window.push_back(i, compounds[i]);
+            }
+
+            CPPUNIT_ASSERT(window.erase(2) == compounds[2]);
+            CPPUNIT_ASSERT(window.erase(2) == CompoundPtr());
+            CPPUNIT_ASSERT(window.find(2) == CompoundPtr());
+            CPPUNIT_ASSERT(window.find(3) == compounds[3]);
+
+            CPPUNIT_ASSERT(window.erase(0) == compounds[0]);
+            CPPUNIT_ASSERT(window.erase(3) == compounds[3]);
+            CPPUNIT_ASSERT_EQUAL(std::size_t(1), window.size());
+            CPPUNIT_ASSERT(window.front() == compounds[1]);
+            CPPUNIT_ASSERT(++window.begin() == window.end());
+
+            // a slot is free again once erased
+            window.push_back(2, compounds[2]);
+            CPPUNIT_ASSERT(window.front() == compounds[1]);
+            CPPUNIT_ASSERT(window.find(2) == compounds[2]);
+        }
+
+        void
+        testWrapAround()
+        {
+            SequenceWindow window(4);
+            window.push_back(2, compounds[2]);
+            window.push_back(3, compounds[3]);
+
+            // 6 shares the slot of 2, but is a different sequence number
+            CPPUNIT_ASSERT(!window.contains(6));
+            CPPUNIT_ASSERT(window.erase(6) == CompoundPtr());
+
+            window.push_back(4, compounds[4]);
+            window.push_back(5, compounds[5]);
+            CPPUNIT_ASSERT_EQUAL(std::size_t(4), window.size());
+
+            window.pop_front();
+            window.push_back(6, compounds[6]);
+            CPPUNIT_ASSERT(window.contains(6));
+            CPPUNIT_ASSERT(!window.contains(2));
+            CPPUNIT_ASSERT(window.find(6) == compounds[6]);
+            CPPUNIT_ASSERT(window.front() == compounds[3]);
+        }
+
+        void
+        testSequenceOrder()
+        {
+            SequenceWindow window(4);
+
+            // frames arriving out of sequence, as on the receive side of
+            // SelectiveRepeat
+            const int arrival[4] = { 1, 0, 3, 2 };
+            for (int i = 0; i < 4; ++i)
+            {
+                CPPUNIT_ASSERT(!window.contains(arrival[i]));
+                window.push_back(arrival[i], compounds[arrival[i]]);
+            }
+
+            // walking the sequence numbers yields them sorted, whatever
+            // the order of arrival
+            ARQCommand::SequenceNumber next = 0;
+            while (window.contains(next))
+            {
+                CPPUNIT_ASSERT(window.erase(next) == compounds[next]);
+                ++next;
+            }
+            CPPUNIT_ASSERT_EQUAL(ARQCommand::SequenceNumber(4), next);
+            CPPUNIT_ASSERT(window.empty());
+
+            // a gap stops the walk, the frames behind it stay
+            window.push_back(5, compounds[5]);
+            window.push_back(7, compounds[7]);
+            CPPUNIT_ASSERT(window.erase(4) == CompoundPtr());
+            CPPUNIT_ASSERT(!window.contains(next));
+            CPPUNIT_ASSERT_EQUAL(std::size_t(2), window.size());
+        }
+
+    private:
+        std::vector<CompoundPtr> compounds;
+    };
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( SequenceWindowTest );
+
+} // tests
+} // arq
+} // ldk
+} // wns
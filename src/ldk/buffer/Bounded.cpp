@@ -50,7 +50,6 @@ Bounded::Bounded(fun::FUN* fuNet, const wns::pyconfig::View& config) :
 
     buffer(ContainerType()),
     maxSize(config.get<int>("size")),
-    currentSize(),
     sizeCalculator(),
     inWakeup(false)
 {
@@ -78,18 +77,35 @@ Bounded::~Bounded()
 bool
 Bounded::doIsAccepting(const CompoundPtr& compound) const
 {
-    return currentSize + (*sizeCalculator)(compound) <= maxSize;
+    return buffer.getSize() + (*sizeCalculator)(compound) <= maxSize;
 } // isAccepting
 
 
+std::size_t
+Bounded::doIsAcceptingBurst(const CompoundSpan& compounds) const
+{
+    unsigned long int size = buffer.getSize();
+    std::size_t accepted = 0;
+
+    for (; accepted < compounds.size(); ++accepted)
+    {
+        size += (*sizeCalculator)(compounds[accepted]);
+        if (size > maxSize)
+        {
+            break;
+        }
+    }
+    return accepted;
+} // doIsAcceptingBurst
+
+
 void
 Bounded::doSendData(const CompoundPtr& compound)
 {
     assure(isAccepting(compound), "sendData called although not accepting.");
     assure(compound->getRefCount() > 0, "Reference counting defect.");
 
-    buffer.push_back(compound);
-    currentSize += (*sizeCalculator)(compound);
+    enqueue(compound);
 
     increaseTotalPDUs();
     probe();
@@ -98,13 +114,43 @@ Bounded::doSendData(const CompoundPtr& compound)
 } // doSendData
 
 
+void
+Bounded::doSendDataBurst(const CompoundSpan& compounds)
+{
+    assure(doIsAcceptingBurst(compounds) == compounds.size(), "sendDataBurst called although not accepting.");
+
+    // queue and drain per compound as doSendData does, but wake up the
+    // upper FUs only once for the whole burst
+    for (CompoundSpan::const_iterator it = compounds.begin(); it != compounds.end(); ++it)
+    {
+        assure((*it)->getRefCount() > 0, "Reference counting defect.");
+
+        enqueue(*it);
+
+        increaseTotalPDUs();
+        probe();
+
+        while(tryToSendOnce());
+    }
+
+    tryToSend();
+} // doSendDataBurst
+
+
 void
 Bounded::doOnData(const CompoundPtr& compound)
 {
-    getDeliverer()->getAcceptor(compound)->onData(compound);
+    getUpperAcceptor(compound)->onData(compound);
 } // processIncoming
 
 
+void
+Bounded::doOnDataBurst(const CompoundSpan& compounds)
+{
+    getDeliverer()->deliverBurst(compounds);
+} // doOnDataBurst
+
+
 void
 Bounded::doWakeup()
 {
@@ -117,10 +163,10 @@ Bounded::tryToSend()
 {
     while(tryToSendOnce());
 
-    if(inWakeup == false && currentSize < maxSize)
+    if(inWakeup == false && buffer.getSize() < maxSize)
     {
         inWakeup = true;
-        getReceptor()->wakeup();
+        wakeupUpper();
         inWakeup = false;
     }
 } // tryToSend
@@ -134,22 +180,28 @@ Bounded::tryToSendOnce()
         return false;
     }
 
-    CompoundPtr compound = buffer.front();
-
-    if(getConnector()->hasAcceptor(compound) == false)
+    if(getConnector()->hasAcceptor(buffer.front()) == false)
     {
         return false;
     }
 
-    buffer.pop_front();
-    currentSize -= (*sizeCalculator)(compound);
+    // the size was calculated on insertion
+    CompoundPtr compound = buffer.pop_front();
 
-    IConnectorReceptacle* target = getConnector()->getAcceptor(compound);
+    IConnectorReceptacle* target = getLowerAcceptor(compound);
     target->sendData(compound);
 
     return true;
 } // tryToSendOnce
 
+
+void
+Bounded::enqueue(const CompoundPtr& compound)
+{
+    unsigned long int size = (*sizeCalculator)(compound);
+    buffer.push_back(compound, size, sizeCalculator->countsBits() ? Bit(size) : CompoundQueue::unknownLength);
+} // enqueue
+
 //
 // Buffer interface
 //
@@ -157,7 +209,7 @@ Bounded::tryToSendOnce()
 unsigned long int
 Bounded::getSize()
 {
-    return currentSize;
+    return buffer.getSize();
 } // size
 
 
@@ -168,3 +220,33 @@ Bounded::getMaxSize()
 } // getMaxSize
 
 
+unsigned long int
+Bounded::getNumberOfCompounds()
+{
+    return buffer.size();
+} // getNumberOfCompounds
+
+
+Bit
+Bounded::getSizeInBits()
+{
+    return buffer.getSizeInBits();
+} // getSizeInBits
+
+
+std::size_t
+Bounded::getSomethingToSend(Bit bits, CompoundContainer& compounds)
+{
+    std::size_t n = buffer.pop_front(bits, compounds);
+    probe();
+
+    if(n > 0)
+    {
+        // make room for the upper FUs
+        tryToSend();
+    }
+
+    return n;
+} // getSomethingToSend
+
+
@@ -29,12 +29,11 @@
 #define WNS_LDK_BUFFER_BOUNDED_HPP
 
 #include <WNS/ldk/buffer/Buffer.hpp>
+#include <WNS/ldk/buffer/CompoundQueue.hpp>
 #include <WNS/ldk/fu/Plain.hpp>
 
 #include <WNS/pyconfig/View.hpp>
 
-#include <list>
-
 namespace wns { namespace ldk { namespace buffer {
 
 	/**
@@ -45,7 +44,7 @@ namespace wns { namespace ldk { namespace buffer {
 		public Buffer,
 		public fu::Plain<Bounded>
 	{
-		typedef std::list<CompoundPtr> ContainerType;
+		typedef CompoundQueue ContainerType;
 	public:
 
 		Bounded(fun::FUN* fuNet, const wns::pyconfig::View& config);
@@ -54,26 +53,33 @@ namespace wns { namespace ldk { namespace buffer {
 		virtual void doSendData(const CompoundPtr& sdu);
 		virtual void doOnData(const CompoundPtr& compound);
 
+		virtual void doSendDataBurst(const CompoundSpan& compounds);
+		virtual void doOnDataBurst(const CompoundSpan& compounds);
+
 		//
 		// Buffer interface
 		//
 		virtual unsigned long int getSize();
 		virtual unsigned long int getMaxSize();
+		virtual unsigned long int getNumberOfCompounds();
+		virtual Bit getSizeInBits();
+		virtual std::size_t getSomethingToSend(Bit bits, CompoundContainer& compounds);
 
 	protected:
 		void tryToSend();
 		bool tryToSendOnce();
+		void enqueue(const CompoundPtr& compound);
 
 	private:
 		//
 		// CompoundHandlerInterface
 		//
 		virtual bool doIsAccepting(const CompoundPtr& compound) const;
+		virtual std::size_t doIsAcceptingBurst(const CompoundSpan& compounds) const;
 		virtual void doWakeup();
 
 		ContainerType buffer;
 		unsigned long int maxSize;
-		unsigned long int currentSize;
 		SizeCalculator* sizeCalculator;
 		bool inWakeup;
 	};
@@ -46,6 +46,12 @@ PerBit::operator()(const CompoundPtr& compound) const
 {
 	return compound->getLengthInBits();
 }
+
+bool
+PerBit::countsBits() const
+{
+	return true;
+}
 STATIC_FACTORY_REGISTER(PerBit, SizeCalculator, "Bit");
 
 
@@ -84,6 +90,18 @@ Buffer::onFunCreated()
 	// is not called. Whyever!?
 }
 
+Buffer::PDUCounter
+Buffer::getDroppedPDUs() const
+{
+	return droppedPDUs;
+}
+
+double
+Buffer::getDroppedSizeInWindow()
+{
+	return droppedPDUWindow.getAbsolute();
+}
+
 void
 Buffer::increaseTotalPDUs()
 {
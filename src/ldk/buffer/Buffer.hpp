@@ -30,6 +30,7 @@
 
 #include <WNS/ldk/FunctionalUnit.hpp>
 #include <WNS/ldk/FUNConfigCreator.hpp>
+#include <WNS/ldk/buffer/CompoundQueue.hpp>
 
 #include <WNS/probe/bus/ContextCollector.hpp>
 
@@ -53,6 +54,19 @@ namespace wns { namespace ldk { namespace buffer {
 		virtual unsigned long int
 		operator()(const CompoundPtr& compound) const = 0;
 
+		/**
+		 * @brief True if the size is the length of the compound in
+		 * bits
+		 *
+		 * Lets the buffers reuse the size instead of asking the
+		 * compound for its length again.
+		 */
+		virtual bool
+		countsBits() const
+		{
+			return false;
+		}
+
 		virtual
 		~SizeCalculator()
 		{}
@@ -78,6 +92,9 @@ namespace wns { namespace ldk { namespace buffer {
 		{
 			virtual unsigned long int
 			operator()(const CompoundPtr& compound) const;
+
+			virtual bool
+			countsBits() const;
 		};
 	}
 
@@ -89,9 +106,11 @@ namespace wns { namespace ldk { namespace buffer {
 		virtual public FunctionalUnit,
 		public events::PeriodicTimeout
 	{
+	public:
 		typedef unsigned long int PDUCounter;
 
-	public:
+		typedef CompoundQueue::CompoundContainer CompoundContainer;
+
 		Buffer(fun::FUN* fuNet, const pyconfig::View& config);
 
 		virtual
@@ -106,6 +125,42 @@ namespace wns { namespace ldk { namespace buffer {
 		virtual unsigned long int
 		getMaxSize() = 0;
 
+		/**
+		 * @brief Number of buffered compounds, regardless of the
+		 * size calculation strategy
+		 */
+		virtual unsigned long int
+		getNumberOfCompounds() = 0;
+
+		/**
+		 * @brief Total length of the buffered compounds in bits,
+		 * regardless of the size calculation strategy
+		 */
+		virtual Bit
+		getSizeInBits() = 0;
+
+		/**
+		 * @brief Take as many compounds from the front as fit into
+		 * bits in total (e.g. to fill a transport block)
+		 *
+		 * @return the number of compounds appended to compounds
+		 */
+		virtual std::size_t
+		getSomethingToSend(Bit bits, CompoundContainer& compounds) = 0;
+
+		/**
+		 * @brief Number of dropped PDUs so far
+		 */
+		PDUCounter
+		getDroppedPDUs() const;
+
+		/**
+		 * @brief Size of the PDUs dropped within the sliding window
+		 * (unit depends on the size calculation strategy)
+		 */
+		double
+		getDroppedSizeInWindow();
+
 	protected:
 		void
 		increaseTotalPDUs();
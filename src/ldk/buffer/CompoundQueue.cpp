@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/buffer/CompoundQueue.hpp>
+#include <WNS/Assure.hpp>
+
+using namespace wns::ldk;
+using namespace wns::ldk::buffer;
+
+const Bit CompoundQueue::unknownLength;
+
+
+CompoundQueue::CompoundQueue(std::size_t _capacity) :
+    compounds(),
+    sizes(),
+    bits(),
+    head(0),
+    count(0),
+    totalSize(0),
+    totalBits(0),
+    unknownBits(0)
+{
+    std::size_t capacity = 1;
+    while(capacity < _capacity)
+    {
+        capacity *= 2;
+    }
+
+    compounds.resize(capacity);
+    sizes.resize(capacity);
+    bits.resize(capacity);
+} // CompoundQueue
+
+
+void
+CompoundQueue::push_back(const CompoundPtr& compound, unsigned long int size, Bit length)
+{
+    if(count == compounds.size())
+    {
+        grow();
+    }
+
+    std::size_t ii = index(count);
+
+    compounds[ii] = compound;
+    sizes[ii] = size;
+    bits[ii] = length;
+    ++count;
+
+    totalSize += size;
+    if(length == unknownLength)
+    {
+        ++unknownBits;
+    }
+    else
+    {
+        totalBits += length;
+    }
+} // push_back
+
+
+CompoundPtr
+CompoundQueue::pop_front()
+{
+    assure(!empty(), "pop_front called on empty queue.");
+
+    CompoundPtr compound = wns::move(compounds[head]);
+    subtract(head);
+
+    head = index(1);
+    --count;
+
+    return compound;
+} // pop_front
+
+
+CompoundPtr
+CompoundQueue::pop_back()
+{
+    assure(!empty(), "pop_back called on empty queue.");
+
+    std::size_t ii = index(count - 1);
+
+    CompoundPtr compound = wns::move(compounds[ii]);
+    subtract(ii);
+
+    --count;
+
+    return compound;
+} // pop_back
+
+
+std::size_t
+CompoundQueue::pop_front(Bit _bits, CompoundContainer& _compounds)
+{
+    std::size_t n = countFitting(_bits);
+
+    _compounds.reserve(_compounds.size() + n);
+    for(std::size_t ii = 0; ii < n; ++ii)
+    {
+        _compounds.push_back(pop_front());
+    }
+
+    return n;
+} // pop_front
+
+
+const CompoundPtr&
+CompoundQueue::front() const
+{
+    assure(!empty(), "front called on empty queue.");
+    return compounds[head];
+} // front
+
+
+const CompoundPtr&
+CompoundQueue::back() const
+{
+    assure(!empty(), "back called on empty queue.");
+    return compounds[index(count - 1)];
+} // back
+
+
+std::size_t
+CompoundQueue::countFitting(Bit _bits) const
+{
+    Bit sum = 0;
+    std::size_t n = 0;
+
+    for(; n < count; ++n)
+    {
+        sum += lengthAt(index(n));
+        if(sum > _bits)
+        {
+            break;
+        }
+    }
+
+    return n;
+} // countFitting
+
+
+void
+CompoundQueue::clear()
+{
+    for(std::size_t ii = 0; ii < count; ++ii)
+    {
+        compounds[index(ii)] = CompoundPtr();
+    }
+
+    head = 0;
+    count = 0;
+    totalSize = 0;
+    totalBits = 0;
+    unknownBits = 0;
+} // clear
+
+
+Bit
+CompoundQueue::getSizeInBits() const
+{
+    for(std::size_t n = 0; unknownBits > 0 && n < count; ++n)
+    {
+        lengthAt(index(n));
+    }
+
+    return totalBits;
+} // getSizeInBits
+
+
+void
+CompoundQueue::grow()
+{
+    std::size_t capacity = compounds.size();
+
+    std::vector<CompoundPtr> newCompounds(2 * capacity);
+    std::vector<unsigned long int> newSizes(2 * capacity);
+    std::vector<Bit> newBits(2 * capacity);
+
+    // unwrap, the oldest compound goes to the front
+    for(std::size_t ii = 0; ii < count; ++ii)
+    {
+        std::size_t jj = index(ii);
+        newCompounds[ii].swap(compounds[jj]);
+        newSizes[ii] = sizes[jj];
+        newBits[ii] = bits[jj];
+    }
+
+    compounds.swap(newCompounds);
+    sizes.swap(newSizes);
+    bits.swap(newBits);
+    head = 0;
+} // grow
+
+
+Bit
+CompoundQueue::lengthAt(std::size_t ii) const
+{
+    if(bits[ii] == unknownLength)
+    {
+        bits[ii] = compounds[ii]->getLengthInBits();
+        totalBits += bits[ii];
+        --unknownBits;
+    }
+
+    return bits[ii];
+} // lengthAt
+
+
+void
+CompoundQueue::subtract(std::size_t ii)
+{
+    totalSize -= sizes[ii];
+
+    if(bits[ii] == unknownLength)
+    {
+        --unknownBits;
+    }
+    else
+    {
+        totalBits -= bits[ii];
+    }
+} // subtract
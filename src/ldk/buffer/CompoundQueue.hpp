@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_LDK_BUFFER_COMPOUNDQUEUE_HPP
+#define WNS_LDK_BUFFER_COMPOUNDQUEUE_HPP
+
+#include <WNS/ldk/Compound.hpp>
+
+#include <vector>
+#include <cstddef>
+
+namespace wns { namespace ldk { namespace buffer {
+
+	/**
+	 * @brief FIFO storage of the buffers, a ring of compounds with
+	 * their sizes.
+	 *
+	 * The size (in the unit of the buffer's SizeCalculator) of each
+	 * compound is calculated once on insertion and kept next to the
+	 * compound. Its length in bits is taken from the insertion as well
+	 * if the caller knows it, otherwise it is calculated when first
+	 * needed. Removing a compound does not calculate its size again,
+	 * the total sizes are available in O(1) once all lengths are known.
+	 * The ring grows by doubling its capacity and never shrinks.
+	 */
+	class CompoundQueue
+	{
+	public:
+		typedef std::vector<CompoundPtr> CompoundContainer;
+
+		/**
+		 * @brief Length of a compound that has not been calculated yet
+		 */
+		static const Bit unknownLength = -1;
+
+		explicit
+		CompoundQueue(std::size_t capacity = 16);
+
+		/**
+		 * @brief Append compound, size is its size as calculated by
+		 * the SizeCalculator of the buffer
+		 *
+		 * Pass length if the length of the compound in bits is known
+		 * already (e.g. it is the size), otherwise it is calculated
+		 * when first needed.
+		 */
+		void
+		push_back(const CompoundPtr& compound, unsigned long int size, Bit length = unknownLength);
+
+		CompoundPtr
+		pop_front();
+
+		CompoundPtr
+		pop_back();
+
+		/**
+		 * @brief Move the longest sequence of compounds from the front
+		 * into compounds that does not exceed bits in total
+		 *
+		 * @return the number of compounds moved
+		 */
+		std::size_t
+		pop_front(Bit bits, CompoundContainer& compounds);
+
+		const CompoundPtr&
+		front() const;
+
+		const CompoundPtr&
+		back() const;
+
+		/**
+		 * @brief Number of compounds at the front that fit into bits
+		 */
+		std::size_t
+		countFitting(Bit bits) const;
+
+		void
+		clear();
+
+		bool
+		empty() const
+		{
+			return count == 0;
+		}
+
+		/**
+		 * @brief Number of compounds
+		 */
+		std::size_t
+		size() const
+		{
+			return count;
+		}
+
+		std::size_t
+		capacity() const
+		{
+			return compounds.size();
+		}
+
+		/**
+		 * @brief Sum of the sizes given to push_back
+		 */
+		unsigned long int
+		getSize() const
+		{
+			return totalSize;
+		}
+
+		Bit
+		getSizeInBits() const;
+
+		Bit
+		getSizeInBytes() const
+		{
+			return (getSizeInBits() + 7) / 8;
+		}
+
+	private:
+		std::size_t
+		index(std::size_t n) const
+		{
+			// capacity is always a power of two
+			return (head + n) & (compounds.size() - 1);
+		}
+
+		void
+		grow();
+
+		/**
+		 * @brief Length of the compound in slot ii, calculated if
+		 * unknown
+		 */
+		Bit
+		lengthAt(std::size_t ii) const;
+
+		/**
+		 * @brief Remove the sizes of the compound in slot ii from the
+		 * totals
+		 */
+		void
+		subtract(std::size_t ii);
+
+		std::vector<CompoundPtr> compounds;
+		std::vector<unsigned long int> sizes;
+		mutable std::vector<Bit> bits;
+
+		std::size_t head;
+		std::size_t count;
+
+		unsigned long int totalSize;
+		/** @brief Sum of the lengths known */
+		mutable Bit totalBits;
+		/** @brief Number of compounds with unknown length */
+		mutable std::size_t unknownBits;
+	};
+
+}}}
+
+
+#endif // NOT defined WNS_LDK_BUFFER_COMPOUNDQUEUE_HPP
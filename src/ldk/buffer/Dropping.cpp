@@ -54,9 +54,7 @@ using namespace wns::ldk::buffer::dropping::drop;
 CompoundPtr
 Tail::operator()(ContainerType& container) const
 {
-    CompoundPtr it = container.back();
-    container.pop_back();
-    return it;
+    return container.pop_back();
 } // Tail()
 STATIC_FACTORY_REGISTER(Tail, Drop, "Tail");
 
@@ -64,9 +62,7 @@ STATIC_FACTORY_REGISTER(Tail, Drop, "Tail");
 CompoundPtr
 Front::operator()(ContainerType& container) const
 {
-    CompoundPtr it = container.front();
-    container.pop_front();
-    return it;
+    return container.pop_front();
 } // Front()
 STATIC_FACTORY_REGISTER(Front, Drop, "Front");
 
@@ -83,7 +79,6 @@ Dropping::Dropping(fun::FUN* fuNet, const wns::pyconfig::View& config) :
 
         buffer(ContainerType()),
         maxSize(config.get<int>("size")),
-        currentSize(0),
         sizeCalculator(),
         dropper(),
         totalPDUs(),
@@ -117,7 +112,6 @@ Dropping::Dropping(const Dropping& other) :
     Delayed<Dropping>(other),
     buffer(other.buffer),
     maxSize(other.maxSize),
-    currentSize(other.currentSize),
     sizeCalculator(wns::clone(other.sizeCalculator)),
     dropper(wns::clone(other.dropper)),
     totalPDUs(other.totalPDUs),
@@ -148,24 +142,31 @@ Dropping::hasCapacity() const
 } // hasCapacity
 
 
+std::size_t
+Dropping::doIsAcceptingBurst(const CompoundSpan& compounds) const
+{
+    return compounds.size();
+} // doIsAcceptingBurst
+
+
 void
 Dropping::processOutgoing(const CompoundPtr& compound)
 {
-    buffer.push_back(compound);
-    currentSize += (*sizeCalculator)(compound);
+    unsigned long int size = (*sizeCalculator)(compound);
+    buffer.push_back(compound, size, sizeCalculator->countsBits() ? Bit(size) : CompoundQueue::unknownLength);
 
-    while(currentSize > maxSize)
+    while(buffer.getSize() > maxSize)
     {
 
         MESSAGE_BEGIN(NORMAL, logger, m, getFUN()->getName());
         m << " dropping a PDU! maxSize reached : " << maxSize;
-        m << " current size is " << currentSize;
+        m << " current size is " << buffer.getSize();
         MESSAGE_END();
 
+        // the queue knows the size of the dropped compound
+        unsigned long int sizeBefore = buffer.getSize();
         CompoundPtr toDrop = (*dropper)(buffer);
-        int pduSize = (*sizeCalculator)(toDrop);
-        currentSize -= pduSize;
-        increaseDroppedPDUs(pduSize);
+        increaseDroppedPDUs(sizeBefore - buffer.getSize());
     }
 
     increaseTotalPDUs();
@@ -186,16 +187,23 @@ Dropping::hasSomethingToSend() const
 CompoundPtr
 Dropping::getSomethingToSend()
 {
-    CompoundPtr compound = buffer.front();
-    buffer.pop_front();
-
-    currentSize -= (*sizeCalculator)(compound);
+    CompoundPtr compound = buffer.pop_front();
     probe();
 
     return compound;
 } // getSomethingToSend
 
 
+std::size_t
+Dropping::getSomethingToSend(Bit bits, CompoundContainer& compounds)
+{
+    std::size_t n = buffer.pop_front(bits, compounds);
+    probe();
+
+    return n;
+} // getSomethingToSend
+
+
 //
 // Buffer interface
 //
@@ -203,7 +211,7 @@ Dropping::getSomethingToSend()
 unsigned long int
 Dropping::getSize()
 {
-    return currentSize;
+    return buffer.getSize();
 } // getSize
 
 
@@ -214,3 +222,17 @@ Dropping::getMaxSize()
 } // getMaxSize
 
 
+unsigned long int
+Dropping::getNumberOfCompounds()
+{
+    return buffer.size();
+} // getNumberOfCompounds
+
+
+Bit
+Dropping::getSizeInBits()
+{
+    return buffer.getSizeInBits();
+} // getSizeInBits
+
+
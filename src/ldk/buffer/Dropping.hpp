@@ -29,6 +29,7 @@
 #define WNS_LDK_BUFFER_DROPPING_HPP
 
 #include <WNS/ldk/buffer/Buffer.hpp>
+#include <WNS/ldk/buffer/CompoundQueue.hpp>
 
 #include <WNS/ldk/fu/Plain.hpp>
 #include <WNS/ldk/Delayed.hpp>
@@ -38,7 +39,6 @@
 
 #include <WNS/logger/Logger.hpp>
 
-#include <list>
 #include <memory>
 
 namespace wns { namespace ldk { namespace buffer {
@@ -49,7 +49,7 @@ namespace wns { namespace ldk { namespace buffer {
 	 */
 	namespace dropping
 	{
-		typedef std::list<CompoundPtr> ContainerType;
+		typedef CompoundQueue ContainerType;
 
 		/**
 		 * @brief Interface for packet dropping strategies.
@@ -160,18 +160,35 @@ namespace wns { namespace ldk { namespace buffer {
 		//
 		// Buffer interface
 		//
+		virtual std::size_t
+		getSomethingToSend(Bit bits, CompoundContainer& compounds);
+
 		virtual unsigned long int
 		getSize();
 
 		virtual unsigned long int
 		getMaxSize();
 
+		virtual unsigned long int
+		getNumberOfCompounds();
+
+		virtual Bit
+		getSizeInBits();
+
+		//
+		// CompoundHandlerInterface
+		//
+		/**
+		 * @brief Always accepts the complete burst, see hasCapacity
+		 */
+		virtual std::size_t
+		doIsAcceptingBurst(const CompoundSpan& compounds) const;
+
 	protected:
 		dropping::ContainerType buffer;
 
 	private:
 		unsigned long int maxSize;
-		unsigned long int currentSize;
 
 		std::auto_ptr<SizeCalculator> sizeCalculator;
 		std::auto_ptr<dropping::Drop> dropper;
@@ -113,6 +113,60 @@ BoundedTest::testWakeup()
 } // testProxy
 
 
+void
+BoundedTest::testBurst()
+{
+    std::vector<CompoundPtr> compounds;
+    for (int i = 0; i < 3; ++i)
+    {
+        compounds.push_back(fuNet->createCompound());
+    }
+    CompoundSpan burst(compounds);
+
+    lower->close();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), buffer->isAcceptingBurst(burst));
+
+    buffer->sendDataBurst(burst.head(2));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), buffer->isAcceptingBurst(burst.tail(2)));
+    CPPUNIT_ASSERT(lower->sent.empty());
+
+    lower->open();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), lower->sent.size());
+    CPPUNIT_ASSERT(lower->sent[0] == compounds[0]);
+    CPPUNIT_ASSERT(lower->sent[1] == compounds[1]);
+
+    buffer->sendDataBurst(burst.tail(2));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), lower->sent.size());
+    CPPUNIT_ASSERT(lower->sent[2] == compounds[2]);
+} // testBurst
+
+
+void
+BoundedTest::testSizes()
+{
+    lower->close();
+
+    CPPUNIT_ASSERT_EQUAL(0UL, buffer->getNumberOfCompounds());
+    CPPUNIT_ASSERT_EQUAL(Bit(0), buffer->getSizeInBits());
+
+    upper->sendData(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(5))));
+    upper->sendData(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(8))));
+
+    // the size is counted in PDUs, the length in bits nevertheless
+    CPPUNIT_ASSERT_EQUAL(2UL, buffer->getSize());
+    CPPUNIT_ASSERT_EQUAL(2UL, buffer->getNumberOfCompounds());
+    CPPUNIT_ASSERT_EQUAL(Bit(13), buffer->getSizeInBits());
+
+    lower->step();
+    CPPUNIT_ASSERT_EQUAL(1UL, buffer->getNumberOfCompounds());
+    CPPUNIT_ASSERT_EQUAL(Bit(8), buffer->getSizeInBits());
+
+    lower->open();
+    CPPUNIT_ASSERT_EQUAL(0UL, buffer->getNumberOfCompounds());
+    CPPUNIT_ASSERT_EQUAL(Bit(0), buffer->getSizeInBits());
+} // testSizes
+
+
 
 CPPUNIT_TEST_SUITE_REGISTRATION( BoundedBitTest );
 
@@ -195,4 +249,62 @@ BoundedBitTest::testEmpty()
 } // testEmpty
 
 
+void
+BoundedBitTest::testBurst()
+{
+    std::vector<CompoundPtr> compounds;
+    compounds.push_back(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(1))));
+    compounds.push_back(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(2))));
+    compounds.push_back(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(18))));
+    compounds.push_back(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(1))));
+    CompoundSpan burst(compounds);
+
+    lower->close();
+
+    // 1 + 2 + 18 exceeds the 20 bits, acceptance stops at the first
+    // compound that does not fit
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), buffer->isAcceptingBurst(burst));
+
+    buffer->sendDataBurst(burst.head(2));
+    CPPUNIT_ASSERT_EQUAL(3UL, buffer->getSize());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), buffer->isAcceptingBurst(burst.tail(2)));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), buffer->isAcceptingBurst(burst.tail(3)));
+} // testBurst
 
+
+void
+BoundedBitTest::testBulkDequeue()
+{
+    CompoundPtr compound1(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(4))));
+    CompoundPtr compound2(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(6))));
+    CompoundPtr compound3(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(8))));
+
+    lower->close();
+    upper->sendData(compound1);
+    upper->sendData(compound2);
+    upper->sendData(compound3);
+    CPPUNIT_ASSERT_EQUAL(3UL, buffer->getNumberOfCompounds());
+    CPPUNIT_ASSERT_EQUAL(Bit(18), buffer->getSizeInBits());
+    CPPUNIT_ASSERT(!buffer->isAccepting(compound2));
+
+    // through the Buffer interface
+    Buffer* base = buffer;
+    Buffer::CompoundContainer compounds;
+
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), base->getSomethingToSend(3, compounds));
+    CPPUNIT_ASSERT(compounds.empty());
+
+    // 4 + 6 fit, 4 + 6 + 8 don't
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), base->getSomethingToSend(17, compounds));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), compounds.size());
+    CPPUNIT_ASSERT(compounds[0] == compound1);
+    CPPUNIT_ASSERT(compounds[1] == compound2);
+    CPPUNIT_ASSERT_EQUAL(1UL, base->getNumberOfCompounds());
+    CPPUNIT_ASSERT_EQUAL(Bit(8), base->getSizeInBits());
+    CPPUNIT_ASSERT_EQUAL(8UL, base->getSize());
+    CPPUNIT_ASSERT(buffer->isAccepting(compound2));
+
+    lower->open();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), lower->sent.size());
+    CPPUNIT_ASSERT(lower->sent[0] == compound3);
+} // testBulkDequeue
@@ -43,6 +43,8 @@ namespace wns { namespace ldk { namespace buffer {
         CPPUNIT_TEST_SUITE( BoundedTest );
         CPPUNIT_TEST( testFill );
         CPPUNIT_TEST( testWakeup );
+        CPPUNIT_TEST( testBurst );
+        CPPUNIT_TEST( testSizes );
         CPPUNIT_TEST_SUITE_END();
 
     public:
@@ -51,6 +53,8 @@ namespace wns { namespace ldk { namespace buffer {
 
         void testFill();
         void testWakeup();
+        void testBurst();
+        void testSizes();
     private:
         ILayer* layer;
         fun::FUN* fuNet;
@@ -65,6 +69,8 @@ namespace wns { namespace ldk { namespace buffer {
         CPPUNIT_TEST_SUITE( BoundedBitTest );
         CPPUNIT_TEST( testFill );
         CPPUNIT_TEST( testEmpty );
+        CPPUNIT_TEST( testBurst );
+        CPPUNIT_TEST( testBulkDequeue );
         CPPUNIT_TEST_SUITE_END();
 
     public:
@@ -73,6 +79,8 @@ namespace wns { namespace ldk { namespace buffer {
 
         void testFill();
         void testEmpty();
+        void testBurst();
+        void testBulkDequeue();
     private:
         ILayer* layer;
         fun::FUN* fuNet;
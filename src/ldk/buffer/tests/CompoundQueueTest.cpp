@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/buffer/CompoundQueue.hpp>
+#include <WNS/ldk/fun/Main.hpp>
+#include <WNS/ldk/tests/LayerStub.hpp>
+#include <WNS/ldk/helper/FakePDU.hpp>
+
+#include <WNS/TestFixture.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace wns { namespace ldk { namespace buffer { namespace tests {
+
+	class CompoundQueueTest :
+		public wns::TestFixture
+	{
+		CPPUNIT_TEST_SUITE( CompoundQueueTest );
+		CPPUNIT_TEST( fifo );
+		CPPUNIT_TEST( sizes );
+		CPPUNIT_TEST( wrapAround );
+		CPPUNIT_TEST( grow );
+		CPPUNIT_TEST( popBack );
+		CPPUNIT_TEST( popBits );
+		CPPUNIT_TEST( knownLength );
+		CPPUNIT_TEST_SUITE_END();
+
+	public:
+		void
+		prepare();
+
+		void
+		cleanup();
+
+		void
+		fifo();
+
+		void
+		sizes();
+
+		void
+		wrapAround();
+
+		void
+		grow();
+
+		void
+		popBack();
+
+		void
+		popBits();
+
+		void
+		knownLength();
+
+	private:
+		CompoundPtr
+		newCompound(Bit bits);
+
+		ILayer* layer;
+		fun::FUN* fuNet;
+	};
+
+	CPPUNIT_TEST_SUITE_REGISTRATION( CompoundQueueTest );
+
+	void
+	CompoundQueueTest::prepare()
+	{
+		layer = new wns::ldk::tests::LayerStub();
+		fuNet = new fun::Main(layer);
+	} // prepare
+
+	void
+	CompoundQueueTest::cleanup()
+	{
+		delete fuNet;
+		delete layer;
+	} // cleanup
+
+	CompoundPtr
+	CompoundQueueTest::newCompound(Bit bits)
+	{
+		return CompoundPtr(new Compound(fuNet->createCommandPool(),
+						helper::FakePDUPtr(new helper::FakePDU(bits))));
+	} // newCompound
+
+	void
+	CompoundQueueTest::fifo()
+	{
+		CompoundQueue queue;
+		CompoundPtr c1 = newCompound(1);
+		CompoundPtr c2 = newCompound(2);
+		CompoundPtr c3 = newCompound(3);
+
+		CPPUNIT_ASSERT(queue.empty());
+
+		queue.push_back(c1, 1);
+		queue.push_back(c2, 1);
+		queue.push_back(c3, 1);
+
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(3), queue.size());
+		CPPUNIT_ASSERT(queue.front() == c1);
+		CPPUNIT_ASSERT(queue.back() == c3);
+
+		CPPUNIT_ASSERT(queue.pop_front() == c1);
+		CPPUNIT_ASSERT(queue.pop_front() == c2);
+		CPPUNIT_ASSERT(queue.pop_front() == c3);
+		CPPUNIT_ASSERT(queue.empty());
+	} // fifo
+
+	void
+	CompoundQueueTest::sizes()
+	{
+		CompoundQueue queue;
+
+		queue.push_back(newCompound(10), 1);
+		queue.push_back(newCompound(20), 1);
+		queue.push_back(newCompound(7), 1);
+
+		CPPUNIT_ASSERT_EQUAL(3UL, queue.getSize());
+		CPPUNIT_ASSERT_EQUAL(Bit(37), queue.getSizeInBits());
+		CPPUNIT_ASSERT_EQUAL(Bit(5), queue.getSizeInBytes());
+
+		queue.pop_front();
+		CPPUNIT_ASSERT_EQUAL(2UL, queue.getSize());
+		CPPUNIT_ASSERT_EQUAL(Bit(27), queue.getSizeInBits());
+
+		queue.clear();
+		CPPUNIT_ASSERT(queue.empty());
+		CPPUNIT_ASSERT_EQUAL(0UL, queue.getSize());
+		CPPUNIT_ASSERT_EQUAL(Bit(0), queue.getSizeInBits());
+	} // sizes
+
+	void
+	CompoundQueueTest::wrapAround()
+	{
+		CompoundQueue queue(4);
+		std::vector<CompoundPtr> compounds;
+
+		for (int ii = 0; ii < 12; ++ii)
+		{
+			compounds.push_back(newCompound(ii));
+		}
+
+		// keep two or three compounds queued, the head runs around the ring
+		queue.push_back(compounds[0], 0);
+		queue.push_back(compounds[1], 1);
+		for (int ii = 2; ii < 12; ++ii)
+		{
+			queue.push_back(compounds[ii], ii);
+			CPPUNIT_ASSERT(queue.pop_front() == compounds[ii - 2]);
+		}
+
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(4), queue.capacity());
+		CPPUNIT_ASSERT_EQUAL(21UL, queue.getSize());
+		CPPUNIT_ASSERT_EQUAL(Bit(21), queue.getSizeInBits());
+		CPPUNIT_ASSERT(queue.pop_front() == compounds[10]);
+		CPPUNIT_ASSERT(queue.pop_front() == compounds[11]);
+	} // wrapAround
+
+	void
+	CompoundQueueTest::grow()
+	{
+		CompoundQueue queue(2);
+		std::vector<CompoundPtr> compounds;
+
+		for (int ii = 0; ii < 5; ++ii)
+		{
+			compounds.push_back(newCompound(1));
+		}
+
+		// wrap before growing
+		queue.push_back(compounds[0], 1);
+		queue.pop_front();
+
+		for (int ii = 0; ii < 5; ++ii)
+		{
+			queue.push_back(compounds[ii], 1);
+		}
+
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(8), queue.capacity());
+		CPPUNIT_ASSERT_EQUAL(5UL, queue.getSize());
+
+		for (int ii = 0; ii < 5; ++ii)
+		{
+			CPPUNIT_ASSERT(queue.pop_front() == compounds[ii]);
+		}
+	} // grow
+
+	void
+	CompoundQueueTest::popBack()
+	{
+		CompoundQueue queue(2);
+		CompoundPtr c1 = newCompound(1);
+		CompoundPtr c2 = newCompound(2);
+		CompoundPtr c3 = newCompound(3);
+
+		queue.push_back(c1, 1);
+		queue.push_back(c2, 2);
+		queue.pop_front();
+		queue.push_back(c3, 3);
+
+		CPPUNIT_ASSERT(queue.pop_back() == c3);
+		CPPUNIT_ASSERT_EQUAL(2UL, queue.getSize());
+		CPPUNIT_ASSERT(queue.pop_back() == c2);
+		CPPUNIT_ASSERT(queue.empty());
+	} // popBack
+
+	void
+	CompoundQueueTest::popBits()
+	{
+		CompoundQueue queue;
+		CompoundQueue::CompoundContainer compounds;
+
+		queue.push_back(newCompound(10), 1);
+		queue.push_back(newCompound(10), 1);
+		queue.push_back(newCompound(10), 1);
+
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(0), queue.countFitting(9));
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(2), queue.countFitting(29));
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(3), queue.countFitting(100));
+
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(0), queue.pop_front(9, compounds));
+		CPPUNIT_ASSERT(compounds.empty());
+
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(2), queue.pop_front(20, compounds));
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(2), compounds.size());
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(1), queue.size());
+		CPPUNIT_ASSERT_EQUAL(Bit(10), queue.getSizeInBits());
+	} // popBits
+
+	void
+	CompoundQueueTest::knownLength()
+	{
+		CompoundQueue queue;
+		CompoundQueue::CompoundContainer compounds;
+
+		// a length given on insertion is taken as is
+		queue.push_back(newCompound(100), 1, 10);
+		queue.push_back(newCompound(20), 1);
+		queue.push_back(newCompound(30), 1, CompoundQueue::unknownLength);
+		CPPUNIT_ASSERT_EQUAL(Bit(60), queue.getSizeInBits());
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(2), queue.countFitting(59));
+
+		// compounds whose length has never been needed
+		queue.push_back(newCompound(5), 1);
+		queue.push_back(newCompound(7), 1);
+		CPPUNIT_ASSERT(queue.pop_back() != CompoundPtr());
+		CPPUNIT_ASSERT_EQUAL(Bit(65), queue.getSizeInBits());
+		CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(2), queue.pop_front(30, compounds));
+		CPPUNIT_ASSERT_EQUAL(Bit(35), queue.getSizeInBits());
+
+		queue.push_back(newCompound(1), 1);
+		queue.clear();
+		CPPUNIT_ASSERT_EQUAL(Bit(0), queue.getSizeInBits());
+		queue.push_back(newCompound(3), 1);
+		CPPUNIT_ASSERT_EQUAL(Bit(3), queue.getSizeInBits());
+	} // knownLength
+
+}}}}
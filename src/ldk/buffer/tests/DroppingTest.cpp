@@ -32,6 +32,7 @@
 #include <WNS/ldk/tests/LayerStub.hpp>
 
 #include <WNS/pyconfig/Parser.hpp>
+#include <WNS/simulator/ISimulator.hpp>
 
 #include <cppunit/extensions/HelperMacros.h>
 
@@ -45,6 +46,9 @@ namespace wns { namespace ldk { namespace buffer { namespace tests {
         CPPUNIT_TEST( PDUDropFront );
         CPPUNIT_TEST( bitDropTail );
         CPPUNIT_TEST( bitDropFront );
+        CPPUNIT_TEST( sizes );
+        CPPUNIT_TEST( bulkDequeue );
+        CPPUNIT_TEST( droppedSize );
         CPPUNIT_TEST_SUITE_END();
 
     public:
@@ -60,6 +64,15 @@ namespace wns { namespace ldk { namespace buffer { namespace tests {
         void
         bitDropFront();
 
+        void
+        sizes();
+
+        void
+        bulkDequeue();
+
+        void
+        droppedSize();
+
     private:
         virtual Dropping*
         newTestee();
@@ -324,6 +337,173 @@ namespace wns { namespace ldk { namespace buffer { namespace tests {
         delete lower;
     } // bitDropFront
 
+
+    void
+    DroppingTest::sizes()
+    {
+        pyconfig::Parser emptyConfig;
+        tools::Stub* lower = new tools::Stub(getFUN(), emptyConfig);
+        tools::Stub* upper = new tools::Stub(getFUN(), emptyConfig);
+
+        pyconfig::Parser all;
+        all.loadString(
+                       "from openwns.Buffer import *\n"
+                       "foo = Dropping(\n"
+                       "  size = 5,\n"
+                       "  sizeUnit = 'PDU',\n"
+                       "  drop = 'Tail'\n"
+                       ")\n"
+                       );
+        wns::pyconfig::View config(all, "foo");
+
+        Dropping* buffer = new Dropping(getFUN(), config);
+        upper
+            ->connect(buffer)
+            ->connect(lower);
+
+        lower->close();
+
+        CPPUNIT_ASSERT_EQUAL(0UL, buffer->getNumberOfCompounds());
+        CPPUNIT_ASSERT_EQUAL(Bit(0), buffer->getSizeInBits());
+
+        upper->sendData(getFUN()->createCompound(helper::FakePDUPtr(new helper::FakePDU(3))));
+        upper->sendData(getFUN()->createCompound(helper::FakePDUPtr(new helper::FakePDU(7))));
+
+        // the size is counted in PDUs, the length in bits nevertheless
+        CPPUNIT_ASSERT_EQUAL(2UL, buffer->getSize());
+        CPPUNIT_ASSERT_EQUAL(2UL, buffer->getNumberOfCompounds());
+        CPPUNIT_ASSERT_EQUAL(Bit(10), buffer->getSizeInBits());
+
+        lower->step();
+        CPPUNIT_ASSERT_EQUAL(1UL, buffer->getNumberOfCompounds());
+        CPPUNIT_ASSERT_EQUAL(Bit(7), buffer->getSizeInBits());
+
+        lower->open();
+        CPPUNIT_ASSERT_EQUAL(0UL, buffer->getNumberOfCompounds());
+        CPPUNIT_ASSERT_EQUAL(Bit(0), buffer->getSizeInBits());
+
+        delete upper;
+        delete buffer;
+        delete lower;
+    } // sizes
+
+
+    void
+    DroppingTest::bulkDequeue()
+    {
+        pyconfig::Parser emptyConfig;
+        tools::Stub* lower = new tools::Stub(getFUN(), emptyConfig);
+        tools::Stub* upper = new tools::Stub(getFUN(), emptyConfig);
+
+        pyconfig::Parser all;
+        all.loadString(
+                       "from openwns.Buffer import *\n"
+                       "foo = Dropping(\n"
+                       "  size = 100,\n"
+                       "  sizeUnit = 'Bit',\n"
+                       "  drop = 'Tail'\n"
+                       ")\n"
+                       );
+        wns::pyconfig::View config(all, "foo");
+
+        Dropping* dropping = new Dropping(getFUN(), config);
+        upper
+            ->connect(dropping)
+            ->connect(lower);
+
+        CompoundPtr compound1(getFUN()->createCompound(helper::FakePDUPtr(new helper::FakePDU(10))));
+        CompoundPtr compound2(getFUN()->createCompound(helper::FakePDUPtr(new helper::FakePDU(20))));
+        CompoundPtr compound3(getFUN()->createCompound(helper::FakePDUPtr(new helper::FakePDU(30))));
+
+        lower->close();
+        upper->sendData(compound1);
+        upper->sendData(compound2);
+        upper->sendData(compound3);
+
+        // through the Buffer interface
+        Buffer* buffer = dropping;
+        Buffer::CompoundContainer compounds;
+
+        CPPUNIT_ASSERT_EQUAL(std::size_t(0), buffer->getSomethingToSend(9, compounds));
+        CPPUNIT_ASSERT(compounds.empty());
+
+        // 10 + 20 fit, 10 + 20 + 30 don't
+        CPPUNIT_ASSERT_EQUAL(std::size_t(2), buffer->getSomethingToSend(59, compounds));
+        CPPUNIT_ASSERT_EQUAL(std::size_t(2), compounds.size());
+        CPPUNIT_ASSERT(compounds[0] == compound1);
+        CPPUNIT_ASSERT(compounds[1] == compound2);
+        CPPUNIT_ASSERT_EQUAL(1UL, buffer->getNumberOfCompounds());
+        CPPUNIT_ASSERT_EQUAL(Bit(30), buffer->getSizeInBits());
+        CPPUNIT_ASSERT_EQUAL(30UL, buffer->getSize());
+
+        // appended to what is there already
+        CPPUNIT_ASSERT_EQUAL(std::size_t(1), buffer->getSomethingToSend(30, compounds));
+        CPPUNIT_ASSERT_EQUAL(std::size_t(3), compounds.size());
+        CPPUNIT_ASSERT(compounds[2] == compound3);
+        CPPUNIT_ASSERT_EQUAL(0UL, buffer->getNumberOfCompounds());
+        CPPUNIT_ASSERT_EQUAL(Bit(0), buffer->getSizeInBits());
+
+        lower->open();
+        CPPUNIT_ASSERT(lower->sent.empty());
+
+        delete upper;
+        delete dropping;
+        delete lower;
+    } // bulkDequeue
+
+
+    void
+    DroppingTest::droppedSize()
+    {
+        wns::events::scheduler::Interface* scheduler = wns::simulator::getEventScheduler();
+        scheduler->reset();
+
+        pyconfig::Parser emptyConfig;
+        tools::Stub* lower = new tools::Stub(getFUN(), emptyConfig);
+        tools::Stub* upper = new tools::Stub(getFUN(), emptyConfig);
+
+        pyconfig::Parser all;
+        all.loadString(
+                       "from openwns.Buffer import *\n"
+                       "foo = Dropping(\n"
+                       "  size = 5,\n"
+                       "  sizeUnit = 'Bit',\n"
+                       "  drop = 'Tail'\n"
+                       ")\n"
+                       );
+        wns::pyconfig::View config(all, "foo");
+
+        Dropping* buffer = new Dropping(getFUN(), config);
+        upper
+            ->connect(buffer)
+            ->connect(lower);
+
+        lower->close();
+        upper->sendData(getFUN()->createCompound(helper::FakePDUPtr(new helper::FakePDU(2))));
+        upper->sendData(getFUN()->createCompound(helper::FakePDUPtr(new helper::FakePDU(2))));
+        CPPUNIT_ASSERT_EQUAL(0UL, buffer->getDroppedPDUs());
+
+        // 2 + 2 + 6 exceed 5 bits, the 6 bits are dropped
+        upper->sendData(getFUN()->createCompound(helper::FakePDUPtr(new helper::FakePDU(6))));
+        CPPUNIT_ASSERT_EQUAL(1UL, buffer->getDroppedPDUs());
+        CPPUNIT_ASSERT_EQUAL(4UL, buffer->getSize());
+        CPPUNIT_ASSERT_EQUAL(Bit(4), buffer->getSizeInBits());
+
+        // samples of the current time are not part of the window yet,
+        // the first periodic probe fires at once, the second one lets
+        // time pass
+        CPPUNIT_ASSERT(scheduler->processOneEvent());
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, buffer->getDroppedSizeInWindow(), 1e-9);
+        CPPUNIT_ASSERT(scheduler->processOneEvent());
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(6.0, buffer->getDroppedSizeInWindow(), 1e-9);
+
+        delete upper;
+        delete buffer;
+        delete lower;
+
+        scheduler->reset();
+    } // droppedSize
+
 }
 }
 }
@@ -207,7 +207,7 @@ void
 Concatenation::calculateSizes(const CommandPool* commandPool, Bit& commandPoolSize, Bit& sduSize) const
 {
     // Get the entries of the container
-    ConcatenationCommand* command = getCommand(commandPool);
+    const ConcatenationCommand* command = peekCommand(commandPool);
 
     if(command->peer.compounds.size() > 1)
     {
@@ -220,7 +220,7 @@ Concatenation::calculateSizes(const CommandPool* commandPool, Bit& commandPoolSi
         // control bits for concatenation itself
         commandPoolSize += this->numBitsIfConcatenated;
 
-        for(std::vector<CompoundPtr>::iterator it = command->peer.compounds.begin();
+        for(std::vector<CompoundPtr>::const_iterator it = command->peer.compounds.begin();
             it != command->peer.compounds.end();
             ++it)
         {
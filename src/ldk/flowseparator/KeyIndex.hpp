@@ -0,0 +1,334 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_LDK_FLOWSEPARATOR_KEYINDEX_HPP
+#define WNS_LDK_FLOWSEPARATOR_KEYINDEX_HPP
+
+#include <WNS/ldk/Key.hpp>
+#include <WNS/Assure.hpp>
+
+#include <map>
+#include <vector>
+
+namespace wns { namespace ldk { namespace flowseparator {
+
+    /**
+     * @brief Orders Keys given by address
+     */
+    struct KeyLess
+    {
+        bool
+        operator()(const Key* a, const Key* b) const
+        {
+            return *a < *b;
+        }
+    };
+
+    /**
+     * @brief Instance registry of a FlowSeparator
+     *
+     * All entries are kept ordered by Key (this is the order of
+     * iteration). Keys with a hash (see Key::setHash) are additionally
+     * indexed by their hash, so finding them does not depend on the
+     * number of flows. Keys without a hash are searched in the ordered
+     * container. The entry found last is remembered, since consecutive
+     * compounds often belong to the same flow.
+     *
+     * Lookups take a plain Key reference, so a Key filled in place (see
+     * KeyBuilder::peekKey) can be used without wrapping it in a
+     * SmartPtr.
+     */
+    template <typename VALUE>
+    class KeyIndex
+    {
+    public:
+        struct Entry
+        {
+            Entry(const ConstKeyPtr& _key, const VALUE& _value) :
+                key(_key),
+                value(_value)
+            {}
+
+            ConstKeyPtr key;
+            VALUE value;
+        };
+
+        typedef std::map<const Key*, Entry, KeyLess> Container;
+        typedef typename Container::iterator iterator;
+        typedef typename Container::const_iterator const_iterator;
+
+        KeyIndex() :
+            entries(),
+            buckets(minBuckets),
+            hashed(0),
+            lastHit(NULL)
+        {}
+
+        KeyIndex(const KeyIndex& other) :
+            entries(),
+            buckets(minBuckets),
+            hashed(0),
+            lastHit(NULL)
+        {
+            for (const_iterator it = other.begin(); it != other.end(); ++it)
+            {
+                insert(it->second.key, it->second.value);
+            }
+        }
+
+        KeyIndex&
+        operator=(const KeyIndex& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                for (const_iterator it = other.begin(); it != other.end(); ++it)
+                {
+                    insert(it->second.key, it->second.value);
+                }
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Value registered for key, NULL if unknown
+         */
+        VALUE*
+        find(const Key& key)
+        {
+            Entry* entry = findEntry(key);
+            return entry == NULL ? NULL : &entry->value;
+        }
+
+        const VALUE*
+        find(const Key& key) const
+        {
+            const Entry* entry = const_cast<KeyIndex*>(this)->findEntry(key);
+            return entry == NULL ? NULL : &entry->value;
+        }
+
+        bool
+        knows(const Key& key) const
+        {
+            return find(key) != NULL;
+        }
+
+        /**
+         * @brief Register value for key, the key must be unknown
+         */
+        void
+        insert(const ConstKeyPtr& key, const VALUE& value)
+        {
+            assure(key, "Invalid key");
+
+            std::pair<iterator, bool> result = entries.insert(
+                typename Container::value_type(key.getPtr(), Entry(key, value)));
+            assure(result.second, "Key " << key->str() << " already known");
+
+            if (key->hasHash())
+            {
+                if (hashed >= buckets.size())
+                {
+                    rehash(2 * buckets.size());
+                }
+                bucketOf(key->getHash()).push_back(result.first);
+                ++hashed;
+            }
+        }
+
+        /**
+         * @brief Remove key, returns false if unknown
+         */
+        bool
+        erase(const Key& key)
+        {
+            iterator it = entries.find(&key);
+            if (it == entries.end())
+            {
+                return false;
+            }
+
+            if (it->first->hasHash())
+            {
+                Bucket& bucket = bucketOf(it->first->getHash());
+                for (typename Bucket::iterator b = bucket.begin(); b != bucket.end(); ++b)
+                {
+                    if (*b == it)
+                    {
+                        bucket.erase(b);
+                        break;
+                    }
+                }
+                --hashed;
+            }
+
+            if (lastHit == &it->second)
+            {
+                lastHit = NULL;
+            }
+
+            entries.erase(it);
+            return true;
+        }
+
+        void
+        clear()
+        {
+            entries.clear();
+            buckets.assign(minBuckets, Bucket());
+            hashed = 0;
+            lastHit = NULL;
+        }
+
+        std::size_t
+        size() const
+        {
+            return entries.size();
+        }
+
+        bool
+        empty() const
+        {
+            return entries.empty();
+        }
+
+        iterator
+        begin()
+        {
+            return entries.begin();
+        }
+
+        iterator
+        end()
+        {
+            return entries.end();
+        }
+
+        const_iterator
+        begin() const
+        {
+            return entries.begin();
+        }
+
+        const_iterator
+        end() const
+        {
+            return entries.end();
+        }
+
+    private:
+        typedef std::vector<iterator> Bucket;
+
+        static const std::size_t minBuckets = 16;
+
+        Entry*
+        findEntry(const Key& key)
+        {
+            if (lastHit != NULL && matches(*lastHit->key, key))
+            {
+                return lastHit;
+            }
+
+            Entry* entry = NULL;
+
+            if (key.hasHash())
+            {
+                const Bucket& bucket = bucketOf(key.getHash());
+                for (typename Bucket::const_iterator b = bucket.begin(); b != bucket.end(); ++b)
+                {
+                    if (matches(*(*b)->first, key))
+                    {
+                        entry = &(*b)->second;
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                iterator it = entries.find(&key);
+                if (it != entries.end())
+                {
+                    entry = &it->second;
+                }
+            }
+
+            if (entry != NULL)
+            {
+                lastHit = entry;
+            }
+            return entry;
+        }
+
+        static bool
+        matches(const Key& known, const Key& key)
+        {
+            if (known.hasHash() != key.hasHash() ||
+                known.getHash() != key.getHash())
+            {
+                return false;
+            }
+            return known.equals(key);
+        }
+
+        Bucket&
+        bucketOf(std::size_t hash)
+        {
+            // the number of buckets is a power of two
+            return buckets[hash & (buckets.size() - 1)];
+        }
+
+        void
+        rehash(std::size_t numberOfBuckets)
+        {
+            std::vector<Bucket> old(numberOfBuckets);
+            old.swap(buckets);
+
+            for (typename std::vector<Bucket>::const_iterator bucket = old.begin();
+                 bucket != old.end();
+                 ++bucket)
+            {
+                for (typename Bucket::const_iterator b = bucket->begin(); b != bucket->end(); ++b)
+                {
+                    bucketOf((*b)->first->getHash()).push_back(*b);
+                }
+            }
+        }
+
+        Container entries;
+        std::vector<Bucket> buckets;
+        std::size_t hashed;
+        Entry* lastHit;
+    };
+
+    template <typename VALUE>
+    const std::size_t KeyIndex<VALUE>::minBuckets;
+
+} // flowseparator
+} // ldk
+} // wns
+
+#endif // NOT defined WNS_LDK_FLOWSEPARATOR_KEYINDEX_HPP
@@ -84,14 +84,25 @@ namespace wns { namespace ldk { namespace fsm {
      * used with different implementations of MyFUInterface.
      * Note also that the constructor of the state takes a pointer to
      * MyFUInterface::BaseFSM by convention.
+     *
+     * 6.) Optionally list the states in the interface, so that the FU
+     * keeps one object per state instead of allocating one per transition
+     * (see wns::fsm::FSM):
+     * @code
+     * class WaitingForACK;
+     * class ReadyForTransmission;
+     * typedef ldk::fsm::FunctionalUnit<
+     *     Variables,
+     *     boost::mpl::vector<WaitingForACK, ReadyForTransmission> > MyFUInterface;
+     * @endcode
      */
-    template <typename VARIABLES>
+    template <typename VARIABLES, typename STATES = boost::mpl::vector<> >
     class FunctionalUnit :
         virtual public ldk::FunctionalUnit,
-        public wns::fsm::FSM<wns::ldk::fsm::CompoundHandlerSignalInterface, VARIABLES>
+        public wns::fsm::FSM<wns::ldk::fsm::CompoundHandlerSignalInterface, VARIABLES, STATES>
     {
     public:
-        typedef wns::fsm::FSM<wns::ldk::fsm::CompoundHandlerSignalInterface, VARIABLES> BaseFSM;
+        typedef wns::fsm::FSM<wns::ldk::fsm::CompoundHandlerSignalInterface, VARIABLES, STATES> BaseFSM;
         class StateInterface :
             public BaseFSM::StateInterface
         {
@@ -116,6 +127,15 @@ namespace wns { namespace ldk { namespace fsm {
                 return fu;
             } // getFU
 
+            virtual typename BaseFSM::StateInterface*
+            doSendData(const CompoundPtr& compound) = 0;
+
+            virtual typename BaseFSM::StateInterface*
+            doOnData(const CompoundPtr& compound) = 0;
+
+            virtual typename BaseFSM::StateInterface*
+            doWakeup() = 0;
+
             /**
              * @brief initState is called when entering a new state
              */
@@ -270,7 +290,7 @@ namespace wns { namespace ldk { namespace fsm {
         doSendData(const CompoundPtr& compound)
         {
             ++inAction;
-            CompoundHandlerSignalInterface* stateInterface = this->getState()->doSendData(compound);
+            typename BaseFSM::StateInterface* stateInterface = getFUState()->doSendData(compound);
             --inAction;
             this->changeState(stateInterface);
 
@@ -284,7 +304,7 @@ namespace wns { namespace ldk { namespace fsm {
         doOnData(const CompoundPtr& compound)
         {
             ++inAction;
-            CompoundHandlerSignalInterface* stateInterface = this->getState()->doOnData(compound);
+            typename BaseFSM::StateInterface* stateInterface = getFUState()->doOnData(compound);
             --inAction;
             this->changeState(stateInterface);
 
@@ -301,7 +321,7 @@ namespace wns { namespace ldk { namespace fsm {
             do
             {
                 ++inAction;
-                CompoundHandlerSignalInterface* stateInterface = this->getState()->doWakeup();
+                typename BaseFSM::StateInterface* stateInterface = getFUState()->doWakeup();
                 --inAction;
                 this->changeState(stateInterface);
             }
@@ -318,6 +338,17 @@ namespace wns { namespace ldk { namespace fsm {
             return accepting;
         } // doIsAccepting
 
+        /**
+         * @brief The current state, which is always one of our
+         * StateInterface
+         */
+        StateInterface*
+        getFUState() const
+        {
+            assureType(this->getState(), StateInterface*);
+            return static_cast<StateInterface*>(this->getState());
+        } // getFUState
+
         typedef std::list<CompoundPtr> CompoundContainer;
 
     protected:
@@ -340,7 +371,7 @@ namespace wns { namespace ldk { namespace fsm {
 
             while (!onDataCompounds.empty())
             {
-                CompoundPtr onDataCompoundHelp = onDataCompounds.front();
+                CompoundPtr onDataCompoundHelp = wns::move(onDataCompounds.front());
                 onDataCompounds.pop_front();
 
                 getDeliverer()->getAcceptor(onDataCompoundHelp)->onData(onDataCompoundHelp);
@@ -55,11 +55,23 @@ namespace wns { namespace ldk { namespace fsm { namespace tests {
         {
         };
 
+    public:
+        class WaitingForACK;
+        class ReadyForTransmission;
+        class WaitingForACKReconfiguration;
+        class ReadyForTransmissionReconfiguration;
+
+    private:
         /**
-         * Handy typedef to Interface of FU with FSM support and
-         * respective Variables
+         * Handy typedef to Interface of FU with FSM support, respective
+         * Variables and the states it keeps
          */
-        typedef ldk::fsm::FunctionalUnit<Variables> MyFUInterface;
+        typedef ldk::fsm::FunctionalUnit<
+            Variables,
+            boost::mpl::vector<WaitingForACK,
+                               ReadyForTransmission,
+                               WaitingForACKReconfiguration,
+                               ReadyForTransmissionReconfiguration> > MyFUInterface;
 
     public:
         /**
@@ -203,6 +215,8 @@ namespace wns { namespace ldk { namespace fsm { namespace tests {
         CPPUNIT_TEST_SUITE( FunctionalUnitTest );
         CPPUNIT_TEST( simple );
         CPPUNIT_TEST( stateReplacement );
+        CPPUNIT_TEST( keptStates );
+        CPPUNIT_TEST( cloneKeepsOwnStates );
         CPPUNIT_TEST_SUITE_END();
 
         virtual void
@@ -221,6 +235,12 @@ namespace wns { namespace ldk { namespace fsm { namespace tests {
         void
         stateReplacement();
 
+        void
+        keptStates();
+
+        void
+        cloneKeepsOwnStates();
+
         pyconfig::Parser emptyConfig;
 
         ldk::ILayer* layer;
@@ -402,6 +422,43 @@ STATIC_FACTORY_REGISTER_WITH_CREATOR(FunctionalUnitTest::ReadyForTransmissionRec
         CPPUNIT_ASSERT( !upper->isAccepting(compound2) );
     }
 
+    void
+    FunctionalUnitTest::keptStates()
+    {
+        CompoundPtr compound1(fuNet->createCompound(wns::ldk::helper::FakePDUPtr(new wns::ldk::helper::FakePDU(2))));
+
+        MyStateInterface* waitingForACK = testee->createState<WaitingForACK>();
+        testee->replaceState(waitingForACK);
+
+        lower->onData(compound1);
+        CPPUNIT_ASSERT_EQUAL(std::string("wns_ldk_fsm_tests_ReadyForTransmission"), testee->getStateName());
+        upper->sendData(compound1);
+        CPPUNIT_ASSERT_EQUAL(std::string("wns_ldk_fsm_tests_WaitingForACK"), testee->getStateName());
+
+        // the FU hands out the same state object for every transition
+        CPPUNIT_ASSERT( waitingForACK == testee->createState<WaitingForACK>() );
+        testee->replaceState(waitingForACK);
+        CPPUNIT_ASSERT_EQUAL(std::string("wns_ldk_fsm_tests_WaitingForACK"), testee->getStateName());
+    }
+
+    void
+    FunctionalUnitTest::cloneKeepsOwnStates()
+    {
+        CompoundPtr compound1(fuNet->createCompound(wns::ldk::helper::FakePDUPtr(new wns::ldk::helper::FakePDU(2))));
+
+        upper->sendData(compound1);
+        CPPUNIT_ASSERT_EQUAL(std::string("wns_ldk_fsm_tests_WaitingForACK"), testee->getStateName());
+
+        Testee* clone = dynamic_cast<Testee*>(testee->clone());
+        CPPUNIT_ASSERT_EQUAL(std::string("wns_ldk_fsm_tests_WaitingForACK"), clone->getStateName());
+        delete clone;
+
+        // the states of the original are untouched by the clone
+        CPPUNIT_ASSERT_EQUAL(std::string("wns_ldk_fsm_tests_WaitingForACK"), testee->getStateName());
+        lower->onData(compound1);
+        CPPUNIT_ASSERT_EQUAL(std::string("wns_ldk_fsm_tests_ReadyForTransmission"), testee->getStateName());
+    }
+
 } // tests
 } // fsm
 } // ldk
@@ -99,6 +99,28 @@ Main::onFUNCreated(wns::logger::Logger* logger)
     }
 }
 
+void
+Main::freeze()
+{
+    for(FunctionalUnitMap::iterator it = fuMap.begin();
+        it != fuMap.end();
+        ++it)
+    {
+        it->second->freeze();
+    }
+} // freeze
+
+void
+Main::thaw()
+{
+    for(FunctionalUnitMap::iterator it = fuMap.begin();
+        it != fuMap.end();
+        ++it)
+    {
+        it->second->thaw();
+    }
+} // thaw
+
 Main::~Main()
 {
     for(FunctionalUnitMap::iterator it = fuMap.begin();
@@ -161,6 +183,9 @@ Main::removeFunctionalUnit(const std::string& name)
     this->getProxy()->removeFunctionalUnit(name);
 
     this->fuMap.erase(name);
+
+    // others may still point to the removed FU
+    this->thaw();
 } // removeFunctionalUnit
 
 
@@ -116,6 +116,21 @@ namespace wns { namespace ldk { namespace fun {
         //
         void onFUNCreated(wns::logger::Logger* logger = NULL);
 
+        /**
+         * @brief Resolve the single-successor links of all FUs to direct
+         * pointers (see FunctionalUnit::freeze)
+         *
+         * Optional, call once the FUN is complete (after onFUNCreated).
+         * Connecting or removing FUs thaws the affected FUs, call freeze
+         * again afterwards.
+         */
+        void freeze();
+
+        /**
+         * @brief Undo freeze for all FUs
+         */
+        void thaw();
+
     	virtual void onShutdown();
 
     private:
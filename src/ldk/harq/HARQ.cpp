@@ -286,7 +286,7 @@ HARQFU::getSomethingToSend()
 {
     if (!sendQueue_.empty())
     {
-        wns::ldk::CompoundPtr it = sendQueue_.front();
+        wns::ldk::CompoundPtr it = wns::move(sendQueue_.front());
         sendQueue_.pop_front();
 
         return it;
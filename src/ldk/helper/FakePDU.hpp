@@ -32,6 +32,7 @@
 
 #include <WNS/osi/PDU.hpp>
 #include <WNS/osi/PCI.hpp>
+#include <WNS/ldk/CommandProxy.hpp>
 
 namespace wns { namespace ldk { namespace helper {
 
@@ -49,6 +50,8 @@ namespace wns { namespace ldk { namespace helper {
         setLengthInBits(Bit _length)
         {
             length = _length;
+            // the size of Compounds carrying this PDU changes
+            wns::ldk::CommandProxy::invalidateSizes();
         } // setLengthInBits
 
         FakePDU*
@@ -42,7 +42,7 @@ OpcodeDeliverer::setOpcodeProvider(FunctionalUnit* opcodeProvider)
 IDelivererReceptacle*
 OpcodeDeliverer::getAcceptor(const CompoundPtr& compound)
 {
-    OpcodeCommand* command = dynamic_cast<OpcodeCommand*>(friends.opcodeProvider->getCommand(compound->getCommandPool()));
+    const OpcodeCommand* command = dynamic_cast<const OpcodeCommand*>(friends.opcodeProvider->peekCommandBase(compound->getCommandPool()));
 
     return recs.at(command->peer.opcode);
 }
@@ -35,13 +35,20 @@ using namespace wns::ldk::multiplexer;
 STATIC_FACTORY_REGISTER_WITH_CREATOR(OpcodeKeyBuilder, KeyBuilder, "multiplex.Opcode", FUNConfigCreator);
 
 
-OpcodeKey::OpcodeKey(const OpcodeKeyBuilder* builder, const CompoundPtr& compound)
+OpcodeKey::OpcodeKey(int _opcode)
 {
-    OpcodeCommand* command = builder->friends.opcodeProvider->getCommand(compound->getCommandPool());
-    opcode = command->peer.opcode;
+    setOpcode(_opcode);
 }
 
 
+void
+OpcodeKey::setOpcode(int _opcode)
+{
+    opcode = _opcode;
+    setHash(static_cast<std::size_t>(opcode));
+} // setOpcode
+
+
 bool
 OpcodeKey::operator < (const Key& _other) const
 {
@@ -52,6 +59,15 @@ OpcodeKey::operator < (const Key& _other) const
 } // <
 
 
+bool
+OpcodeKey::equals(const Key& _other) const
+{
+    assure(dynamic_cast<const OpcodeKey*>(&_other), "Comparing Keys of different types.");
+
+    return opcode == static_cast<const OpcodeKey*>(&_other)->opcode;
+} // equals
+
+
 std::string
 OpcodeKey::str() const
 {
@@ -75,11 +91,11 @@ OpcodeKeyBuilder::onFUNCreated()
 } // onFUNCreated
 
 
-wns::ldk::ConstKeyPtr
-OpcodeKeyBuilder::operator() (const CompoundPtr& compound, int /* direction */) const
+void
+OpcodeKeyBuilder::fill(OpcodeKey& key, const CompoundPtr& compound, int /* direction */) const
 {
-    return ConstKeyPtr(new OpcodeKey(this, compound));
-}
+    key.setOpcode(friends.opcodeProvider->peekCommand(compound->getCommandPool())->peer.opcode);
+} // fill
 
 
 
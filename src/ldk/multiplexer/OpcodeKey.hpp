@@ -34,15 +34,21 @@
 namespace wns { namespace ldk { namespace multiplexer {
 
     class OpcodeProvider;
-    class OpcodeKeyBuilder;
 
+    /**
+     * @brief Key of the opcode, hashed by the opcode
+     */
     class OpcodeKey :
         public Key
     {
     public:
-        OpcodeKey(const OpcodeKeyBuilder* builder, const CompoundPtr& compound);
+        explicit
+        OpcodeKey(int opcode = 0);
+
+        void setOpcode(int opcode);
 
         virtual bool operator<(const Key& _other) const;
+        virtual bool equals(const Key& _other) const;
         std::string str() const;
 
     private:
@@ -50,16 +56,17 @@ namespace wns { namespace ldk { namespace multiplexer {
     };
 
 
+    /**
+     * @brief Reads the opcode of the OpcodeProvider in place
+     */
     class OpcodeKeyBuilder :
-        public KeyBuilder
+        public InPlaceKeyBuilder<OpcodeKey>
     {
-        friend class OpcodeKey;
-
     public:
         OpcodeKeyBuilder(const fun::FUN* fuNet, const pyconfig::View& config);
         virtual void onFUNCreated();
 
-        virtual ConstKeyPtr operator() (const CompoundPtr& compound, int /* direction */) const;
+        virtual void fill(OpcodeKey& key, const CompoundPtr& compound, int /* direction */) const;
 
     private:
         const fun::FUN* fuNet;
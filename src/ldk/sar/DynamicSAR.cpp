@@ -52,6 +52,7 @@ DynamicSAR::DynamicSAR(fun::FUN* fuNet, const wns::pyconfig::View& config) :
     searchAlgo_(wns::search::SearchFactory::creator(config.get<std::string>("searchAlgo"))
                 ->create(0, 0, boost::bind(&DynamicSAR::compare, this, _1))),
     currentCompound_(),
+    probeCompound_(),
     currentCompoundSize_(0),
     currentCompoundSentSize_(0),
     segmentNumber_(1),
@@ -79,9 +80,10 @@ DynamicSAR::doSendData(const CompoundPtr& compound)
     Bit commandPoolSize = 0;
     Bit dataSize = 0;
 
-    CompoundPtr compoundCopy = compound->copy();
-    activateCommand(compoundCopy->getCommandPool());
-    getFUN()->calculateSizes(compoundCopy->getCommandPool(), commandPoolSize, dataSize, this);
+    // Template of the probes of the lower FU in compare()
+    probeCompound_ = compound->copy();
+    activateCommand(probeCompound_->getCommandPool());
+    getFUN()->calculateSizes(probeCompound_->getCommandPool(), commandPoolSize, dataSize, this);
 
     currentCompoundSize_ = commandPoolSize + dataSize;
 
@@ -188,7 +190,7 @@ DynamicSAR::doWakeup()
 void
 DynamicSAR::calculateSizes(const CommandPool* commandPool, Bit& commandPoolSize, Bit& sduSize) const
 {
-    DynamicSARCommand* command = getCommand(commandPool);
+    const DynamicSARCommand* command = peekCommand(commandPool);
 
     commandPoolSize = 0;
     sduSize = command->magic.segmentSize;
@@ -198,12 +200,16 @@ DynamicSAR::calculateSizes(const CommandPool* commandPool, Bit& commandPoolSize,
 bool
 DynamicSAR::compare(Bit currentSegmentSize)
 {
-    CompoundPtr compoundCopy = currentCompound_->copy();
+    // The search asks for several sizes per segment. A copy of the
+    // probe template shares its Commands (including the
+    // DynamicSARCommand), so only the Commands written by us or the
+    // lower FUs are copied, and nothing they write reaches the next probe
+    CompoundPtr probe = probeCompound_->copy();
 
-    DynamicSARCommand* command = activateCommand(compoundCopy->getCommandPool());
+    DynamicSARCommand* command = getCommand(probe->getCommandPool());
     command->magic.segmentSize = currentSegmentSize;
 
-    return getConnector()->hasAcceptor(compoundCopy);
+    return getConnector()->hasAcceptor(probe);
 } // compare
 
 
@@ -229,6 +235,9 @@ DynamicSAR::sendSegments()
 
         currentCompoundSentSize_ += segmentSize;
 
+        // Segments share the Commands of the compound and carry only
+        // their own DynamicSARCommand, the compound itself is not
+        // modified
         CompoundPtr compoundCopy = currentCompound_->copy();
         DynamicSARCommand* command = activateCommand(compoundCopy->getCommandPool());
         command->local.segmentNumber = segmentNumber_;
@@ -243,6 +252,7 @@ DynamicSAR::sendSegments()
 
             command->magic.segInfoPtr->numberSegments = segmentNumber_;
             currentCompound_ = CompoundPtr();
+            probeCompound_ = CompoundPtr();
             getConnector()->getAcceptor(compoundCopy)->sendData(compoundCopy);
             return;
         }
@@ -125,6 +125,15 @@ namespace wns { namespace search {
                 wns::search::ISearch* searchAlgo_;
 
                 CompoundPtr currentCompound_;
+
+                /**
+                 * @brief Copy of currentCompound_ with activated
+                 * DynamicSARCommand, never handed to other FUs
+                 *
+                 * Each probe of the lower FU is a copy of it, which
+                 * shares its Commands until they are written.
+                 */
+                CompoundPtr probeCompound_;
                 Bit currentCompoundSize_;
                 Bit currentCompoundSentSize_;
                 int segmentNumber_;
@@ -111,7 +111,6 @@ namespace wns { namespace ldk { namespace sar {
         {
             outgoing = CompoundPtr();
             nextSegment = CompoundPtr();
-            backupCompound = CompoundPtr();
         } // ~SAR
 
 
@@ -137,7 +136,11 @@ namespace wns { namespace ldk { namespace sar {
 
             if(outgoing == CompoundPtr() && nextSegment != CompoundPtr() )
             {
-                outgoing = backupCompound->copy();
+                // The last segment is the original compound with our
+                // Command activated. Restore the compound as it was before.
+                CommandPool* commandPool = getFUN()->createCommandPool();
+                getFUN()->getProxy()->partialCopy(this, commandPool, nextSegment->getCommandPool());
+                outgoing = CompoundPtr(new Compound(commandPool, *nextSegment));
             }
 
             nextSegment = CompoundPtr();
@@ -161,7 +164,6 @@ namespace wns { namespace ldk { namespace sar {
             assure(hasCapacity(), "processOutgoing called although not accepting.");
 
             outgoing = compound;
-            backupCompound = compound->copy();
 
             nextPos = 0;
             fragmentNumber = 0;
@@ -230,7 +232,7 @@ namespace wns { namespace ldk { namespace sar {
 
             // now we have the size of all previous Commands and of the original Compound
 
-            COMMANDTYPE* command = this->getCommand(commandPool);
+            const COMMANDTYPE* command = this->peekCommand(commandPool);
 
             Bit capacity = command->magic.segmentSize - this->getCommandSize() - ( command->magic.preserving ? commandPoolSize : 0 );
 
@@ -253,13 +255,6 @@ namespace wns { namespace ldk { namespace sar {
     protected:
         CompoundPtr outgoing;
         CompoundPtr nextSegment;
-        /**
-           @todo (msg, ksw, swen) This should be removed. The problem
-           here is that the Delayed interface should have two methods to
-           be called in advance and after getSomethingToSend(),
-           respectively.
-        */
-        CompoundPtr backupCompound;
 
         Bit nextPos;
         int fragmentNumber;
@@ -294,6 +289,10 @@ namespace wns { namespace ldk { namespace sar {
             MESSAGE_END();
             if( totalSize - nextPos > capacity )
             {
+                // The copy shares all Commands with outgoing, only our
+                // own Command (offset and length of the segment) is new.
+                // Shared Commands are copied only if an FU below
+                // modifies them.
                 nextSegment = outgoing->copy();
                 command = (SARCommand*)activateCommand(nextSegment->getCommandPool());
                 command->peer.lastFragment = false;
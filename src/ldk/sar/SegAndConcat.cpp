@@ -143,6 +143,10 @@ SegAndConcat::processOutgoing(const wns::ldk::CompoundPtr& sdu)
     bool isBegin = true;
     bool isEnd = false;
 
+    // All segments refer to the same copy of the SDU. The segments only
+    // carry sizes, so there is no need to clone the command pool per segment.
+    wns::ldk::CompoundPtr sduCopy = sdu->copy();
+
     while(cumSize < sduTotalSize)
     {
         cumSize += segmentSize_;
@@ -162,7 +166,7 @@ SegAndConcat::processOutgoing(const wns::ldk::CompoundPtr& sdu)
         wns::ldk::CompoundPtr nextSegment(new wns::ldk::Compound(getFUN()->getProxy()->createCommandPool()));
         command = activateCommand(nextSegment->getCommandPool());
         command->setSequenceNumber(nextOutgoingSN_);
-        command->addSDU(sdu->copy());
+        command->addSDU(sduCopy);
         nextOutgoingSN_ += 1;
 
         isBegin ? command->setBeginFlag() : command->clearBeginFlag();
@@ -268,7 +272,7 @@ wns::ldk::CompoundPtr
 SegAndConcat::getSomethingToSend()
 {
     assure(hasSomethingToSend(), "getSomethingToSend although nothing to send");
-    wns::ldk::CompoundPtr compound = senderPendingSegments_.front();
+    wns::ldk::CompoundPtr compound = wns::move(senderPendingSegments_.front());
 
     if (isSegmenting_)
     {
@@ -284,8 +288,8 @@ SegAndConcat::getSomethingToSend()
 void
 SegAndConcat::calculateSizes(const wns::ldk::CommandPool* commandPool, Bit& commandPoolSize, Bit& dataSize) const
 {
-    SegAndConcatCommand* command;
-    command = getCommand(commandPool);
+    const SegAndConcatCommand* command;
+    command = peekCommand(commandPool);
 
     commandPoolSize = command->peer.headerSize_;
     dataSize = command->peer.dataSize_ + command->peer.paddingSize_;
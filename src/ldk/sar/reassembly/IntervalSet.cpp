@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/sar/reassembly/IntervalSet.hpp>
+
+#include <sstream>
+
+using namespace wns::ldk::sar::reassembly;
+
+IntervalSet::IntervalSet():
+    intervals_()
+{
+}
+
+bool
+IntervalSet::insert(long sn)
+{
+    IntervalContainer::iterator next = intervals_.upper_bound(sn);
+    IntervalContainer::iterator prev = intervals_.end();
+
+    if (next != intervals_.begin())
+    {
+        prev = next;
+        --prev;
+
+        if (sn < prev->second)
+        {
+            return false;
+        }
+    }
+
+    bool joinsPrev = (prev != intervals_.end()) && (prev->second == sn);
+    bool joinsNext = (next != intervals_.end()) && (next->first == sn + 1);
+
+    if (joinsPrev && joinsNext)
+    {
+        // sn closes the gap between two ranges
+        prev->second = next->second;
+        intervals_.erase(next);
+    }
+    else if (joinsPrev)
+    {
+        prev->second = sn + 1;
+    }
+    else if (joinsNext)
+    {
+        long last = next->second;
+        intervals_.erase(next);
+        intervals_.insert(IntervalContainer::value_type(sn, last));
+    }
+    else
+    {
+        intervals_.insert(next, IntervalContainer::value_type(sn, sn + 1));
+    }
+    return true;
+}
+
+bool
+IntervalSet::contains(long sn) const
+{
+    IntervalContainer::const_iterator it = intervals_.upper_bound(sn);
+
+    if (it == intervals_.begin())
+    {
+        return false;
+    }
+    --it;
+    return sn < it->second;
+}
+
+long
+IntervalSet::nextMissing(long sn) const
+{
+    IntervalContainer::const_iterator it = intervals_.upper_bound(sn);
+
+    if (it == intervals_.begin())
+    {
+        return sn;
+    }
+    --it;
+
+    // Ranges are merged on insertion, so the end of the range
+    // containing sn is always missing
+    return (sn < it->second) ? it->second : sn;
+}
+
+void
+IntervalSet::eraseBelow(long lower)
+{
+    while (!intervals_.empty() && intervals_.begin()->second <= lower)
+    {
+        intervals_.erase(intervals_.begin());
+    }
+
+    if (!intervals_.empty() && intervals_.begin()->first < lower)
+    {
+        long last = intervals_.begin()->second;
+        intervals_.erase(intervals_.begin());
+        intervals_.insert(IntervalContainer::value_type(lower, last));
+    }
+}
+
+void
+IntervalSet::clear()
+{
+    intervals_.clear();
+}
+
+bool
+IntervalSet::empty() const
+{
+    return intervals_.empty();
+}
+
+size_t
+IntervalSet::size() const
+{
+    return intervals_.size();
+}
+
+std::string
+IntervalSet::dump() const
+{
+    std::stringstream s;
+    IntervalContainer::const_iterator it;
+
+    for (it = intervals_.begin(); it != intervals_.end(); ++it)
+    {
+        s << "[" << it->first << "," << it->second << ")";
+    }
+    return s.str();
+}
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#ifndef WNS_LDK_SAR_REASSEMBLY_INTERVALSET_HPP
+#define WNS_LDK_SAR_REASSEMBLY_INTERVALSET_HPP
+
+#include <map>
+#include <string>
+
+namespace wns { namespace ldk { namespace sar { namespace reassembly {
+
+/**
+ * @brief Set of sequence numbers stored as disjoint, half-open ranges
+ * [first, last).
+ *
+ * Adjacent numbers are merged into one range on insertion, so membership
+ * and gap detection cost O(log k) where k is the number of gaps and not
+ * the number of received segments.
+ */
+class IntervalSet
+{
+public:
+    IntervalSet();
+
+    /**
+     * @brief Add sn to the set.
+     *
+     * @return false if sn was already contained
+     */
+    bool
+    insert(long sn);
+
+    bool
+    contains(long sn) const;
+
+    /**
+     * @brief Smallest number >= sn that is not contained in the set
+     */
+    long
+    nextMissing(long sn) const;
+
+    /**
+     * @brief Remove all numbers below lower
+     */
+    void
+    eraseBelow(long lower);
+
+    void
+    clear();
+
+    bool
+    empty() const;
+
+    /**
+     * @brief Number of disjoint ranges
+     */
+    size_t
+    size() const;
+
+    std::string
+    dump() const;
+
+private:
+    typedef std::map<long, long> IntervalContainer;
+
+    IntervalContainer intervals_;
+};
+
+} // reassembly
+} // sar
+} // ldk
+} // wns
+
+#endif // WNS_LDK_SAR_REASSEMBLY_INTERVALSET_HPP
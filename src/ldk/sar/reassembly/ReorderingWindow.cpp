@@ -33,9 +33,6 @@
 
 #include <math.h>
 
-boost::lambda::placeholder1_type Arg1;
-boost::lambda::placeholder2_type Arg2;
-
 using namespace wns::ldk::sar::reassembly;
 
 ReorderingWindow::Segment::Segment(long sn, wns::ldk::CompoundPtr compound):
@@ -133,13 +130,7 @@ ReorderingWindow::onSegment(long sn, wns::ldk::CompoundPtr compound)
         }
     }
 
-    ContainerType::iterator it;
-    {
-        using namespace boost::lambda;
-        it = find_if(reorderWindow_.begin(), reorderWindow_.end(), (bind(&Segment::sn, Arg1) == vrUR_));
-    }
-
-    if(it!=reorderWindow_.end())
+    if(received_.contains(vrUR_))
     {
         vrUR_ = nextMissingSegment(Segment(vrUR_, wns::ldk::CompoundPtr())).sn();
         MESSAGE_SINGLE(VERBOSE, logger_, "onSegment: Updated vrUR_=" << vrUR_);
@@ -204,34 +195,15 @@ ReorderingWindow::insert(Segment s)
 {
     MESSAGE_SINGLE(VERBOSE, logger_, "insert: New segment " << s.sn());
 
-    using namespace boost::lambda;
-
-    ContainerType::iterator it;
-
-    // Find position to insert new segment. reorderWindow is sorted ascending by SN
-    // See bosst:lambda documentation for bind and Arg1
-    it = find_if(this->reorderWindow_.begin(),
-                 this->reorderWindow_.end(),
-                 (bind(&Segment::sn, Arg1) > s.sn()));
-
-    MESSAGE_SINGLE(VERBOSE, logger_, "insert: Inserting New segment " << s.sn());
-    this->reorderWindow_.insert(it, s);
+    // reorderWindow is keyed and thus sorted ascending by SN
+    this->reorderWindow_.insert(ContainerType::value_type(s.sn(), s.compound()));
+    this->received_.insert(s.sn());
 }
 
 bool
 ReorderingWindow::isDuplicate(Segment s)
 {
-    using namespace boost::lambda;
-
-    ContainerType::iterator it;
-
-    // Find segment. reorderWindow is sorted ascending by SN
-    // See bosst:lambda documentation for bind and Arg1
-    it = find_if(this->reorderWindow_.begin(),
-                 this->reorderWindow_.end(),
-                 (bind(&Segment::sn, Arg1) == s.sn()));
-
-    if (it!=this->reorderWindow_.end())
+    if (this->received_.contains(s.sn()))
     {
         MESSAGE_SINGLE(VERBOSE, logger_, "isDuplicate: Segment " << s.sn() << " is duplicate");
         return true;
@@ -306,42 +278,25 @@ ReorderingWindow::discard(Segment s)
 ReorderingWindow::Segment
 ReorderingWindow::nextMissingSegment(Segment s)
 {
-    long ii=(s.sn() + 1);
-    while(true)
-    {
-        if (!isDuplicate(Segment(ii, wns::ldk::CompoundPtr())))
-        {
-            return Segment(ii, wns::ldk::CompoundPtr());
-        }
-        ii += 1;
-    }
+    // Consecutive SNs are merged into one range, so this is a
+    // single lookup instead of probing every SN after s
+    return Segment(received_.nextMissing(s.sn() + 1), wns::ldk::CompoundPtr());
 }
 
 void
 ReorderingWindow::updateReassemblyBuffer(long lower)
 {
+    // reorderWindow is sorted ascending by SN, so all segments
+    // below lower are at the front
+    while(!reorderWindow_.empty() && reorderWindow_.begin()->first < lower)
     {
-        using namespace boost::lambda;
-        sort(reorderWindow_.begin(), reorderWindow_.end(),
-             (bind(&Segment::sn, Arg1) < bind(&Segment::sn, Arg2)));
-    }
-
-    ContainerType::iterator it;
-    for(it = reorderWindow_.begin(); it != reorderWindow_.end(); /* noop */)
-    {
-        if (it->sn() < lower)
-        {
-            MESSAGE_SINGLE(VERBOSE, logger_, "Moving segment " << it->sn() << " to reassembly Buffer");
+        Segment s(reorderWindow_.begin()->first, reorderWindow_.begin()->second);
+        reorderWindow_.erase(reorderWindow_.begin());
 
-            // Fire reassemble signal
-            reassemble_(it->sn(), it->compound());
+        MESSAGE_SINGLE(VERBOSE, logger_, "Moving segment " << s.sn() << " to reassembly Buffer");
 
-            // Now remove from list and adjust iterator
-            it = reorderWindow_.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
+        // Fire reassemble signal
+        reassemble_(s.sn(), s.compound());
     }
+    received_.eraseBelow(lower);
 }
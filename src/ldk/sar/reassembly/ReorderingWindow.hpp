@@ -32,9 +32,12 @@
 #include <WNS/events/scheduler/IEvent.hpp>
 #include <WNS/logger/Logger.hpp>
 #include <WNS/ldk/Compound.hpp>
+#include <WNS/ldk/sar/reassembly/IntervalSet.hpp>
 
 #include <boost/signals.hpp>
 
+#include <map>
+
 namespace wns { namespace ldk { namespace sar { namespace reassembly {
 
     class ReorderingWindow
@@ -56,7 +59,10 @@ namespace wns { namespace ldk { namespace sar { namespace reassembly {
             wns::ldk::CompoundPtr compound_;
         };
 
-        typedef std::deque<Segment> ContainerType;
+        /**
+         * @brief Buffered segments ordered by sequence number
+         */
+        typedef std::map<long, wns::ldk::CompoundPtr> ContainerType;
 
         typedef boost::signal<void (long, wns::ldk::CompoundPtr)> reassemblySignalType;
         typedef reassemblySignalType::slot_type reassemblySlotType;
@@ -129,6 +135,12 @@ namespace wns { namespace ldk { namespace sar { namespace reassembly {
 
         ContainerType reorderWindow_;
 
+        /**
+         * @brief Sequence numbers of the buffered segments as ranges.
+         * Used for duplicate and gap detection.
+         */
+        IntervalSet received_;
+
         reassemblySignalType reassemble_;
 
         discardSignalType discard_;
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/sar/reassembly/IntervalSet.hpp>
+
+#include <WNS/TestFixture.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace wns { namespace ldk { namespace sar { namespace reassembly { namespace tests {
+
+class IntervalSetTest:
+    public wns::TestFixture
+{
+    CPPUNIT_TEST_SUITE( IntervalSetTest );
+    CPPUNIT_TEST( testEmpty );
+    CPPUNIT_TEST( testInSequence );
+    CPPUNIT_TEST( testOutOfSequence );
+    CPPUNIT_TEST( testDuplicates );
+    CPPUNIT_TEST( testNextMissing );
+    CPPUNIT_TEST( testEraseBelow );
+    CPPUNIT_TEST_SUITE_END();
+
+    IntervalSet* testee;
+
+public:
+
+    void
+    prepare();
+
+    void
+    cleanup();
+
+    void
+    testEmpty();
+
+    void
+    testInSequence();
+
+    void
+    testOutOfSequence();
+
+    void
+    testDuplicates();
+
+    void
+    testNextMissing();
+
+    void
+    testEraseBelow();
+};
+
+} // tests
+} // reassembly
+} // sar
+} // ldk
+} // wns
+
+using namespace wns::ldk::sar::reassembly::tests;
+
+CPPUNIT_TEST_SUITE_REGISTRATION( IntervalSetTest );
+
+void
+IntervalSetTest::prepare()
+{
+    testee = new IntervalSet();
+}
+
+void
+IntervalSetTest::cleanup()
+{
+    delete testee;
+}
+
+void
+IntervalSetTest::testEmpty()
+{
+    CPPUNIT_ASSERT( testee->empty() );
+    CPPUNIT_ASSERT( !testee->contains(0) );
+    CPPUNIT_ASSERT_EQUAL( 5L, testee->nextMissing(5) );
+    CPPUNIT_ASSERT_EQUAL( (size_t) 0, testee->size() );
+}
+
+void
+IntervalSetTest::testInSequence()
+{
+    for (long ii = 0; ii < 10; ++ii)
+    {
+        CPPUNIT_ASSERT( testee->insert(ii) );
+    }
+
+    CPPUNIT_ASSERT_EQUAL( (size_t) 1, testee->size() );
+    CPPUNIT_ASSERT_EQUAL( std::string("[0,10)"), testee->dump() );
+
+    for (long ii = 0; ii < 10; ++ii)
+    {
+        CPPUNIT_ASSERT( testee->contains(ii) );
+    }
+    CPPUNIT_ASSERT( !testee->contains(-1) );
+    CPPUNIT_ASSERT( !testee->contains(10) );
+}
+
+void
+IntervalSetTest::testOutOfSequence()
+{
+    testee->insert(5);
+    testee->insert(1);
+    testee->insert(3);
+    CPPUNIT_ASSERT_EQUAL( std::string("[1,2)[3,4)[5,6)"), testee->dump() );
+
+    // Extends the range on the right
+    testee->insert(6);
+    // Extends the range on the left
+    testee->insert(0);
+    CPPUNIT_ASSERT_EQUAL( std::string("[0,2)[3,4)[5,7)"), testee->dump() );
+
+    // Closes the gaps
+    testee->insert(2);
+    CPPUNIT_ASSERT_EQUAL( std::string("[0,4)[5,7)"), testee->dump() );
+    testee->insert(4);
+    CPPUNIT_ASSERT_EQUAL( std::string("[0,7)"), testee->dump() );
+}
+
+void
+IntervalSetTest::testDuplicates()
+{
+    CPPUNIT_ASSERT( testee->insert(1) );
+    CPPUNIT_ASSERT( testee->insert(2) );
+    CPPUNIT_ASSERT( testee->insert(4) );
+
+    CPPUNIT_ASSERT( !testee->insert(1) );
+    CPPUNIT_ASSERT( !testee->insert(2) );
+    CPPUNIT_ASSERT( !testee->insert(4) );
+
+    CPPUNIT_ASSERT_EQUAL( std::string("[1,3)[4,5)"), testee->dump() );
+}
+
+void
+IntervalSetTest::testNextMissing()
+{
+    testee->insert(0);
+    testee->insert(1);
+    testee->insert(2);
+    testee->insert(4);
+    testee->insert(5);
+
+    CPPUNIT_ASSERT_EQUAL( 3L, testee->nextMissing(0) );
+    CPPUNIT_ASSERT_EQUAL( 3L, testee->nextMissing(2) );
+    CPPUNIT_ASSERT_EQUAL( 3L, testee->nextMissing(3) );
+    CPPUNIT_ASSERT_EQUAL( 6L, testee->nextMissing(4) );
+    CPPUNIT_ASSERT_EQUAL( 7L, testee->nextMissing(7) );
+    CPPUNIT_ASSERT_EQUAL( -1L, testee->nextMissing(-1) );
+}
+
+void
+IntervalSetTest::testEraseBelow()
+{
+    testee->insert(0);
+    testee->insert(1);
+    testee->insert(2);
+    testee->insert(4);
+    testee->insert(5);
+    testee->insert(8);
+
+    // Cuts the first range
+    testee->eraseBelow(1);
+    CPPUNIT_ASSERT_EQUAL( std::string("[1,3)[4,6)[8,9)"), testee->dump() );
+
+    // Removes the first range and cuts the second
+    testee->eraseBelow(5);
+    CPPUNIT_ASSERT_EQUAL( std::string("[5,6)[8,9)"), testee->dump() );
+    CPPUNIT_ASSERT( !testee->contains(4) );
+
+    testee->eraseBelow(9);
+    CPPUNIT_ASSERT( testee->empty() );
+}
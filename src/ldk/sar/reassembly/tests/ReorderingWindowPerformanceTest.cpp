@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/sar/reassembly/ReorderingWindow.hpp>
+
+#include <WNS/TestFixture.hpp>
+#include <WNS/StopWatch.hpp>
+#include <WNS/pyconfig/Parser.hpp>
+#include <WNS/pyconfig/View.hpp>
+
+#include <boost/bind.hpp>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <iostream>
+
+namespace wns { namespace ldk { namespace sar { namespace reassembly { namespace tests {
+
+/**
+ * @brief Throughput of the ReorderingWindow for in-order, out-of-order
+ * and lossy arrival of segments
+ */
+class ReorderingWindowPerformanceTest:
+    public wns::TestFixture
+{
+    CPPUNIT_TEST_SUITE( ReorderingWindowPerformanceTest );
+    CPPUNIT_TEST( testInSequence );
+    CPPUNIT_TEST( testOutOfSequence );
+    CPPUNIT_TEST( testLossy );
+    CPPUNIT_TEST_SUITE_END();
+
+    ReorderingWindow* rw;
+
+    long numberOfSegments;
+
+    long blockSize;
+
+    long received;
+
+public:
+
+    ReorderingWindowPerformanceTest();
+
+    void
+    prepare();
+
+    void
+    cleanup();
+
+    void
+    reassemble(long, wns::ldk::CompoundPtr);
+
+    void
+    testInSequence();
+
+    void
+    testOutOfSequence();
+
+    void
+    testLossy();
+
+private:
+    /**
+     * @brief Feed numberOfSegments segments in blocks of blockSize.
+     * Within a block the segments arrive in reverse order if
+     * reverse is set. Every lossInterval-th segment is lost if
+     * lossInterval is greater than zero.
+     */
+    void
+    run(const std::string& name, bool reverse, long lossInterval);
+};
+
+} // tests
+} // reassembly
+} // sar
+} // ldk
+} // wns
+
+using namespace wns::ldk::sar::reassembly::tests;
+
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION( ReorderingWindowPerformanceTest, wns::testsuite::Performance() );
+
+ReorderingWindowPerformanceTest::ReorderingWindowPerformanceTest():
+    rw(NULL),
+    numberOfSegments(1000000),
+    blockSize(64),
+    received(0)
+{
+}
+
+void
+ReorderingWindowPerformanceTest::prepare()
+{
+    received = 0;
+    wns::pyconfig::Parser config;
+    config.loadString(
+        "from openwns.SAR import ReorderingWindow\n"
+        "testee = ReorderingWindow(snFieldLength=10)\n"
+        "testee.logger.level = 1\n"
+    );
+
+    wns::pyconfig::View configView(config, "testee");
+    rw = new ReorderingWindow(configView);
+    rw->connectToReassemblySignal(boost::bind(&ReorderingWindowPerformanceTest::reassemble, this, _1, _2));
+}
+
+void
+ReorderingWindowPerformanceTest::cleanup()
+{
+    delete rw;
+}
+
+void
+ReorderingWindowPerformanceTest::reassemble(long, wns::ldk::CompoundPtr)
+{
+    ++received;
+}
+
+void
+ReorderingWindowPerformanceTest::run(const std::string& name, bool reverse, long lossInterval)
+{
+    long lost = 0;
+
+    wns::StopWatch sw;
+    sw.start();
+    for (long block = 0; block < numberOfSegments; block += blockSize)
+    {
+        for (long ii = 0; ii < blockSize; ++ii)
+        {
+            long sn = reverse ? (block + blockSize - 1 - ii) : (block + ii);
+
+            if (lossInterval > 0 && sn % lossInterval == 0)
+            {
+                ++lost;
+                continue;
+            }
+            rw->onSegment(sn, wns::ldk::CompoundPtr());
+        }
+
+        // Let t-Reordering expire to get past the lost segments
+        while (wns::simulator::getEventScheduler()->processOneEvent())
+        {
+        }
+    }
+    sw.stop();
+
+    std::cout << "\n" << name << "(): " << numberOfSegments << " segments took "
+              << sw.toString() << std::endl;
+    std::cout << "Segments/s: " << numberOfSegments/sw.getInSeconds() << std::endl;
+
+    CPPUNIT_ASSERT_EQUAL(numberOfSegments - lost, received);
+}
+
+void
+ReorderingWindowPerformanceTest::testInSequence()
+{
+    run("testInSequence", false, 0);
+}
+
+void
+ReorderingWindowPerformanceTest::testOutOfSequence()
+{
+    run("testOutOfSequence", true, 0);
+}
+
+void
+ReorderingWindowPerformanceTest::testLossy()
+{
+    run("testLossy", true, 50);
+}
@@ -43,6 +43,7 @@ namespace wns { namespace ldk { namespace sar { namespace tests {
                     CPPUNIT_TEST( testSendSmallCompound );
                     CPPUNIT_TEST( testSendLargeCompound );
                     CPPUNIT_TEST( testSendDifferentAcceptanceSizes );
+                    CPPUNIT_TEST( testSendKeepsCompound );
                     CPPUNIT_TEST( testReceiveSmallCompound );
                     CPPUNIT_TEST( testReceiveLargeCompound );
                     CPPUNIT_TEST( testReceiveDifferentAcceptanceSizes );
@@ -60,6 +61,9 @@ namespace wns { namespace ldk { namespace sar { namespace tests {
                     void
                     testSendDifferentAcceptanceSizes();
 
+                    void
+                    testSendKeepsCompound();
+
                     void
                     testReceiveSmallCompound();
 
@@ -230,6 +234,33 @@ namespace wns { namespace ldk { namespace sar { namespace tests {
                     CPPUNIT_ASSERT_EQUAL(size_t(81), getLowerStub()->sent.size());
                 } // testSendDifferentAcceptanceSizes
 
+                void
+                DynamicSARTest::testSendKeepsCompound()
+                {
+                    getUpperStub()->setSizes(64, 1536);
+                    getLowerStub()->close();
+                    CompoundPtr compound = newFakeCompound();
+                    getUpperStub()->sendData(compound);
+
+                    getLowerStub()->setAcceptanceSize(1024);
+                    getLowerStub()->step();
+                    getLowerStub()->setAcceptanceSize(768);
+                    getLowerStub()->step();
+                    CPPUNIT_ASSERT_EQUAL(size_t(2), getLowerStub()->sent.size());
+
+                    // all segments, including the last one, are copies
+                    CPPUNIT_ASSERT( getLowerStub()->sent[0] != compound );
+                    CPPUNIT_ASSERT( getLowerStub()->sent[1] != compound );
+                    CPPUNIT_ASSERT( !getFUN()->getProxy()->commandIsActivated(
+                                        compound->getCommandPool(), dynamicSAR) );
+
+                    Bit commandPoolSize = 0;
+                    Bit dataSize = 0;
+                    getLowerStub()->calculateSizes(getLowerStub()->sent[1]
+                                                   ->getCommandPool(), commandPoolSize, dataSize);
+                    CPPUNIT_ASSERT_EQUAL(Bit(576), dataSize);
+                } // testSendKeepsCompound
+
                 void
                 DynamicSARTest::testReceiveSmallCompound()
                 {
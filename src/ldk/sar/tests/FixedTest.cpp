@@ -53,6 +53,7 @@ namespace wns { namespace ldk { namespace sar { namespace tests {
         CPPUNIT_TEST( changingSegmentSizeOutgoing );
         CPPUNIT_TEST( changingSegmentSizeIncoming );
         CPPUNIT_TEST( testChangeSegmentSizeOnLastSegment );
+        CPPUNIT_TEST( testSegmentsKeepBirthmark );
         CPPUNIT_TEST_SUITE_END();
     public:
         void
@@ -94,6 +95,9 @@ namespace wns { namespace ldk { namespace sar { namespace tests {
         void
         testChangeSegmentSizeOnLastSegment();
 
+        void
+        testSegmentsKeepBirthmark();
+
     private:
         virtual void
         prepare();
@@ -382,6 +386,27 @@ namespace wns { namespace ldk { namespace sar { namespace tests {
         CPPUNIT_ASSERT_EQUAL(Bit(5), getTotalSize(getLowerStub()->sent[2]->getCommandPool()));
     }
 
+    void
+    FixedTest::testSegmentsKeepBirthmark()
+    {
+        innerPDU->setLengthInBits(42+42+2);
+        CompoundPtr compound(new Compound(commandPool, innerPDU));
+        getLowerStub()->setStepping(true);
+        getUpperStub()->sendData(compound);
+        getLowerStub()->step();
+
+        // The last segment is rebuilt from the pending one
+        getTestee<Fixed>()->setSegmentSize(42);
+        getLowerStub()->step();
+        CPPUNIT_ASSERT_EQUAL(static_cast<unsigned int>(3), compoundsSent());
+
+        for(int ii = 0; ii < 3; ++ii)
+        {
+            CPPUNIT_ASSERT(getLowerStub()->sent[ii]->getBirthmark() == compound->getBirthmark());
+            CPPUNIT_ASSERT(getLowerStub()->sent[ii]->getData() == compound->getData());
+        }
+    }
+
 }
 }
 }
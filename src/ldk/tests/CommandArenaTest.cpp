@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/CommandArena.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace wns { namespace ldk { namespace tests {
+
+	class CommandArenaTest :
+		public CppUnit::TestFixture
+	{
+		CPPUNIT_TEST_SUITE( CommandArenaTest );
+		CPPUNIT_TEST( allocate );
+		CPPUNIT_TEST( grow );
+		CPPUNIT_TEST( references );
+		CPPUNIT_TEST_SUITE_END();
+	public:
+		void setUp();
+		void tearDown();
+
+		void allocate();
+		void grow();
+		void references();
+	};
+
+	CPPUNIT_TEST_SUITE_REGISTRATION( CommandArenaTest );
+
+}
+}
+}
+using namespace wns::ldk;
+using namespace wns::ldk::tests;
+
+void
+CommandArenaTest::setUp()
+{
+}
+
+void
+CommandArenaTest::tearDown()
+{
+}
+
+void
+CommandArenaTest::allocate()
+{
+	CommandArena* arena = CommandArena::create(96);
+
+	// consecutive and aligned
+	unsigned char* first = static_cast<unsigned char*>(arena->allocate(40));
+	unsigned char* second = static_cast<unsigned char*>(arena->allocate(8));
+	unsigned char* third = static_cast<unsigned char*>(arena->allocate(17));
+	CPPUNIT_ASSERT_EQUAL( static_cast<long int>(48), static_cast<long int>(second - first) );
+	CPPUNIT_ASSERT_EQUAL( static_cast<long int>(16), static_cast<long int>(third - second) );
+	CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), reinterpret_cast<size_t>(first) % CommandArena::alignment );
+	CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(96), arena->getUsed() );
+	CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(1), arena->getNumberOfBlocks() );
+
+	CPPUNIT_ASSERT( arena->contains(first) );
+	CPPUNIT_ASSERT( arena->contains(third + 16) );
+	CPPUNIT_ASSERT( !arena->contains(&first) );
+
+	arena->release();
+}
+
+void
+CommandArenaTest::grow()
+{
+	CommandArena* arena = CommandArena::create(32);
+	unsigned char* first = static_cast<unsigned char*>(arena->allocate(32));
+
+	// a full block is not moved, another one is added
+	unsigned char* second = static_cast<unsigned char*>(arena->allocate(16));
+	CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), arena->getNumberOfBlocks() );
+	CPPUNIT_ASSERT( arena->contains(first) );
+	CPPUNIT_ASSERT( arena->contains(second) );
+
+	// at least twice as large as the previous block
+	arena->allocate(48);
+	CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), arena->getNumberOfBlocks() );
+	arena->allocate(200);
+	CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(3), arena->getNumberOfBlocks() );
+	CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(32 + 16 + 48 + 208), arena->getUsed() );
+
+	// an empty arena grows on first use
+	CommandArena* empty = CommandArena::create(0);
+	CPPUNIT_ASSERT( empty->allocate(8) != NULL );
+	CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), empty->getNumberOfBlocks() );
+
+	empty->release();
+	arena->release();
+}
+
+void
+CommandArenaTest::references()
+{
+	CommandArena* arena = CommandArena::create(64);
+	void* command = arena->allocate(16);
+
+	// e.g. a Command living longer than its CommandPool
+	arena->acquire();
+	arena->release();
+	CPPUNIT_ASSERT( arena->contains(command) );
+	arena->release();
+}
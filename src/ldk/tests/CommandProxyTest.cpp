@@ -28,6 +28,7 @@
 #include <WNS/ldk/CommandProxy.hpp>
 #include <WNS/ldk/Command.hpp>
 #include <WNS/ldk/CommandTypeSpecifier.hpp>
+#include <WNS/ldk/CommandArena.hpp>
 #include <WNS/ldk/HasReceptor.hpp>
 #include <WNS/ldk/HasConnector.hpp>
 #include <WNS/ldk/HasDeliverer.hpp>
@@ -96,6 +97,9 @@ namespace wns { namespace ldk { namespace tests {
 		CPPUNIT_TEST( commandReader );
 		CPPUNIT_TEST( copy );
 		CPPUNIT_TEST( partialCopy );
+		CPPUNIT_TEST( copyOnWrite );
+		CPPUNIT_TEST( writeToSharedCommand );
+		CPPUNIT_TEST( arena );
 		CPPUNIT_TEST_SUITE_END();
 	public:
 		void prepare();
@@ -106,6 +110,9 @@ namespace wns { namespace ldk { namespace tests {
 		void commandReader();
 		void copy();
 		void partialCopy();
+		void copyOnWrite();
+		void writeToSharedCommand();
+		void arena();
 	private:
 
 		fun::FUN* fun;
@@ -315,5 +322,112 @@ CommandProxyTest::partialCopy()
 	delete pool2;
 }
 
+void
+CommandProxyTest::copyOnWrite()
+{
+	// Add "a" once
+	proxy->addFunctionalUnit("roleA", a);
+	// Add "b" once
+	proxy->addFunctionalUnit("roleB", b);
+
+	CommandPool* pool = proxy->createCommandPool();
+	ACommand* original = dynamic_cast<ACommand*>(proxy->activateCommand(pool, a));
+	original->peer = 1;
+	proxy->activateCommand(pool, b);
+
+	CommandPool* copy = proxy->createCommandPool();
+	proxy->copy(copy, pool);
+
+	// reading does not copy the command
+	CPPUNIT_ASSERT( proxy->peekCommand(copy, a->getPCIID()) == original );
+	CPPUNIT_ASSERT( proxy->peekCommand(copy, b->getPCIID()) == proxy->peekCommand(pool, b->getPCIID()) );
+
+	// retrieving it for writing does
+	ACommand* copied = dynamic_cast<ACommand*>(proxy->getCommand(copy, a));
+	CPPUNIT_ASSERT( copied != original );
+	CPPUNIT_ASSERT_EQUAL( 1, copied->peer );
+	copied->peer = 2;
+	CPPUNIT_ASSERT_EQUAL( 1, original->peer );
+
+	// but only once, and b's command is still shared
+	CPPUNIT_ASSERT( proxy->getCommand(copy, a) == copied );
+	CPPUNIT_ASSERT( proxy->peekCommand(copy, b->getPCIID()) == proxy->peekCommand(pool, b->getPCIID()) );
+
+	// the remaining pool still owns the formerly shared commands
+	delete pool;
+	CPPUNIT_ASSERT_EQUAL( 2, dynamic_cast<ACommand*>(proxy->getCommand(copy, a))->peer );
+	CPPUNIT_ASSERT( proxy->getCommand(copy, b) != NULL );
+	delete copy;
+}
+
+void
+CommandProxyTest::writeToSharedCommand()
+{
+	proxy->addFunctionalUnit("roleA", a);
+	proxy->addFunctionalUnit("roleB", b);
+
+	CommandPool* pool = proxy->createCommandPool();
+	ACommand* command = dynamic_cast<ACommand*>(proxy->activateCommand(pool, a));
+	command->peer = 1;
+
+	CommandPool* copy = proxy->createCommandPool();
+	proxy->copy(copy, pool);
+
+	// writing through a Command* retrieved before copying is detected
+	command->peer = 2;
+	WNS_ASSERT_ASSURE_EXCEPTION( proxy->peekCommand(copy, a->getPCIID()) );
+	command->peer = 1;
+
+	// also if the Command is left to the copy
+	ACommand* own = dynamic_cast<ACommand*>(proxy->getCommand(pool, a));
+	CPPUNIT_ASSERT( own != command );
+	command->peer = 3;
+	WNS_ASSERT_ASSURE_EXCEPTION( proxy->getCommand(copy, a) );
+	command->peer = 1;
+
+	// retrieving it for writing allows to modify it again
+	command = dynamic_cast<ACommand*>(proxy->getCommand(copy, a));
+	command->peer = 4;
+	CPPUNIT_ASSERT_EQUAL( 4, dynamic_cast<const ACommand*>(proxy->peekCommand(copy, a->getPCIID()))->peer );
+	CPPUNIT_ASSERT_EQUAL( 1, own->peer );
+
+	delete pool;
+	delete copy;
+}
+
+void
+CommandProxyTest::arena()
+{
+	// Add "a" once
+	proxy->addFunctionalUnit("roleA", a);
+	// Add "b" once
+	proxy->addFunctionalUnit("roleB", b);
+
+	CommandPool* first = proxy->createCommandPool();
+	proxy->activateCommand(first, b);
+	proxy->activateCommand(first, a);
+	delete first;
+
+	// new pools reserve room for this activation path
+	CPPUNIT_ASSERT_EQUAL(
+		CommandArena::align(sizeof(ACommand)) + CommandArena::align(sizeof(BCommand)),
+		proxy->getArenaCapacity() );
+
+	CommandPool* pool = proxy->createCommandPool();
+	proxy->activateCommand(pool, b);
+	proxy->activateCommand(pool, a);
 
+	// so both Commands live next to each other in the pool's arena
+	const char* commandA = reinterpret_cast<const char*>(proxy->peekCommand(pool, a->getPCIID()));
+	const char* commandB = reinterpret_cast<const char*>(proxy->peekCommand(pool, b->getPCIID()));
+	long int expected = static_cast<long int>(CommandArena::align(sizeof(BCommand)));
+	CPPUNIT_ASSERT_EQUAL( expected, static_cast<long int>(commandA - commandB) );
 
+	// Commands shared with a copy survive the pool's arena
+	CommandPool* copy = proxy->createCommandPool();
+	proxy->copy(copy, pool);
+	delete pool;
+	CPPUNIT_ASSERT( proxy->getCommand(copy, a) != NULL );
+	CPPUNIT_ASSERT( proxy->getCommand(copy, b) != NULL );
+	delete copy;
+}
@@ -174,4 +174,35 @@ GroupFlowSeparatorTest::testOutgoing()
 } // testOutgoing
 
 
+void
+GroupFlowSeparatorTest::testHashedKeys()
+{
+	// more flows than the initial number of buckets of the KeyIndex
+	const int flows = 40;
+
+	for (int round = 0; round < 2; ++round)
+	{
+		for (int ii = 0; ii < flows; ++ii)
+		{
+			CompoundPtr compound(fuNet->createCompound());
+			opcode->activateCommand(compound->getCommandPool())->peer.opcode = ii;
+
+			ConstKeyPtr key = flowSeparator->getKey(compound, Direction::OUTGOING());
+			CPPUNIT_ASSERT( key->hasHash() );
+
+			upper->sendData(compound);
+			CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(round == 0 ? ii + 1 : flows), flowSeparator->size());
+			CPPUNIT_ASSERT( flowSeparator->getInstance(compound, Direction::OUTGOING())
+					== flowSeparator->getInstance(ConstKeyPtr(new multiplexer::OpcodeKey(ii))) );
+		}
+	}
+	CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2 * flows), lower->sent.size());
+
+	// different opcodes, different instances
+	CPPUNIT_ASSERT( flowSeparator->getInstance(ConstKeyPtr(new multiplexer::OpcodeKey(1)))
+			!= flowSeparator->getInstance(ConstKeyPtr(new multiplexer::OpcodeKey(17))) );
+	CPPUNIT_ASSERT( flowSeparator->getInstance(ConstKeyPtr(new multiplexer::OpcodeKey(flows))) == NULL );
+} // testHashedKeys
+
+
 
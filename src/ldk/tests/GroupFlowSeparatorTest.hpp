@@ -47,6 +47,7 @@ namespace wns { namespace ldk { namespace tests {
 		CPPUNIT_TEST_SUITE( GroupFlowSeparatorTest );
 		CPPUNIT_TEST( testIncoming );
 		CPPUNIT_TEST( testOutgoing );
+		CPPUNIT_TEST( testHashedKeys );
 		CPPUNIT_TEST_SUITE_END();
 	public:
 		void setUp();
@@ -54,6 +55,7 @@ namespace wns { namespace ldk { namespace tests {
 
 		void testIncoming();
 		void testOutgoing();
+		void testHashedKeys();
 	private:
 		ILayer* layer;
 		fun::FUN* fuNet;
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/Journey.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace wns { namespace ldk { namespace tests {
+
+	class JourneyTest :
+		public CppUnit::TestFixture
+	{
+		CPPUNIT_TEST_SUITE( JourneyTest );
+		CPPUNIT_TEST( intern );
+		CPPUNIT_TEST( record );
+		CPPUNIT_TEST( wrapAround );
+		CPPUNIT_TEST( copy );
+		CPPUNIT_TEST( tracing );
+		CPPUNIT_TEST_SUITE_END();
+	public:
+		void setUp();
+		void tearDown();
+
+		void intern();
+		void record();
+		void wrapAround();
+		void copy();
+		void tracing();
+
+	private:
+		Journey::LocationID a;
+		Journey::LocationID b;
+	};
+
+	CPPUNIT_TEST_SUITE_REGISTRATION( JourneyTest );
+
+}
+}
+}
+using namespace wns::ldk;
+using namespace wns::ldk::tests;
+
+void
+JourneyTest::setUp()
+{
+	a = Journey::intern("node.fun.a");
+	b = Journey::intern("node.fun.b");
+}
+
+void
+JourneyTest::tearDown()
+{
+	Journey::setTracing(false);
+}
+
+void
+JourneyTest::intern()
+{
+	CPPUNIT_ASSERT( a != 0 );
+	CPPUNIT_ASSERT( a != b );
+	CPPUNIT_ASSERT_EQUAL( a, Journey::intern("node.fun.a") );
+	CPPUNIT_ASSERT_EQUAL( std::string("node.fun.b"), Journey::resolve(b) );
+	CPPUNIT_ASSERT_EQUAL( std::string("unknown location"), Journey::resolve(0) );
+}
+
+void
+JourneyTest::record()
+{
+	Journey journey;
+	CPPUNIT_ASSERT( journey.empty() );
+
+	journey.record(1.0, a);
+	journey.record(2.0, b);
+
+	CPPUNIT_ASSERT_EQUAL( static_cast<std::size_t>(2), journey.size() );
+	CPPUNIT_ASSERT_EQUAL( 1.0, journey.at(0).t );
+	CPPUNIT_ASSERT_EQUAL( std::string("node.fun.a"), journey.at(0).getLocation() );
+	CPPUNIT_ASSERT_EQUAL( std::string("node.fun.b"), journey.back().getLocation() );
+	CPPUNIT_ASSERT( journey.dump().find("node.fun.b") != std::string::npos );
+}
+
+void
+JourneyTest::wrapAround()
+{
+	Journey journey;
+	for (std::size_t i = 0; i < Journey::capacity + 3; ++i)
+	{
+		journey.record(double(i), i % 2 ? b : a);
+	}
+
+	// the oldest hops have been overwritten
+	CPPUNIT_ASSERT_EQUAL( Journey::capacity, journey.size() );
+	CPPUNIT_ASSERT_EQUAL( static_cast<unsigned long int>(Journey::capacity + 3), journey.getNumberOfVisits() );
+	CPPUNIT_ASSERT_EQUAL( 3.0, journey.at(0).t );
+	CPPUNIT_ASSERT_EQUAL( double(Journey::capacity + 2), journey.back().t );
+	CPPUNIT_ASSERT( journey.dump().find("3 earlier hops dropped") != std::string::npos );
+}
+
+void
+JourneyTest::copy()
+{
+	Journey journey;
+	for (std::size_t i = 0; i < Journey::capacity + 1; ++i)
+	{
+		journey.record(double(i), a);
+	}
+
+	Journey other(journey);
+	CPPUNIT_ASSERT( other == journey );
+
+	other.record(42.0, b);
+	CPPUNIT_ASSERT( !(other == journey) );
+
+	other = journey;
+	CPPUNIT_ASSERT( other == journey );
+	CPPUNIT_ASSERT( !(Journey() == journey) );
+}
+
+void
+JourneyTest::tracing()
+{
+	CPPUNIT_ASSERT( !Journey::isTracing() );
+	Journey::setTracing(true);
+	CPPUNIT_ASSERT( Journey::isTracing() );
+}
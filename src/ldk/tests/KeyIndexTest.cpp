@@ -0,0 +1,244 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/ldk/flowseparator/KeyIndex.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sstream>
+
+namespace wns { namespace ldk { namespace tests {
+
+	namespace keyindextest {
+
+		class FlowKey :
+			public Key
+		{
+		public:
+			FlowKey(int _flow = 0, bool _hashed = true) :
+				flow(_flow)
+			{
+				if (_hashed)
+				{
+					setHash(combineHash(0, flow));
+				}
+			}
+
+			bool
+			operator<(const Key& other) const
+			{
+				return flow < static_cast<const FlowKey&>(other).flow;
+			}
+
+			bool
+			equals(const Key& other) const
+			{
+				return flow == static_cast<const FlowKey&>(other).flow;
+			}
+
+			std::string
+			str() const
+			{
+				std::stringstream ss;
+				ss << "flow:" << flow;
+				return ss.str();
+			}
+
+			void
+			setFlow(int _flow)
+			{
+				flow = _flow;
+				setHash(combineHash(0, flow));
+			}
+
+			int flow;
+		};
+
+		class FlowKeyBuilder :
+			public InPlaceKeyBuilder<FlowKey>
+		{
+		public:
+			FlowKeyBuilder() :
+				flow(0)
+			{}
+
+			void
+			onFUNCreated()
+			{}
+
+			void
+			fill(FlowKey& key, const CompoundPtr&, int) const
+			{
+				key.setFlow(flow);
+			}
+
+			int flow;
+		};
+
+	} // keyindextest
+
+	class KeyIndexTest :
+		public CppUnit::TestFixture
+	{
+		CPPUNIT_TEST_SUITE( KeyIndexTest );
+		CPPUNIT_TEST( hashed );
+		CPPUNIT_TEST( ordered );
+		CPPUNIT_TEST( erase );
+		CPPUNIT_TEST( inPlace );
+		CPPUNIT_TEST_SUITE_END();
+	public:
+		void setUp();
+		void tearDown();
+
+		void hashed();
+		void ordered();
+		void erase();
+		void inPlace();
+
+	private:
+		void
+		fill(bool hashedKeys);
+
+		flowseparator::KeyIndex<int> index;
+	};
+
+	CPPUNIT_TEST_SUITE_REGISTRATION( KeyIndexTest );
+
+}
+}
+}
+using namespace wns::ldk;
+using namespace wns::ldk::tests;
+using namespace wns::ldk::tests::keyindextest;
+
+void
+KeyIndexTest::setUp()
+{
+	index.clear();
+}
+
+void
+KeyIndexTest::tearDown()
+{
+	index.clear();
+}
+
+void
+KeyIndexTest::fill(bool hashedKeys)
+{
+	// enough flows to grow the hash index a few times
+	for (int flow = 999; flow >= 0; --flow)
+	{
+		index.insert(ConstKeyPtr(new FlowKey(flow, hashedKeys)), 2 * flow);
+	}
+}
+
+void
+KeyIndexTest::hashed()
+{
+	fill(true);
+	CPPUNIT_ASSERT_EQUAL( static_cast<std::size_t>(1000), index.size() );
+
+	for (int flow = 0; flow < 1000; ++flow)
+	{
+		const int* value = index.find(FlowKey(flow));
+		CPPUNIT_ASSERT( value != NULL );
+		CPPUNIT_ASSERT_EQUAL( 2 * flow, *value );
+	}
+	CPPUNIT_ASSERT( !index.knows(FlowKey(1000)) );
+
+	// last hit
+	CPPUNIT_ASSERT_EQUAL( 14, *index.find(FlowKey(7)) );
+	CPPUNIT_ASSERT_EQUAL( 14, *index.find(FlowKey(7)) );
+}
+
+void
+KeyIndexTest::ordered()
+{
+	fill(false);
+
+	for (int flow = 0; flow < 1000; ++flow)
+	{
+		CPPUNIT_ASSERT_EQUAL( 2 * flow, *index.find(FlowKey(flow, false)) );
+	}
+	CPPUNIT_ASSERT( !index.knows(FlowKey(-1, false)) );
+
+	// iteration is ordered by key
+	int expected = 0;
+	for (flowseparator::KeyIndex<int>::const_iterator it = index.begin();
+	     it != index.end();
+	     ++it, ++expected)
+	{
+		CPPUNIT_ASSERT_EQUAL( 2 * expected, it->second.value );
+	}
+}
+
+void
+KeyIndexTest::erase()
+{
+	fill(true);
+
+	CPPUNIT_ASSERT_EQUAL( 10, *index.find(FlowKey(5)) );
+	CPPUNIT_ASSERT( index.erase(FlowKey(5)) );
+	CPPUNIT_ASSERT( !index.erase(FlowKey(5)) );
+	CPPUNIT_ASSERT( !index.knows(FlowKey(5)) );
+	CPPUNIT_ASSERT_EQUAL( static_cast<std::size_t>(999), index.size() );
+
+	index.insert(ConstKeyPtr(new FlowKey(5)), 42);
+	CPPUNIT_ASSERT_EQUAL( 42, *index.find(FlowKey(5)) );
+
+	flowseparator::KeyIndex<int> copy(index);
+	index.clear();
+	CPPUNIT_ASSERT( index.empty() );
+	CPPUNIT_ASSERT_EQUAL( 42, *copy.find(FlowKey(5)) );
+	CPPUNIT_ASSERT_EQUAL( 1998, *copy.find(FlowKey(999)) );
+}
+
+void
+KeyIndexTest::inPlace()
+{
+	fill(true);
+
+	FlowKeyBuilder builder;
+	builder.flow = 3;
+
+	const Key* key = builder.peekKey(CompoundPtr(), 0);
+	CPPUNIT_ASSERT( key != NULL );
+	CPPUNIT_ASSERT_EQUAL( 6, *index.find(*key) );
+
+	// the same Key is filled again
+	builder.flow = 4;
+	CPPUNIT_ASSERT( key == builder.peekKey(CompoundPtr(), 0) );
+	CPPUNIT_ASSERT_EQUAL( 8, *index.find(*key) );
+
+	// a Key of its own for registration
+	builder.flow = 1000;
+	ConstKeyPtr newKey = builder(CompoundPtr(), 0);
+	CPPUNIT_ASSERT( newKey.getPtr() != key );
+	index.insert(newKey, 1);
+	CPPUNIT_ASSERT_EQUAL( 1, *index.find(*builder.peekKey(CompoundPtr(), 0)) );
+}
@@ -94,6 +94,90 @@ SizeCalculationTest::testVanilla()
 } // testVanilla
 
 
+void
+SizeCalculationTest::testCached()
+{
+	Bit commandPoolSize;
+	Bit dataSize;
+
+	CommandProxy* proxy = fuNet->getProxy();
+	proxy->addFunctionalUnit("upper", upper);
+	proxy->addFunctionalUnit("lower", lower);
+	upper->setSizes(8, 0);
+	lower->setSizes(16, 0);
+
+	helper::FakePDUPtr inner(new helper::FakePDU(42));
+
+	CompoundPtr compound(fuNet->createCompound(inner));
+	CommandPool* commandPool = compound->getCommandPool();
+
+	upper->activateCommand(commandPool);
+	commandPool->calculateSizes(commandPoolSize, dataSize);
+	CPPUNIT_ASSERT_EQUAL(Bit(8), commandPoolSize);
+	CPPUNIT_ASSERT_EQUAL(Bit(42), dataSize);
+
+	// activation invalidates the cached sizes
+	lower->activateCommand(commandPool);
+	commandPool->calculateSizes(commandPoolSize, dataSize);
+	CPPUNIT_ASSERT_EQUAL(Bit(24), commandPoolSize);
+	commandPool->calculateSizes(commandPoolSize, dataSize);
+	CPPUNIT_ASSERT_EQUAL(Bit(24), commandPoolSize);
+
+	// the view of a questioner is never cached
+	commandPool->calculateSizes(commandPoolSize, dataSize, lower);
+	CPPUNIT_ASSERT_EQUAL(Bit(8), commandPoolSize);
+	commandPool->calculateSizes(commandPoolSize, dataSize, upper);
+	CPPUNIT_ASSERT_EQUAL(Bit(0), commandPoolSize);
+
+	// neither are changes of the FunctionalUnits or the SDU missed
+	upper->setSizes(32, 0);
+	commandPool->calculateSizes(commandPoolSize, dataSize);
+	CPPUNIT_ASSERT_EQUAL(Bit(48), commandPoolSize);
+
+	inner->setLengthInBits(100);
+	commandPool->calculateSizes(commandPoolSize, dataSize);
+	CPPUNIT_ASSERT_EQUAL(Bit(100), dataSize);
+
+	// copies keep the path
+	CompoundPtr copy(compound->copy());
+	copy->getCommandPool()->calculateSizes(commandPoolSize, dataSize, lower);
+	CPPUNIT_ASSERT_EQUAL(Bit(32), commandPoolSize);
+	CPPUNIT_ASSERT_EQUAL(compound->getLengthInBits(), copy->getLengthInBits());
+} // testCached
+
+
+void
+SizeCalculationTest::testCachedPerPool()
+{
+	Bit commandPoolSize;
+	Bit dataSize;
+
+	CommandProxy* proxy = fuNet->getProxy();
+	proxy->addFunctionalUnit("upper", upper);
+	proxy->addFunctionalUnit("lower", lower);
+	upper->setSizes(8, 0);
+	lower->setSizes(16, 0);
+
+	CompoundPtr first(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(42))));
+	CompoundPtr second(fuNet->createCompound(helper::FakePDUPtr(new helper::FakePDU(42))));
+	upper->activateCommand(first->getCommandPool());
+	upper->activateCommand(second->getCommandPool());
+
+	// modifying one CommandPool does not invalidate the sizes cached
+	// by others
+	const unsigned long int epoch = CommandProxy::getSizeEpoch();
+	second->getCommandPool()->calculateSizes(commandPoolSize, dataSize);
+	upper->getCommand(first->getCommandPool());
+	lower->activateCommand(first->getCommandPool());
+	CPPUNIT_ASSERT_EQUAL(epoch, CommandProxy::getSizeEpoch());
+
+	first->getCommandPool()->calculateSizes(commandPoolSize, dataSize);
+	CPPUNIT_ASSERT_EQUAL(Bit(24), commandPoolSize);
+	second->getCommandPool()->calculateSizes(commandPoolSize, dataSize);
+	CPPUNIT_ASSERT_EQUAL(Bit(8), commandPoolSize);
+} // testCachedPerPool
+
+
 void
 SizeCalculationTest::testInPath()
 {
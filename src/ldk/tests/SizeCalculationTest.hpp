@@ -41,6 +41,8 @@ namespace wns { namespace ldk {
 		CPPUNIT_TEST_SUITE( SizeCalculationTest );
 		CPPUNIT_TEST( testEmpty );
 		CPPUNIT_TEST( testVanilla );
+		CPPUNIT_TEST( testCached );
+		CPPUNIT_TEST( testCachedPerPool );
 #ifdef WNS_ASSURE_THROWS_EXCEPTION
 		CPPUNIT_TEST_EXCEPTION( testInPath, Assure::Exception );
 #endif // WNS_ASSURE_THROWS_EXCEPTION
@@ -51,6 +53,8 @@ namespace wns { namespace ldk {
 
 		void testEmpty();
 		void testVanilla();
+		void testCached();
+		void testCachedPerPool();
 		void testInPath();
 
 	private:
@@ -29,10 +29,14 @@
 
 #include <WNS/ldk/tests/LayerStub.hpp>
 #include <WNS/ldk/fun/Main.hpp>
+#include <WNS/ldk/buffer/Dropping.hpp>
+#include <WNS/ldk/tools/Forwarder.hpp>
 
 #include <WNS/rng/RNGen.hpp>
 
 #include <iostream>
+#include <sstream>
+#include <vector>
 
 #include <ctime>
 
@@ -205,4 +209,141 @@ SpeedTest::testWithLoss()
 } // testWithLoss
 
 
+void
+SpeedTest::testRefCounts()
+{
+	// Passes compounds Stub -> buffer::Dropping -> Stub and reports the
+	// time and (with WNS_REFCOUNT_STATISTICS) the number of reference
+	// count operations per transmitted compound.
+	const long iterations = 100000;
+
+	ILayer* layer = new tests::LayerStub();
+	fun::FUN* fun = new fun::Main(layer);
+
+	wns::pyconfig::Parser bufferConfig;
+	bufferConfig.loadString("from openwns.Buffer import *\n"
+							"foo = Dropping(\n"
+							"  size = 100,\n"
+							"  sizeUnit = 'PDU',\n"
+							"  drop = 'Tail'\n"
+							")\n"
+							);
+
+	wns::pyconfig::Parser emptyConfig;
+	tools::Stub* upper = new tools::Stub(fun, emptyConfig);
+	tools::Stub* lower = new tools::Stub(fun, emptyConfig);
+	buffer::Dropping* buffer =
+		new buffer::Dropping(fun, wns::pyconfig::View(bufferConfig, "foo"));
+
+	fun->addFunctionalUnit("upper", upper);
+	fun->addFunctionalUnit("buffer", buffer);
+	fun->addFunctionalUnit("lower", lower);
+	upper
+		->connect(buffer)
+		->connect(lower);
+
+#ifdef WNS_REFCOUNT_STATISTICS
+	unsigned long int operations = 0;
+#endif
+	std::clock_t start = std::clock();
+	for(long l = 0; l < iterations; ++l) {
+		CompoundPtr compound(fun->createCompound());
+#ifdef WNS_REFCOUNT_STATISTICS
+		unsigned long int before = RefCountable::getOperations();
+#endif
+		upper->sendData(compound);
+#ifdef WNS_REFCOUNT_STATISTICS
+		operations += RefCountable::getOperations() - before;
+#endif
+		CPPUNIT_ASSERT_EQUAL(size_t(1), lower->sent.size());
+		lower->flush();
+	}
+	double seconds = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+	std::cout << "\nSpeedTest::testRefCounts: "
+			  << seconds / iterations * 1e9 << " ns per compound";
+#ifdef WNS_REFCOUNT_STATISTICS
+	std::cout << ", " << double(operations) / iterations
+			  << " reference count operations per compound";
+#else
+	std::cout << " (build with WNS_REFCOUNT_STATISTICS to count "
+			  << "reference count operations)";
+#endif
+	std::cout << "\n  freelist hit rates: Compound "
+			  << Compound::getAllocationStatistics().getHitRate()
+			  << ", CommandPool "
+			  << CommandPool::getAllocationStatistics().getHitRate()
+			  << ", Command "
+			  << Command::getAllocationStatistics().getHitRate()
+			  << std::endl;
+
+	delete fun;
+	delete layer;
+} // testRefCounts
+
+
+void
+SpeedTest::testFrozen()
+{
+	// Passes compounds down and up a chain of Forwarders and reports the
+	// time per compound and hop before and after fun::Main::freeze.
+	const long iterations = 100000;
+	const int hops = 8;
+
+	ILayer* layer = new tests::LayerStub();
+	fun::Main* fun = new fun::Main(layer);
+
+	wns::pyconfig::Parser emptyConfig;
+	tools::Stub* upper = new tools::Stub(fun, emptyConfig);
+	tools::Stub* lower = new tools::Stub(fun, emptyConfig);
+	fun->addFunctionalUnit("upper", upper);
+	fun->addFunctionalUnit("lower", lower);
+
+	FunctionalUnit* last = upper;
+	std::vector<FunctionalUnit*> forwarders;
+	for(int i = 0; i < hops; ++i) {
+		std::stringstream name;
+		name << "forwarder" << i;
+		FunctionalUnit* forwarder = new tools::Forwarder(fun, emptyConfig);
+		fun->addFunctionalUnit(name.str(), forwarder);
+		forwarders.push_back(forwarder);
+		last = last->connect(forwarder);
+	}
+	last->connect(lower);
+
+	double seconds[2];
+	for(int frozen = 0; frozen < 2; ++frozen) {
+		if(frozen)
+			fun->freeze();
+
+		for(int i = 0; i < hops; ++i)
+			CPPUNIT_ASSERT_EQUAL(frozen == 1, forwarders[i]->isFrozen());
+
+		std::clock_t start = std::clock();
+		for(long l = 0; l < iterations; ++l) {
+			CompoundPtr compound(fun->createCompound());
+			upper->sendData(compound);
+			lower->onData(compound);
+			CPPUNIT_ASSERT_EQUAL(size_t(1), lower->sent.size());
+			CPPUNIT_ASSERT_EQUAL(size_t(1), upper->received.size());
+			lower->flush();
+			upper->flush();
+		}
+		seconds[frozen] = double(std::clock() - start) / CLOCKS_PER_SEC;
+	}
 
+	std::cout << "\nSpeedTest::testFrozen: "
+			  << seconds[0] / iterations / (2 * hops) * 1e9 << " ns per hop, "
+			  << seconds[1] / iterations / (2 * hops) * 1e9 << " ns per hop frozen"
+			  << std::endl;
+
+	// connecting thaws the FUs involved
+	tools::Stub* other = new tools::Stub(fun, emptyConfig);
+	fun->addFunctionalUnit("other", other);
+	forwarders[0]->upConnect(other);
+	CPPUNIT_ASSERT(!forwarders[0]->isFrozen());
+	CPPUNIT_ASSERT(forwarders[1]->isFrozen());
+
+	delete fun;
+	delete layer;
+} // testFrozen
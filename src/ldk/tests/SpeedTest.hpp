@@ -45,6 +45,8 @@ namespace wns { namespace ldk {
 		CPPUNIT_TEST_SUITE( SpeedTest );
 		CPPUNIT_TEST( testSpeed );
 		CPPUNIT_TEST( testWithLoss );
+		CPPUNIT_TEST( testRefCounts );
+		CPPUNIT_TEST( testFrozen );
 		CPPUNIT_TEST_SUITE_END();
 
 	public:
@@ -53,6 +55,8 @@ namespace wns { namespace ldk {
 
 		void testSpeed();
 		void testWithLoss();
+		void testRefCounts();
+		void testFrozen();
 	};
 
 }}
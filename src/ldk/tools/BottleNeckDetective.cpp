@@ -129,14 +129,14 @@ BottleNeckDetective::periodically()
 	{
         if(itr->second->getJourney().size() > 0)
         {
-		    Visit v = *(itr->second->getJourney().rbegin());
-		    if(countCompounds.find(v.location) != countCompounds.end())
+		    const std::string& location = itr->second->getJourney().back().getLocation();
+		    if(countCompounds.find(location) != countCompounds.end())
 		    {
-			    countCompounds[v.location]++;
+			    countCompounds[location]++;
 		    }
 		    else
 		    {
-			    countCompounds[v.location] = 0;
+			    countCompounds[location] = 0;
 		    }
         }
 	}
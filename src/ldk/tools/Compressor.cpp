@@ -45,7 +45,7 @@ Compressor::Compressor(fun::FUN* fun, const wns::pyconfig::View& config):
 void Compressor::calculateSizes(const CommandPool* commandPool, Bit& commandPoolSize, Bit& dataSize) const
 {
     getFUN()->getProxy()->calculateSizes(commandPool, commandPoolSize, dataSize, this);
-    Command* command = getFUN()->getProxy()->getCommand(commandPool, this);
+    getFUN()->getProxy()->peekCommand(commandPool, this->getPCIID());
 
     dataSize -= reduction_;
     if(byteAlign_ && dataSize % 8 != 0)
@@ -84,8 +84,7 @@ wns::ldk::CompoundPtr
 ConstantDelay::getSomethingToSend()
 {
     assure(hasSomethingToSend(), "Called getSomethingToSend without something to send");
-    wns::ldk::CompoundPtr it = this->currentFrame;
-    this->currentFrame = wns::ldk::CompoundPtr();
+    wns::ldk::CompoundPtr it = wns::move(this->currentFrame);
 
     return it;
 }
@@ -156,6 +156,12 @@ namespace wns { namespace ldk { namespace tools {
 			return NULL;
 		}
 
+		virtual wns::ldk::Command*
+		createCommand(void*) const
+		{
+			return NULL;
+		}
+
 		virtual wns::ldk::Command*
 		copyCommand(const wns::ldk::Command*) const
 		{
@@ -174,13 +180,11 @@ namespace wns { namespace ldk { namespace tools {
 			return NULL;
 		}
 
-#ifndef NDEBUG
 		virtual size_t
 		getCommandObjSize() const
 		{
 			return 0;
 		}
-#endif
         private:
             fun::Main* fun;
 	};
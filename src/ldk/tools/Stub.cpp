@@ -69,6 +69,7 @@ StubBase::setSizes(Bit _addToPCISize, Bit _addToPDUSize)
 {
 	addToPCISize = _addToPCISize;
 	addToPDUSize = _addToPDUSize;
+	CommandProxy::invalidateSizes();
 }
 
 
@@ -42,7 +42,7 @@ namespace wns { namespace osi {
 
 /*!\brief Class \bPCI: Protocol Control Information */
 class PCI :
-    virtual public wns::RefCountable,
+    virtual public PDURefCountable,
     public wns::IOutputStreamable
 {
     friend class PDU;
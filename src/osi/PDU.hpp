@@ -47,11 +47,26 @@ typedef wns::SmartPtr<PDU> PDUPtr;
 typedef wns::SmartPtr<PCI> PCIPtr;
 
 typedef unsigned long int pduType;
+
+/**
+ * @brief Reference counting used by PDU and PCI
+ *
+ * Define WNS_ATOMIC_PDU_REFCOUNT to make PDUPtr/PCIPtr (and thus
+ * CompoundPtr) safe to copy and release from several threads, e.g. when
+ * handing PDUs to worker threads. All other RefCountables keep the
+ * default policy.
+ */
+#ifdef WNS_ATOMIC_PDU_REFCOUNT
+typedef wns::AtomicRefCountable PDURefCountable;
+#else
+typedef wns::RefCountable PDURefCountable;
+#endif
+
 /**
  * @brief Protocol Data Unit
  */
 class PDU :
-    virtual public wns::RefCountable,
+    virtual public PDURefCountable,
     public wns::IOutputStreamable
 {
 public:
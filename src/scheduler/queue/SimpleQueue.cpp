@@ -204,7 +204,7 @@ wns::ldk::CompoundPtr
 SimpleQueue::getHeadOfLinePDU(ConnectionID cid) {
     assure(queueHasPDUs(cid), "getHeadOfLinePDU called for CID without PDUs or non-existent CID");
 
-    wns::ldk::CompoundPtr pdu = queues[cid].pduQueue.front();
+    wns::ldk::CompoundPtr pdu = wns::move(queues[cid].pduQueue.front());
     queues[cid].pduQueue.pop();
     queues[cid].bits -= pdu->getLengthInBits();
 
@@ -120,7 +120,8 @@ InnerQueue::retrieve(Bit requestedBits, Bit fixedHeaderSize, Bit extensionHeader
 
     while (header->totalSize() < requestedBits)
     {
-        wns::ldk::CompoundPtr c = pduQueue_.front();
+        // non-owning, the queue keeps the front alive until pop()
+        wns::SmartPtrView<wns::ldk::Compound> c = pduQueue_.front();
         Bit length = c->getLengthInBits() - frontSegmentSentBits_; // netto
         Bit capacity = requestedBits - header->totalSize(); // netto
         if (capacity >= length)
@@ -128,7 +129,7 @@ InnerQueue::retrieve(Bit requestedBits, Bit fixedHeaderSize, Bit extensionHeader
             // fits in completely
             header->addSDU(c->copy());
             header->increaseDataSize(length);
-            probe(c, probeCC, probeCmdReader); 
+            probe(pduQueue_.front(), probeCC, probeCmdReader);
             pduQueue_.pop();
             frontSegmentSentBits_ = 0;
             nettoBits_ -= length;
@@ -34,6 +34,7 @@
 #include <WNS/TypeInfo.hpp>
 #include <WNS/TestFixture.hpp>
 #include <WNS/events/scheduler/Interface.hpp>
+#include <WNS/events/scheduler/Parallel.hpp>
 #include <WNS/simulator/Simulator.hpp>
 #include <WNS/simulator/UnitTests.hpp>
 #include <WNS/simulator/OutputPreparation.hpp>
@@ -67,13 +68,21 @@
 #include <boost/program_options/value_semantic.hpp>
 
 #include <sys/times.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <csignal>
 #include <dlfcn.h>
 #include <iomanip>
 #include <memory>
 #include <fstream>
+#include <sstream>
 #include <climits>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
 #ifdef CALLGRIND
 // For callgrind flavour, to turn on instrumentalisation
 #include <valgrind/callgrind.h>
@@ -110,7 +119,8 @@ Application::Application() :
 	lazyBinding_(false),
 	absolutePath_(false),
     statusReport(),
-    probeWriter()
+    probeWriter(),
+    replicationParent_(false)
 {
     options_.add_options()
 
@@ -331,14 +341,7 @@ Application::doInit()
 	loadModules();
 
     // prepare probes output directory according to the configured strategy
-
-    pyconfig::View outputStrategyView = wnsView.getView("outputStrategy");
-
-    std::auto_ptr<OutputPreparationStrategy> outputPreparationStrategy(
-        OutputPreparationStrategyFactory::creator(
-            outputStrategyView.get<std::string>("__plugin__"))->create());
-
-    outputPreparationStrategy->prepare(wnsView.get<std::string>("outputDir"));
+    prepareOutputDir();
 
     // if we're not in testing mode, we need some special preparation ...
     if (!testing_)
@@ -477,7 +480,31 @@ Application::doRun()
         {
 	    wns::simulator::getEventScheduler()->stopAt(maxSimTime);
         }
-    
+
+        // run the warmup once and fork the replications afterwards
+        if (!getWNSView().isNone("forkReplications"))
+        {
+            wns::simulator::Time settlingTime =
+                getWNSView().get<wns::simulator::Time>("forkReplications.settlingTime");
+            assure(maxSimTime == 0.0 || settlingTime < maxSimTime,
+                   "forkReplications.settlingTime must be smaller than maxSimTime");
+            assure(getWNSView().get<std::string>("outputDir").substr(0, 1) != "/",
+                   "forkReplications needs a relative outputDir");
+
+            // the worker threads would be missing in the replications
+            wns::events::scheduler::Parallel* parallel =
+                dynamic_cast<wns::events::scheduler::Parallel*>(wns::simulator::getEventScheduler());
+            if (parallel != NULL && parallel->getNumberOfThreads() > 1)
+            {
+                throw wns::Exception("forkReplications can't be used with a multi-threaded "
+                                     "Parallel event scheduler, set numberOfThreads = 1");
+            }
+
+            wns::simulator::getEventScheduler()->schedule(
+                wns::events::MemberFunction<Application>(this, &Application::forkReplications),
+                settlingTime);
+        }
+
         this->statusReport.writeStatus(false, "WNSStatusBeforeEventSchedulerStart.dat");
 
 	    MESSAGE_SINGLE(NORMAL, logger_, "Start Scheduler");
@@ -529,7 +556,8 @@ Application::doShutdown()
     wns::SmartPtrBase::printAllExistingPointers();
 #endif
 
-    if (!testing_)
+    // the parent only ran the warmup, its replications write the results
+    if (!testing_ && !replicationParent_)
     {
         stopProbes();
     }
@@ -563,6 +591,23 @@ Application::doShutdown()
     if (eventSchedulerMonitor_.get() != NULL)
     {
         eventSchedulerMonitor_->logStatistics();
+
+        if (eventSchedulerMonitor_->isProfiling())
+        {
+            // next to WNSStatus.dat
+            std::string profileName =
+                getWNSView().get<std::string>("outputDir") + "/" + eventSchedulerMonitor_->getProfileFileName();
+            std::ofstream profile(profileName.c_str());
+            if (profile.good())
+            {
+                eventSchedulerMonitor_->writeProfile(profile);
+                MESSAGE_SINGLE(NORMAL, logger_, "Event profile written to " << profileName);
+            }
+            else
+            {
+                MESSAGE_SINGLE(NORMAL, logger_, "Couldn't create event profile " << profileName);
+            }
+        }
         eventSchedulerMonitor_.reset();
     }
 
@@ -772,6 +817,116 @@ Application::stopProbes()
 }
 
 
+void
+Application::prepareOutputDir()
+{
+    pyconfig::View outputStrategyView = getWNSView().getView("outputStrategy");
+
+    std::auto_ptr<OutputPreparationStrategy> outputPreparationStrategy(
+        OutputPreparationStrategyFactory::creator(
+            outputStrategyView.get<std::string>("__plugin__"))->create());
+
+    outputPreparationStrategy->prepare(getWNSView().get<std::string>("outputDir"));
+}
+
+unsigned long int
+Application::getReplicationSeed(unsigned long int seed, int replication)
+{
+    return seed + replication + 1;
+}
+
+void
+Application::forkReplications()
+{
+    int numberOfReplications =
+        getWNSView().get<int>("forkReplications.numberOfReplications");
+    std::string directoryPrefix =
+        getWNSView().get<std::string>("forkReplications.directoryPrefix");
+    unsigned long int seed =
+        getWNSView().get<unsigned long int>("environment.rng.seed");
+
+    assure(numberOfReplications > 0, "forkReplications needs at least one replication");
+
+    MESSAGE_SINGLE(NORMAL, logger_, "Warmup finished, forking " << numberOfReplications << " replications");
+
+    // The real time timeouts run in threads of their own, which don't
+    // survive fork(). Stop them here, each replication restarts them.
+    statusReport.stop();
+    probeWriter.cancelPeriodicRealTimeout();
+
+    // don't let the children inherit (and repeat) buffered output
+    std::cout.flush();
+    std::cerr.flush();
+    fflush(NULL);
+
+    std::vector<pid_t> children;
+    for (int k = 0; k < numberOfReplications; ++k)
+    {
+        pid_t pid = fork();
+
+        if (pid == -1)
+        {
+            MESSAGE_SINGLE(NORMAL, logger_, "fork() failed for replication " << k << ": " << strerror(errno));
+            status_ = 1;
+            break;
+        }
+
+        if (pid == 0)
+        {
+            // child: continue the simulation as replication k
+            std::ostringstream directory;
+            directory << directoryPrefix << k;
+
+            if (mkdir(directory.str().c_str(), 0755) != 0 && errno != EEXIST)
+            {
+                wns::Exception e;
+                e << "Can't create directory " << directory.str() << ": " << strerror(errno);
+                throw e;
+            }
+            if (chdir(directory.str().c_str()) != 0)
+            {
+                wns::Exception e;
+                e << "Can't change into directory " << directory.str() << ": " << strerror(errno);
+                throw e;
+            }
+
+            wns::simulator::getRNG()->seed(getReplicationSeed(seed, k));
+
+            prepareOutputDir();
+            writeFingerprint();
+            statusReport.start(configuration_.getView("WNS"));
+
+            double period = getWNSView().get<double>("probesWriteInterval");
+            if (period != 0.0)
+            {
+                probeWriter.startPeriodicTimeout(period, period);
+            }
+
+            MESSAGE_SINGLE(NORMAL, logger_, "Replication " << k << " started in " << directory.str());
+            return;
+        }
+
+        children.push_back(pid);
+    }
+
+    // parent: the warmup is all we simulate
+    replicationParent_ = true;
+    wns::simulator::getEventScheduler()->stop();
+
+    for (std::vector<pid_t>::const_iterator it = children.begin(); it != children.end(); ++it)
+    {
+        int childStatus = 0;
+        if (waitpid(*it, &childStatus, 0) == -1 ||
+            !WIFEXITED(childStatus) ||
+            WEXITSTATUS(childStatus) != 0)
+        {
+            MESSAGE_SINGLE(NORMAL, logger_, "Replication " << (it - children.begin()) << " (pid " << *it << ") failed");
+            status_ = 1;
+        }
+    }
+
+    MESSAGE_SINGLE(NORMAL, logger_, "All replications finished");
+}
 
 void Application::writeFingerprint()
 {
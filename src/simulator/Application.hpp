@@ -97,6 +97,16 @@ namespace wns {  namespace simulator {
         virtual
         ~Application();
 
+        /**
+         * @brief Seed of the RNG in replication k (0, 1, ...) of a
+         * simulation with the given seed
+         *
+         * The seeds of all replications differ from each other and
+         * from seed itself.
+         */
+        static unsigned long int
+        getReplicationSeed(unsigned long int seed, int replication);
+
     protected:
         /**
          * @brief Reads the command line parameters
@@ -214,6 +224,27 @@ namespace wns {  namespace simulator {
         void
         stopProbes();
 
+        /**
+         * @brief Prepare outputDir according to the configured strategy
+         */
+        void
+        prepareOutputDir();
+
+        /**
+         * @brief Fork the configured number of replications
+         *
+         * Scheduled at the settling time if WNS.forkReplications is
+         * set. Each child reseeds the RNG, changes into its own
+         * directory and continues the event loop. The parent waits for
+         * all children and stops its event scheduler.
+         *
+         * fork() only duplicates the calling thread, so this requires a
+         * single-threaded event scheduler. A Parallel scheduler with
+         * more than one thread is rejected in doRun().
+         */
+        void
+        forkReplications();
+
 
         /**
          * @brief The status code of openWNS
@@ -343,6 +374,11 @@ namespace wns {  namespace simulator {
         * @brief Probe CPU cycles spent in main event loop
         */
         wns::probe::bus::ContextCollectorPtr cpuCyclesProbe_;
+
+        /**
+         * @brief True in the process that forked the replications
+         */
+        bool replicationParent_;
     };
 
 } // simulator
@@ -44,6 +44,12 @@ ISimulator::getEventScheduler() const
     return es;
 }
 
+wns::events::TimingWheel*
+ISimulator::getTimingWheel() const
+{
+    return this->doGetTimingWheel();
+}
+
 wns::logger::Master*
 ISimulator::getMasterLogger() const
 {
@@ -165,6 +171,12 @@ wns::simulator::getEventScheduler()
     return wns::simulator::getInstance()->getEventScheduler();
 }
 
+wns::events::TimingWheel*
+wns::simulator::getTimingWheel()
+{
+    return wns::simulator::getInstance()->getTimingWheel();
+}
+
 wns::logger::Master*
 wns::simulator::getMasterLogger()
 {
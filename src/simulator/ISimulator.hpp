@@ -36,7 +36,9 @@
 
 #include <memory>
 
-namespace wns { namespace events { namespace scheduler {
+namespace wns { namespace events {
+    class TimingWheel;
+namespace scheduler {
     class Interface;
 }}}
 
@@ -89,6 +91,12 @@ namespace wns { namespace simulator {
         wns::events::scheduler::Interface*
         getEventScheduler() const;
 
+        /**
+         * @brief Access the global timing wheel (NULL if not configured)
+         */
+        wns::events::TimingWheel*
+        getTimingWheel() const;
+
         /**
          * @brief Access the global logger
          */
@@ -145,6 +153,12 @@ namespace wns { namespace simulator {
         virtual wns::events::scheduler::Interface*
         doGetEventScheduler() const = 0;
 
+        /**
+         * @brief NVI forward
+         */
+        virtual wns::events::TimingWheel*
+        doGetTimingWheel() const = 0;
+
         /**
          * @brief NVI forward
          */
@@ -257,6 +271,12 @@ namespace wns { namespace simulator {
     wns::events::scheduler::Interface*
     getEventScheduler();
 
+    /**
+     * @brief Provide access to global timing wheel (NULL if not configured)
+     */
+    wns::events::TimingWheel*
+    getTimingWheel();
+
     /**
      * @brief Provide access to global logger
      */
@@ -27,6 +27,7 @@
 
 #include <WNS/simulator/Simulator.hpp>
 #include <WNS/events/scheduler/Interface.hpp>
+#include <WNS/events/TimingWheel.hpp>
 #include <WNS/logger/Master.hpp>
 #include <WNS/rng/RNGen.hpp>
 #include <WNS/Assure.hpp>
@@ -38,6 +39,7 @@ using namespace wns::simulator;
 Simulator::Simulator(const wns::pyconfig::View& configuration) :
     configuration_(configuration),
     eventScheduler_(NULL),
+    timingWheel_(NULL),
     masterLogger_(NULL),
     rng_(NULL),
     registry_(new Registry()),
@@ -46,6 +48,11 @@ Simulator::Simulator(const wns::pyconfig::View& configuration) :
     shutdownSignal_(new ShutdownSignal())
 {
     this->configureEventScheduler(configuration_.getView("environment.eventScheduler"));
+    if (configuration_.knows("environment.timingWheel") &&
+        !configuration_.isNone("environment.timingWheel"))
+    {
+        this->configureTimingWheel(configuration_.getView("environment.timingWheel"));
+    }
     this->configureMasterLogger(configuration_.getView("environment.masterLogger"));
     this->configureRNG(configuration_.getView("environment.rng"));
     this->configureProbeBusRegistry(configuration_.getView("environment.probeBusRegistry"));
@@ -61,6 +68,12 @@ Simulator::doGetEventScheduler() const
     return eventScheduler_.get();
 }
 
+wns::events::TimingWheel*
+Simulator::doGetTimingWheel() const
+{
+    return timingWheel_.get();
+}
+
 wns::logger::Master*
 Simulator::doGetMasterLogger() const
 {
@@ -117,8 +130,28 @@ Simulator::configureEventScheduler(
     assure(eventScheduler_.get() == NULL, "EventScheduler already set / configured");
 
     std::string sched = eventSchedulerConfiguration.get<std::string>("type");
-    wns::events::scheduler::Creator* creator = wns::events::scheduler::Factory::creator(sched);
-    eventScheduler_.reset(creator->create());
+    if (wns::events::scheduler::ConfigFactory::knows(sched))
+    {
+        wns::events::scheduler::ConfigCreator* creator =
+            wns::events::scheduler::ConfigFactory::creator(sched);
+        eventScheduler_.reset(creator->create(eventSchedulerConfiguration));
+    }
+    else
+    {
+        wns::events::scheduler::Creator* creator = wns::events::scheduler::Factory::creator(sched);
+        eventScheduler_.reset(creator->create());
+    }
+}
+
+void
+Simulator::configureTimingWheel(
+    const pyconfig::View& timingWheelConfiguration)
+{
+    assure(timingWheel_.get() == NULL, "TimingWheel already set / configured");
+    assure(eventScheduler_.get() != NULL, "EventScheduler not available");
+    timingWheel_.reset(
+        new wns::events::TimingWheel(eventScheduler_.get(),
+                                     timingWheelConfiguration.get<wns::simulator::Time>("resolution")));
 }
 
 void
@@ -89,6 +89,12 @@ namespace wns { namespace simulator {
         virtual wns::events::scheduler::Interface*
         doGetEventScheduler() const;
 
+        /**
+         * @brief NVI forward
+         */
+        virtual wns::events::TimingWheel*
+        doGetTimingWheel() const;
+
         /**
          * @brief NVI forward
          */
@@ -143,6 +149,12 @@ namespace wns { namespace simulator {
         void
         configureEventScheduler(const pyconfig::View& eventSchedulerConfiguration);
 
+        /**
+         * @brief helper to setup the TimingWheel
+         */
+        void
+        configureTimingWheel(const pyconfig::View& timingWheelConfiguration);
+
         /**
          * @brief helper to setup Master Logger
          */
@@ -165,6 +177,12 @@ namespace wns { namespace simulator {
          */
         std::auto_ptr<wns::events::scheduler::Interface> eventScheduler_;
 
+        /**
+         * @brief TimingWheel instance (optional, destroyed before the
+         * EventScheduler)
+         */
+        std::auto_ptr<wns::events::TimingWheel> timingWheel_;
+
         /**
          * @brief Master logger instance
          */
@@ -28,8 +28,79 @@
 #ifndef WNS_SIMULATOR_TIME_HPP
 #define WNS_SIMULATOR_TIME_HPP
 
+#ifdef WNS_FIXED_POINT_TIME
+#include <limits>
+#endif
+
 namespace wns { namespace simulator {
     typedef double Time;
+
+#ifdef WNS_FIXED_POINT_TIME
+    /**
+     * @brief Integer representation of Time used inside the event schedulers
+     *
+     * Enabled by defining WNS_FIXED_POINT_TIME at build time (e.g.
+     * env.Append(CPPDEFINES = ['WNS_FIXED_POINT_TIME']) in private.py).
+     * One tick is one nanosecond, which covers about 292 years of
+     * simulated time. The schedulers keep their queues and the current
+     * time in ticks, so events are ordered exactly and compared with
+     * integer operations. Everything outside the schedulers still uses
+     * Time, but all points in time handed out by the scheduler (and thus
+     * timeouts and probe timestamps) are multiples of one tick.
+     */
+    typedef long long int Tick;
+
+    const Tick ticksPerSecond = 1000000000LL;
+
+    /**
+     * @brief Round to the nearest tick
+     *
+     * Times beyond the Tick range (including infinity) are clamped to the
+     * first or last tick, NaN is mapped to the last tick.
+     */
+    inline Tick
+    toTick(const Time& time)
+    {
+        const Time scaled = time * ticksPerSecond;
+
+        if (!(scaled < static_cast<Time>(std::numeric_limits<Tick>::max())))
+        {
+            return std::numeric_limits<Tick>::max();
+        }
+
+        if (scaled <= static_cast<Time>(std::numeric_limits<Tick>::min()))
+        {
+            return std::numeric_limits<Tick>::min();
+        }
+
+        return static_cast<Tick>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+    }
+
+    inline Time
+    fromTick(const Tick& tick)
+    {
+        return static_cast<Time>(tick) / static_cast<Time>(ticksPerSecond);
+    }
+#else
+    /**
+     * @brief Without WNS_FIXED_POINT_TIME the schedulers use Time directly
+     */
+    typedef Time Tick;
+
+    const Tick ticksPerSecond = 1.0;
+
+    inline Tick
+    toTick(const Time& time)
+    {
+        return time;
+    }
+
+    inline Time
+    fromTick(const Tick& tick)
+    {
+        return tick;
+    }
+#endif
 }
 }
 
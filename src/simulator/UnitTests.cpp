@@ -28,6 +28,7 @@
 #include <WNS/simulator/UnitTests.hpp>
 #include <WNS/rng/RNGen.hpp>
 #include <WNS/events/scheduler/Interface.hpp>
+#include <WNS/events/TimingWheel.hpp>
 #include <WNS/probe/bus/ProbeBusRegistry.hpp>
 #include <ios>
 
@@ -51,6 +52,10 @@ UnitTests::doReset()
     // needs to be implemented and tested thoroughly to not carry any old state
     // in itself.
     getEventScheduler()->reset();
+    if (getTimingWheel() != NULL)
+    {
+        getTimingWheel()->reset();
+    }
     // seek to the beginning of the stream
     initialRNGState_.seekg (0, std::ios::beg);
     initialRNGState_ >> *getRNG();
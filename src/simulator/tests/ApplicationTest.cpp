@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/simulator/Application.hpp>
+#include <WNS/rng/RNGen.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <set>
+
+namespace wns { namespace simulator { namespace tests {
+
+    class ApplicationTest :
+        public CppUnit::TestFixture
+    {
+        CPPUNIT_TEST_SUITE( ApplicationTest );
+        CPPUNIT_TEST( replicationSeedsDiffer );
+        CPPUNIT_TEST_SUITE_END();
+
+    public:
+        void
+        setUp()
+        {}
+
+        void
+        tearDown()
+        {}
+
+        /**
+         * @brief Forked replications draw different random numbers
+         */
+        void
+        replicationSeedsDiffer()
+        {
+            const unsigned long int seed = 4711;
+            const int numberOfReplications = 4;
+
+            std::set<wns::rng::RNGen::result_type> draws;
+            wns::rng::RNGen parent(seed);
+            draws.insert(parent());
+
+            for (int k = 0; k < numberOfReplications; ++k)
+            {
+                int fds[2];
+                CPPUNIT_ASSERT_EQUAL(0, pipe(fds));
+
+                pid_t pid = fork();
+                CPPUNIT_ASSERT(pid != -1);
+
+                if (pid == 0)
+                {
+                    // replication k: reseed and report the first draw
+                    close(fds[0]);
+                    wns::rng::RNGen rng(seed);
+                    rng.seed(Application::getReplicationSeed(seed, k));
+                    wns::rng::RNGen::result_type draw = rng();
+                    ssize_t written = write(fds[1], &draw, sizeof(draw));
+                    _exit(written == sizeof(draw) ? 0 : 1);
+                }
+
+                close(fds[1]);
+                wns::rng::RNGen::result_type draw = 0;
+                CPPUNIT_ASSERT_EQUAL(static_cast<ssize_t>(sizeof(draw)), read(fds[0], &draw, sizeof(draw)));
+                close(fds[0]);
+
+                int status = 0;
+                CPPUNIT_ASSERT_EQUAL(pid, waitpid(pid, &status, 0));
+                CPPUNIT_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+                draws.insert(draw);
+            }
+
+            CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(numberOfReplications + 1), draws.size());
+        }
+    };
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( ApplicationTest );
+
+} // tests
+} // simulator
+} // wns
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * This file is part of openWNS (open Wireless Network Simulator)
+ * _____________________________________________________________________________
+ *
+ * Copyright (C) 2004-2007
+ * Chair of Communication Networks (ComNets)
+ * Kopernikusstr. 16, D-52074 Aachen, Germany
+ * phone: ++49-241-80-27910,
+ * fax: ++49-241-80-22242
+ * email: info@openwns.org
+ * www: http://www.openwns.org
+ * _____________________________________________________________________________
+ *
+ * openWNS is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 2 as published by the
+ * Free Software Foundation;
+ *
+ * openWNS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <WNS/FreeList.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <vector>
+
+namespace wns { namespace tests {
+
+	class FreeListTest :
+		public CppUnit::TestFixture
+	{
+		class Pooled :
+			public wns::PooledAllocation<Pooled>
+		{
+		public:
+			virtual
+			~Pooled()
+			{}
+
+			int payload[4];
+		};
+
+		class LargerPooled :
+			public Pooled
+		{
+		public:
+			int morePayload[8];
+		};
+
+		class Base :
+			public wns::SizeClassAllocation<Base>
+		{
+		public:
+			virtual
+			~Base()
+			{}
+		};
+
+		class Small :
+			public Base
+		{
+			char payload[8];
+		};
+
+		class Large :
+			public Base
+		{
+			char payload[100];
+		};
+
+		class Huge :
+			public Base
+		{
+			char payload[1000];
+		};
+
+		CPPUNIT_TEST_SUITE( FreeListTest );
+		CPPUNIT_TEST( reuse );
+		CPPUNIT_TEST( derivedBypass );
+		CPPUNIT_TEST( sizeClasses );
+		CPPUNIT_TEST( trim );
+		CPPUNIT_TEST_SUITE_END();
+
+	public:
+		void setUp();
+		void tearDown();
+		void reuse();
+		void derivedBypass();
+		void sizeClasses();
+		void trim();
+	};
+
+	CPPUNIT_TEST_SUITE_REGISTRATION( FreeListTest );
+
+	void FreeListTest::setUp()
+	{
+	}
+
+	void FreeListTest::tearDown()
+	{
+	}
+
+	void FreeListTest::reuse()
+	{
+		FreeListStatistics before = Pooled::getAllocationStatistics();
+
+		Pooled* p = new Pooled;
+		delete p;
+		Pooled* q = new Pooled;
+#ifndef WNS_NO_FREELIST
+		// the block just freed is handed out again
+		CPPUNIT_ASSERT( p == q );
+#endif
+		delete q;
+
+#ifndef WNS_NO_FREELIST
+		FreeListStatistics after = Pooled::getAllocationStatistics();
+		CPPUNIT_ASSERT_EQUAL( 2UL, after.allocations - before.allocations );
+		CPPUNIT_ASSERT_EQUAL( 2UL, after.deallocations - before.deallocations );
+		CPPUNIT_ASSERT( after.hits - before.hits >= 1 );
+		CPPUNIT_ASSERT( after.getHitRate() > 0.0 );
+#endif
+	}
+
+	void FreeListTest::derivedBypass()
+	{
+		FreeListStatistics before = Pooled::getAllocationStatistics();
+
+		// larger derived classes are served by the heap
+		Pooled* p = new LargerPooled;
+		delete p;
+
+		FreeListStatistics after = Pooled::getAllocationStatistics();
+		CPPUNIT_ASSERT_EQUAL( before.allocations, after.allocations );
+		CPPUNIT_ASSERT_EQUAL( before.deallocations, after.deallocations );
+	}
+
+	void FreeListTest::sizeClasses()
+	{
+		FreeListStatistics before = Base::getAllocationStatistics();
+
+		std::vector<Base*> objects;
+		for (int ii = 0; ii < 10; ++ii)
+		{
+			objects.push_back(new Small);
+			objects.push_back(new Large);
+			objects.push_back(new Huge);
+		}
+		for (size_t ii = 0; ii < objects.size(); ++ii)
+		{
+			delete objects[ii];
+		}
+		objects.clear();
+		for (int ii = 0; ii < 10; ++ii)
+		{
+			objects.push_back(new Small);
+			objects.push_back(new Large);
+		}
+		for (size_t ii = 0; ii < objects.size(); ++ii)
+		{
+			delete objects[ii];
+		}
+
+#ifndef WNS_NO_FREELIST
+		FreeListStatistics after = Base::getAllocationStatistics();
+		// Huge exceeds the largest size class
+		CPPUNIT_ASSERT_EQUAL( 40UL, after.allocations - before.allocations );
+		CPPUNIT_ASSERT_EQUAL( 40UL, after.deallocations - before.deallocations );
+		CPPUNIT_ASSERT_EQUAL( 20UL, after.hits - before.hits );
+#endif
+	}
+
+	void FreeListTest::trim()
+	{
+		typedef FreeList<32, FreeListTest> List;
+
+		void* p = List::allocate();
+		void* q = List::allocate();
+		List::deallocate(p);
+		List::deallocate(q);
+		CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(2), List::getLength() );
+
+		List::trim();
+		CPPUNIT_ASSERT_EQUAL( static_cast<size_t>(0), List::getLength() );
+		CPPUNIT_ASSERT_EQUAL( 2UL, List::getStatistics().allocations );
+		CPPUNIT_ASSERT_EQUAL( 0UL, List::getStatistics().hits );
+	}
+
+} // tests
+} // wns
@@ -34,6 +34,8 @@
 #include <list>
 #include <stdexcept>
 #include <algorithm>
+#include <vector>
+#include <pthread.h>
 
 namespace wns { namespace tests {
 
@@ -139,6 +141,24 @@ namespace wns { namespace tests {
 			SmartPtr<F1> peer;
 		};
 
+		class G :
+			public virtual AtomicRefCountable
+		{
+		};
+
+		static void*
+		copyAndRelease(void* arg)
+		{
+			SmartPtr<G> g = *static_cast<SmartPtr<G>*>(arg);
+			std::vector< SmartPtr<G> > copies;
+			for (int ii = 0; ii < 200; ++ii)
+			{
+				copies.assign(1000, g);
+				copies.clear();
+			}
+			return NULL;
+		}
+
 		CPPUNIT_TEST_SUITE( SmartPtrTest );
 		CPPUNIT_TEST( refCountable );
 		CPPUNIT_TEST( STLContainer );
@@ -152,6 +172,12 @@ namespace wns { namespace tests {
 		CPPUNIT_TEST( functionAdapterTest );
 		CPPUNIT_TEST( isNull );
 		CPPUNIT_TEST( cyclicDependencyTest );
+		CPPUNIT_TEST( moveAndSwap );
+		CPPUNIT_TEST( view );
+#ifndef WNS_SMARTPTR_DEBUGGING
+		// the SmartPtr debugging registry itself is not thread-safe
+		CPPUNIT_TEST( atomicRefCount );
+#endif
 		CPPUNIT_TEST_SUITE_END();
 	public:
 		bool destructorHasBeenCalled;
@@ -170,6 +196,9 @@ namespace wns { namespace tests {
 		void functionAdapterTest();
 		void isNull();
 		void cyclicDependencyTest();
+		void moveAndSwap();
+		void view();
+		void atomicRefCount();
 	};
 
 
@@ -406,6 +435,79 @@ namespace wns { namespace tests {
 	  //std::cout<<"cyclicDependencyTest: object2.getRefCount()="<<object1.getRefCount()<<std::endl;
 	}
 
+	void SmartPtrTest::moveAndSwap()
+	{
+		std::list< SmartPtr<A> > container;
+		container.push_back( SmartPtr<A>( new A() ) );
+		A* raw = container.front().getPtr();
+		CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), raw->getRefCount() );
+
+		SmartPtr<A> a = wns::move(container.front());
+		CPPUNIT_ASSERT( container.front() == NULL );
+		CPPUNIT_ASSERT( a.getPtr() == raw );
+		CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), a.getRefCount() );
+		container.pop_front();
+
+		SmartPtr<A> b( new A() );
+		A* rawB = b.getPtr();
+		wns::swap(a, b);
+		CPPUNIT_ASSERT( a.getPtr() == rawB );
+		CPPUNIT_ASSERT( b.getPtr() == raw );
+		CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), a.getRefCount() );
+		CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), b.getRefCount() );
+
+		destructorHasBeenCalled = false;
+		SmartPtr<A> c( new B(this) );
+		// the object formerly held by c is released on move assignment
+		c = wns::move(a);
+		CPPUNIT_ASSERT( destructorHasBeenCalled );
+		CPPUNIT_ASSERT( a == NULL );
+		CPPUNIT_ASSERT( c.getPtr() == rawB );
+		CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), c.getRefCount() );
+
+		// self move is a no-op
+		c = wns::move(c);
+		CPPUNIT_ASSERT( c.getPtr() == rawB );
+		CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), c.getRefCount() );
+	}
+
+	void SmartPtrTest::view()
+	{
+		SmartPtr<A> a( new A() );
+		SmartPtrView<A> v = a;
+		CPPUNIT_ASSERT( v );
+		CPPUNIT_ASSERT( v.getPtr() == a.getPtr() );
+		CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), a.getRefCount() );
+		CPPUNIT_ASSERT_EQUAL( 42L, v->foo() );
+
+		SmartPtrView<A> v2 = v;
+		CPPUNIT_ASSERT( v2 == v );
+		CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), a.getRefCount() );
+
+		SmartPtr<A> a2 = v.toSmartPtr();
+		CPPUNIT_ASSERT_EQUAL( static_cast<long int>(2), a.getRefCount() );
+		CPPUNIT_ASSERT( a2 == a );
+
+		SmartPtrView<A> empty;
+		CPPUNIT_ASSERT( !empty );
+		CPPUNIT_ASSERT( empty.toSmartPtr() == NULL );
+	}
+
+	void SmartPtrTest::atomicRefCount()
+	{
+		SmartPtr<G> g( new G() );
+		std::vector<pthread_t> threads(4);
+		for (size_t ii = 0; ii < threads.size(); ++ii)
+		{
+			pthread_create(&threads[ii], NULL, &SmartPtrTest::copyAndRelease, &g);
+		}
+		for (size_t ii = 0; ii < threads.size(); ++ii)
+		{
+			pthread_join(threads[ii], NULL);
+		}
+		CPPUNIT_ASSERT_EQUAL( static_cast<long int>(1), g.getRefCount() );
+	}
+
 } // tests
 } // wns
 